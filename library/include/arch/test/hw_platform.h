@@ -264,6 +264,7 @@ void delay_us(std::uint16_t us) noexcept;
 
 /** Mapping of AVR register bits and flags. */
 #define I_FLAG 7U
+#define SREG_I 7U
 #define WDP0   0U
 #define WDP1   1U
 #define WDP2   2U
@@ -285,8 +286,10 @@ void delay_us(std::uint16_t us) noexcept;
 #define CS21   1U
 #define WGM12  3U
 #define TOIE0  0U
+#define TOIE1  0U
 #define OCIE1A 1U
 #define TOIE2  0U
+#define TOV1   0U
 
 #define UDRE0  5U
 #define RXEN0  4U
@@ -294,6 +297,13 @@ void delay_us(std::uint16_t us) noexcept;
 #define UCSZ00 1U
 #define UCSZ01 2U
 #define RXC0   7U
+#define TXC0   6U
+#define U2X0   1U
+#define RXCIE0 7U
+#define TXCIE0 6U
+#define UDRIE0 5U
+
+#define SE    0U
 
 #define EEPE  1U
 #define EEMPE 2U
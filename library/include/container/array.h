@@ -236,6 +236,8 @@ protected:
     template <size_t ValueCount>
     void copy(const Array<T, ValueCount>& other, size_t offset = 0U) noexcept;
 
+    void move(Array<T, Size>& other) noexcept;
+
     /** Statically-sized data field. */
     T myData[Size];
 };
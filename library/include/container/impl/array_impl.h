@@ -33,14 +33,17 @@ Array<T, Size>::Array(const T (&values)[Size]) noexcept
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 Array<T, Size>::Array(const Array<T, Size>& other) noexcept
-    : myData{other.myData} {}
+    : Array()
+{
+    copy(other);
+}
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 Array<T, Size>::Array(Array<T, Size>&& other) noexcept
-    : myData{other.myData}
+    : Array()
 {
-    other.clear();
+    move(other);
 }
 
 // -----------------------------------------------------------------------------
@@ -56,8 +59,7 @@ Array<T, Size>& Array<T, Size>::operator=(const Array<T, ValueCount>& other) noe
 template <typename T, size_t Size>
 Array<T, Size>& Array<T, Size>::operator=(Array<T, Size>&& other) noexcept
 {
-    copy(other);
-    other.clear();
+    if (this != &other) { move(other); }
     return *this;
 }
 
@@ -184,9 +186,17 @@ template <typename T, size_t Size>
 template <size_t ValueCount>
 void Array<T, Size>::copy(const Array<T, ValueCount>& other, const size_t offset) noexcept
 {
-    for (size_t i{}; i + offset < Size && i < other.Size(); ++i) 
+    for (size_t i{}; i + offset < Size && i < ValueCount; ++i) 
     {
         myData[offset + i] = other[i];
     }
 }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void Array<T, Size>::move(Array<T, Size>& other) noexcept
+{
+    for (size_t i{}; i < Size; ++i) { myData[i] = utils::move(other.myData[i]); }
+    other.clear();
+}
 } // namespace container
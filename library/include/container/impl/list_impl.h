@@ -12,63 +12,70 @@ namespace container
 /**
  * @brief Implementation of node holding data in a linked list.
  * 
- * @param[in] T The node type, i.e. the type of the stored data.
+ * @param[in] T         The node type, i.e. the type of the stored data.
+ * @param[in] Allocator The node allocator of the list.
  */
-template <typename T>
-struct List<T>::Node 
+template <typename T, typename Allocator>
+struct List<T, Allocator>::Node 
 {
     Node* previous; // Pointer to previous node.
     Node* next;     // Pointer to next data.
     T data;         // Data the node holds.
 
-    static Node* create(const T& data) noexcept;
-    static void destroy(Node* self) noexcept;
     static Node* get(Iterator& iterator) noexcept;
     static const Node* get(ConstIterator& iterator) noexcept;
 };
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List() noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List() noexcept
+    : List(memory::defaultAllocator<Allocator>()) {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+List<T, Allocator>::List(Allocator& allocator) noexcept
     : myFirst{nullptr}
     , myLast{nullptr}
-    , mySize{nullptr} {}
+    , mySize{}
+    , myAllocator{&allocator} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const size_t size, const T& startValue) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const size_t size, const T& startValue) noexcept
     : List() 
 { 
     resize(size, startValue); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Values> 
-List<T>::List(const Values&&... values) noexcept
+List<T, Allocator>::List(const Values&&... values) noexcept
+    : List()
 { 
     const T array[sizeof...(values)]{(values)...};
     addValues(array);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::~List() noexcept { clear(); }
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() noexcept { clear(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const List<T>& other) noexcept
-    : List()
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List<T, Allocator>& other) noexcept
+    : List(*other.myAllocator)
 {
     copy(other);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(List<T>&& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List<T, Allocator>&& other) noexcept
     : myFirst{other.myFirst}
     , myLast{other.myLast}
     , mySize{other.mySize}
+    , myAllocator{other.myAllocator}
 {
     other.myFirst = nullptr;
     other.myLast  = nullptr;
@@ -76,8 +83,8 @@ List<T>::List(List<T>&& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(const List<T>& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(const List<T, Allocator>& other) noexcept
 {
     clear();
     copy(other);
@@ -85,13 +92,14 @@ List<T>& List<T>::operator=(const List<T>& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(List<T>&& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(List<T, Allocator>&& other) noexcept
 {
     clear();
-    myFirst = other.myFirst;
-    myLast  = other.myLast;
-    mySize  = other.mySize;
+    myFirst     = other.myFirst;
+    myLast      = other.myLast;
+    mySize      = other.mySize;
+    myAllocator = other.myAllocator;
 
     other.myFirst = nullptr;
     other.myLast  = nullptr;
@@ -100,37 +108,40 @@ List<T>& List<T>::operator=(List<T>&& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator+=(const List<T>& other) noexcept 
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator+=(const List<T, Allocator>& other) noexcept 
 { 
     copy(other); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-List<T>& List<T>::operator+=(const T (&values)[ValueCount]) noexcept 
+List<T, Allocator>& List<T, Allocator>::operator+=(const T (&values)[ValueCount]) noexcept 
 { 
     addValues(values); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& List<T>::operator[](Iterator& iterator) noexcept { return *iterator; }
+template <typename T, typename Allocator>
+T& List<T, Allocator>::operator[](Iterator& iterator) noexcept { return *iterator; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& List<T>::operator[] (ConstIterator& iterator) const noexcept { return *iterator; }
+template <typename T, typename Allocator>
+const T& List<T, Allocator>::operator[] (ConstIterator& iterator) const noexcept
+{
+    return *iterator;
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t List<T>::size() const noexcept { return mySize; }
+template <typename T, typename Allocator>
+size_t List<T, Allocator>::size() const noexcept { return mySize; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::clear() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() noexcept
 {
     removeAllNodes();
     myFirst = nullptr;
@@ -139,203 +150,184 @@ void List<T>::clear() noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::empty() const noexcept { return mySize == 0U; }
+template <typename T, typename Allocator>
+bool List<T, Allocator>::empty() const noexcept { return mySize == 0U; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::begin() noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::begin() noexcept
 { 
     return mySize > 0U ? Iterator{myFirst} : Iterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::begin() const noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::begin() const noexcept
 { 
     return mySize > 0U ? ConstIterator{myFirst} : ConstIterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::end() noexcept { return Iterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::end() noexcept
+{
+    return Iterator{nullptr};
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::end() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::end() const noexcept
+{
+    return ConstIterator{nullptr};
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rbegin() noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::rbegin() noexcept
 { 
     return mySize > 0U ? Iterator{myLast} : Iterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rbegin() const noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::rbegin() const noexcept
 { 
     return mySize > 0U ? ConstIterator{myLast} : ConstIterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rend() noexcept { return Iterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::rend() noexcept
+{
+    return Iterator{nullptr};
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rend() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::rend() const noexcept
+{
+    return ConstIterator{nullptr};
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::resize(const size_t newSize, const T& startValue) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::resize(const size_t newSize, const T& startValue) noexcept
 {
     while (mySize < newSize) 
     {
         if (!pushBack(startValue)) { return false; }
     }
-    while (mySize > newSize) { popFront(); }
+    while (mySize > newSize) { popBack(); }
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushFront(const T& value) noexcept
-{
-    auto node1{Node::create(value)};
-    if (node1 == nullptr) { return false; }
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushFront(const T& value) noexcept { return emplaceFront(value); }
 
-    if (mySize++ == 0U) 
-    {
-        myFirst = node1;
-        myLast  = node1;
-    } 
-    else 
-    {
-        auto node2{myFirst};
-        node1->next     = node2;
-        node2->previous = node1;
-        myFirst         = node1;
-    }
-    return true;
-}
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushFront(T&& value) noexcept { return emplaceFront(utils::move(value)); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushBack(const T& value) noexcept
-{
-    auto node2{Node::create(value)};
-    if (node2 == nullptr) { return false; }  
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushBack(const T& value) noexcept { return emplaceBack(value); }
 
-    if (mySize++ == 0U) 
-    {
-        myFirst = node2;
-        myLast  = node2;
-    } 
-    else 
-    {
-        auto node1{myLast};
-        node1->next     = node2;
-        node2->previous = node1;
-        myLast          = node2;
-    }
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushBack(T&& value) noexcept { return emplaceBack(utils::move(value)); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+bool List<T, Allocator>::emplaceFront(Args&&... args) noexcept
+{
+    auto node{createNode(utils::forward<Args>(args)...)};
+    if (node == nullptr) { return false; }
+    link(node, myFirst);
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::insert(Iterator& iterator, const T& value) noexcept
+template <typename T, typename Allocator>
+template <typename... Args>
+bool List<T, Allocator>::emplaceBack(Args&&... args) noexcept
 {
-    if (iterator == nullptr) {  return false; }
-    auto node2{Node::create(value)};
-    if (node2 == nullptr) return false;   
-    auto node1{Node::get(iterator)->previous};
-    auto node3{node1->next};
-
-    node1->next     = node2;
-    node2->previous = node1;
-    node2->next     = node3;
-    node3->previous = node2;
-    mySize++;
-    return true;      
+    auto node{createNode(utils::forward<Args>(args)...)};
+    if (node == nullptr) { return false; }
+    link(node, nullptr);
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popFront() noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::insert(Iterator& iterator, const T& value) noexcept
 {
-    if (mySize <= 1U) { clear(); }
-    else
-    {
-        auto node1{myFirst};
-        auto node2{node1->next};
-        node2->previous = nullptr;
-        Node::destroy(node1);
-        myFirst = node2;
-        mySize--;
-    }
+    if (iterator == end()) { return false; }
+    auto node{createNode(value)};
+    if (node == nullptr) { return false; }
+    link(node, Node::get(iterator));
+    return true;      
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popBack() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::popFront() noexcept
 {
-    if (mySize <= 1U) { clear(); }
-    else 
-    {
-        auto node2{myLast};
-        auto node1{node2->previous};
-        node1->next = nullptr;     
-        Node::destroy(node2);
-        myLast = node1;
-        mySize--;
-    }
+    if (mySize == 0U) { return; }
+    auto node{myFirst};
+    unlink(node);
+    destroyNode(node);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::remove(Iterator& iterator) noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::popBack() noexcept
 {
-    if (iterator == nullptr) { return false; } 
-    else 
-    {
-        auto node2{iterator.get()};
-        auto node1{node2->previous};
-        auto node3{node2->next};
-        node1->next = node3;
-        node3->previous = node1;
-        Node::destroy(node2);
-        mySize--;
-        return true;
-    }
+    if (mySize == 0U) { return; }
+    auto node{myLast};
+    unlink(node);
+    destroyNode(node);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::copy(const List<T>& other) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::remove(Iterator& iterator) noexcept
 {
-    for (size_t i{}; i < other.size(); ++i) 
-    {
-        if (!pushBack(other[i])) { return false; }
-    }
+    if (iterator == end()) { return false; } 
+    auto node{Node::get(iterator)};
+    iterator = Iterator{node->next};
+    unlink(node);
+    destroyNode(node);
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-template <size_t ValueCount>
-void List<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept
+template <typename T, typename Allocator>
+Allocator& List<T, Allocator>::allocator() const noexcept { return *myAllocator; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+constexpr size_t List<T, Allocator>::nodeSize() noexcept { return sizeof(Node); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::copy(const List<T, Allocator>& other) noexcept
 {
-    for (size_t i{}; i < ValueCount && offset + i < mySize; ++i)
+    auto node{other.myFirst};
+
+    // Store the size of the other list up front, since the lists may be the same.
+    for (size_t i{}, count{other.mySize}; i < count; ++i, node = node->next) 
     {
-        (*this)[offset + i] = values[i];
+        if (!pushBack(node->data)) { return false; }
     }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
+bool List<T, Allocator>::addValues(const T (&values)[ValueCount]) noexcept
 {
     if (ValueCount == 0U) { return false; }
     for (size_t i{}; i < ValueCount; ++i)
@@ -346,44 +338,76 @@ bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::removeAllNodes() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::link(Node* node, Node* next) noexcept
+{
+    // Place the node before the next node, or last in the list if there's no next node.
+    node->previous = next != nullptr ? next->previous : myLast;
+    node->next     = next;
+
+    if (node->previous != nullptr) { node->previous->next = node; }
+    else { myFirst = node; }
+    if (next != nullptr) { next->previous = node; }
+    else { myLast = node; }
+    mySize++;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+void List<T, Allocator>::unlink(Node* node) noexcept
 {
-    for (auto i{begin()}; i != end();) 
+    if (node->previous != nullptr) { node->previous->next = node->next; }
+    else { myFirst = node->next; }
+    if (node->next != nullptr) { node->next->previous = node->previous; }
+    else { myLast = node->previous; }
+    mySize--;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+void List<T, Allocator>::removeAllNodes() noexcept
+{
+    for (auto node{myFirst}; node != nullptr;) 
     {
-        auto next{Node::get(i)->next};
-        Node::destroy(Node::get(i));
-        i = next;
+        auto next{node->next};
+        destroyNode(node);
+        node = next;
     }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::create(const T& data) noexcept
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::Node* List<T, Allocator>::createNode(Args&&... args) noexcept
 {
-    auto self{utils::newMemory<Node>()};
-    if (self == nullptr) { return nullptr; }
-    self->data     = data;
-    self->previous = nullptr;
-    self->next     = nullptr;
-    return self;
+    auto node{static_cast<Node*>(myAllocator->allocate(sizeof(Node)))};
+    if (node == nullptr) { return nullptr; }
+    node->previous = nullptr;
+    node->next     = nullptr;
+    utils::construct(&node->data, utils::forward<Args>(args)...);
+    return node;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::Node::destroy(Node* self) noexcept { utils::deleteMemory(self); }
+template <typename T, typename Allocator>
+void List<T, Allocator>::destroyNode(Node* node) noexcept 
+{ 
+    utils::destroy(&node->data);
+    myAllocator->deallocate(node); 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::get(Iterator& iterator) noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Node* List<T, Allocator>::Node::get(Iterator& iterator) noexcept
 { 
     return static_cast<Node*>(iterator.address()); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const typename List<T>::Node* List<T>::Node::get(ConstIterator& iterator) noexcept
+template <typename T, typename Allocator>
+const typename List<T, Allocator>::Node*
+    List<T, Allocator>::Node::get(ConstIterator& iterator) noexcept
 {
-    return static_cast<Node*>(iterator.address());
+    return static_cast<const Node*>(iterator.address());
 }
 } // namespace container
@@ -0,0 +1,160 @@
+/**
+ * @brief Implementation details of container::RingBuffer class.
+ * 
+ * @note Don't include this header, use <ring_buffer.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+RingBuffer<T, Size>::RingBuffer() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::push(const T& value) noexcept
+{
+    const uint8_t head{myHead};
+    if (Size <= static_cast<uint8_t>(head - __atomic_load_n(&myTail, __ATOMIC_ACQUIRE))) 
+    { 
+        return false; 
+    }
+
+    // Store the value before publishing the new head to the consumer.
+    myData[head & IndexMask] = value;
+    __atomic_store_n(&myHead, static_cast<uint8_t>(head + 1U), __ATOMIC_RELEASE);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::pop(T& value) noexcept
+{
+    const uint8_t tail{myTail};
+    if (__atomic_load_n(&myHead, __ATOMIC_ACQUIRE) == tail) { return false; }
+
+    // Read the value before handing its position back to the producer.
+    value = myData[tail & IndexMask];
+    __atomic_store_n(&myTail, static_cast<uint8_t>(tail + 1U), __ATOMIC_RELEASE);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t RingBuffer<T, Size>::push(const T* values, const size_t count) noexcept
+{
+    const uint8_t head{myHead};
+    const uint8_t freeCount{static_cast<uint8_t>(
+        Size - static_cast<uint8_t>(head - __atomic_load_n(&myTail, __ATOMIC_ACQUIRE)))};
+    const size_t pushCount{count < freeCount ? count : freeCount};
+
+    // Copy the values in at most two chunks, wrapping at the end of the buffer.
+    const size_t offset{static_cast<size_t>(head & IndexMask)};
+    const size_t chunkSize{pushCount < Size - offset ? pushCount : Size - offset};
+    copy(values, myData + offset, chunkSize);
+    copy(values + chunkSize, myData, pushCount - chunkSize);
+
+    // Publish all values to the consumer at once.
+    __atomic_store_n(&myHead, static_cast<uint8_t>(head + pushCount), __ATOMIC_RELEASE);
+    return pushCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t RingBuffer<T, Size>::pop(T* values, const size_t maxCount) noexcept
+{
+    const uint8_t tail{myTail};
+    const uint8_t usedCount{
+        static_cast<uint8_t>(__atomic_load_n(&myHead, __ATOMIC_ACQUIRE) - tail)};
+    const size_t popCount{maxCount < usedCount ? maxCount : usedCount};
+
+    // Copy the values in at most two chunks, wrapping at the end of the buffer.
+    const size_t offset{static_cast<size_t>(tail & IndexMask)};
+    const size_t chunkSize{popCount < Size - offset ? popCount : Size - offset};
+    copy(myData + offset, values, chunkSize);
+    copy(myData, values + chunkSize, popCount - chunkSize);
+
+    // Hand all positions back to the producer at once.
+    __atomic_store_n(&myTail, static_cast<uint8_t>(tail + popCount), __ATOMIC_RELEASE);
+    return popCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+template <size_t ValueCount>
+size_t RingBuffer<T, Size>::push(const T (&values)[ValueCount]) noexcept
+{
+    return push(values, ValueCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+template <size_t ValueCount>
+size_t RingBuffer<T, Size>::pop(T (&values)[ValueCount]) noexcept
+{
+    return pop(values, ValueCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t RingBuffer<T, Size>::size() const noexcept
+{
+    // The indexes are free-running, so the difference is the number of values.
+    return static_cast<uint8_t>(__atomic_load_n(&myHead, __ATOMIC_ACQUIRE) - 
+                                __atomic_load_n(&myTail, __ATOMIC_ACQUIRE));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::empty() const noexcept { return 0U == size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+bool RingBuffer<T, Size>::full() const noexcept { return Size <= size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+typename RingBuffer<T, Size>::Iterator RingBuffer<T, Size>::begin() noexcept
+{
+    return Iterator{myData, myTail};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+typename RingBuffer<T, Size>::ConstIterator RingBuffer<T, Size>::begin() const noexcept
+{
+    return ConstIterator{myData, myTail};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+typename RingBuffer<T, Size>::Iterator RingBuffer<T, Size>::end() noexcept
+{
+    return Iterator{myData, __atomic_load_n(&myHead, __ATOMIC_ACQUIRE)};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+typename RingBuffer<T, Size>::ConstIterator RingBuffer<T, Size>::end() const noexcept
+{
+    return ConstIterator{myData, __atomic_load_n(&myHead, __ATOMIC_ACQUIRE)};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void RingBuffer<T, Size>::clear() noexcept
+{
+    __atomic_store_n(&myTail, __atomic_load_n(&myHead, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void RingBuffer<T, Size>::copy(const T* source, T* destination, const size_t count) noexcept
+{
+    for (size_t i{}; i < count; ++i) { destination[i] = source[i]; }
+}
+} // namespace container
@@ -0,0 +1,338 @@
+/**
+ * @brief Implementation details of container::StaticVector class.
+ *
+ * @note Don't include this header, use <static_vector.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector() noexcept
+    : mySize{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(const size_t size) noexcept
+    : StaticVector()
+{
+    resize(size);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <typename... Values>
+StaticVector<T, Capacity>::StaticVector(const Values&&... values) noexcept
+    : StaticVector()
+{
+    static_assert(sizeof...(values) <= Capacity, "Too many values for static vector!");
+    const T array[sizeof...(values)]{(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(const StaticVector<T, Capacity>& other) noexcept
+    : StaticVector()
+{
+    copy(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector(StaticVector<T, Capacity>&& other) noexcept
+    : StaticVector()
+{
+    move(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::~StaticVector() noexcept
+{
+    clear();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator=(
+    const StaticVector<T, Capacity>& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        copy(other);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator=(
+    StaticVector<T, Capacity>&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        move(other);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator+=(
+    const StaticVector<T, Capacity>& other) noexcept
+{
+    copy(other);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <size_t ValueCount>
+StaticVector<T, Capacity>& StaticVector<T, Capacity>::operator+=(
+    const T (&values)[ValueCount]) noexcept
+{
+    addValues(values);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T& StaticVector<T, Capacity>::operator[](const size_t index) noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T& StaticVector<T, Capacity>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t StaticVector<T, Capacity>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::full() const noexcept { return mySize == Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::begin() noexcept
+{
+    return Iterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator
+    StaticVector<T, Capacity>::begin() const noexcept
+{
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::end() noexcept
+{
+    return Iterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator
+    StaticVector<T, Capacity>::end() const noexcept
+{
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::rbegin() noexcept
+{
+    return mySize > 0U ? Iterator{myData + mySize - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator
+    StaticVector<T, Capacity>::rbegin() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData + mySize - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::rend() noexcept
+{
+    return mySize > 0U ? Iterator{myData - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator
+    StaticVector<T, Capacity>::rend() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T* StaticVector<T, Capacity>::last() noexcept
+{
+    return mySize > 0U ? myData + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::last() const noexcept
+{
+    return mySize > 0U ? myData + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::clear() noexcept
+{
+    for (size_t i{}; i < mySize; ++i) { utils::destroy(myData + i); }
+    mySize = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::resize(const size_t newSize) noexcept
+{
+    if (newSize > Capacity) { return false; }
+    for (size_t i{newSize}; i < mySize; ++i) { utils::destroy(myData + i); }
+    for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::reserve(const size_t newCapacity) const noexcept
+{
+    return newCapacity <= Capacity;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::shrinkToFit() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(const T& value) noexcept
+{
+    return emplaceBack(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(T&& value) noexcept
+{
+    return emplaceBack(utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <typename... Args>
+bool StaticVector<T, Capacity>::emplaceBack(Args&&... args) noexcept
+{
+    if (mySize == Capacity) { return false; }
+    utils::construct(myData + mySize++, utils::forward<Args>(args)...);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::popBack() noexcept
+{
+    if (mySize == 0U) { return false; }
+    utils::destroy(myData + --mySize);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::insert(const size_t index, const T& value) noexcept
+{
+    // Copy the value first, since it may refer to an element of this vector.
+    return insert(index, T{value});
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::insert(const size_t index, T&& value) noexcept
+{
+    if ((index > mySize) || (mySize == Capacity)) { return false; }
+    if (index == mySize) { return emplaceBack(utils::move(value)); }
+
+    // Shift the subsequent values one step back, then move the value into place.
+    utils::construct(myData + mySize, utils::move(myData[mySize - 1U]));
+    for (size_t i{mySize - 1U}; i > index; --i) { myData[i] = utils::move(myData[i - 1U]); }
+    myData[index] = utils::move(value);
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::erase(const size_t index) noexcept
+{
+    if (index >= mySize) { return false; }
+
+    // Shift the subsequent values one step forward, then destroy the last value.
+    for (size_t i{index}; i + 1U < mySize; ++i) { myData[i] = utils::move(myData[i + 1U]); }
+    return popBack();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::copy(const StaticVector<T, Capacity>& other) noexcept
+{
+    // Store the size of the other vector up front, since the vectors may be the same.
+    const auto count{other.mySize};
+    if (mySize + count > Capacity) { return false; }
+    for (size_t i{}; i < count; ++i) { utils::construct(myData + mySize++, other.myData[i]); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::move(StaticVector<T, Capacity>& other) noexcept
+{
+    for (size_t i{}; i < other.mySize; ++i)
+    {
+        utils::construct(myData + i, utils::move(other.myData[i]));
+    }
+    mySize = other.mySize;
+    other.clear();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <size_t ValueCount>
+bool StaticVector<T, Capacity>::addValues(const T (&values)[ValueCount]) noexcept
+{
+    static_assert(ValueCount <= Capacity, "Too many values for static vector!");
+    if (mySize + ValueCount > Capacity) { return false; }
+    for (size_t i{}; i < ValueCount; ++i) { utils::construct(myData + mySize++, values[i]); }
+    return true;
+}
+} // namespace container
@@ -10,23 +10,30 @@
 namespace container
 {
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector() noexcept
+template <typename T, typename Allocator>
+Vector<T, Allocator>::Vector() noexcept
+    : Vector(memory::defaultAllocator<Allocator>()) {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+Vector<T, Allocator>::Vector(Allocator& allocator) noexcept
     : myData{nullptr}
-    , mySize{} {}
+    , mySize{}
+    , myCapacity{}
+    , myAllocator{&allocator} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(const size_t size) noexcept
+template <typename T, typename Allocator>
+Vector<T, Allocator>::Vector(const size_t size) noexcept
     : Vector() 
 { 
     resize(size); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Values>
-Vector<T>::Vector(const Values&&... values) noexcept
+Vector<T, Allocator>::Vector(const Values&&... values) noexcept
     : Vector()
 {
     const T array[sizeof...(values)]{(values)...};
@@ -34,34 +41,36 @@ Vector<T>::Vector(const Values&&... values) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(const Vector<T>& other) noexcept
-    : Vector()
+template <typename T, typename Allocator>
+Vector<T, Allocator>::Vector(const Vector<T, Allocator>& other) noexcept
+    : Vector(*other.myAllocator)
 { 
     copy(other); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::Vector(Vector&& other) noexcept
-    : Vector()
+template <typename T, typename Allocator>
+Vector<T, Allocator>::Vector(Vector&& other) noexcept
+    : Vector(*other.myAllocator)
 {
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    myData           = other.myData;
+    mySize           = other.mySize;
+    myCapacity       = other.myCapacity;
+    other.myData     = nullptr;
+    other.mySize     = 0U;
+    other.myCapacity = 0U;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>::~Vector() noexcept 
+template <typename T, typename Allocator>
+Vector<T, Allocator>::~Vector() noexcept 
 { 
     clear(); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& other) noexcept
+template <typename T, typename Allocator>
+Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector<T, Allocator>& other) noexcept
 {
     clear();
     copy(other);
@@ -69,21 +78,24 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept
+template <typename T, typename Allocator>
+Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector<T, Allocator>&& other) noexcept
 {
     clear();
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    myData           = other.myData;
+    mySize           = other.mySize;
+    myCapacity       = other.myCapacity;
+    myAllocator      = other.myAllocator;
+    other.myData     = nullptr;
+    other.mySize     = 0U;
+    other.myCapacity = 0U;
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Values>
-Vector<T>& Vector<T>::operator=(const Values&&... values) noexcept
+Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Values&&... values) noexcept
 {
     clear();
     copy(values...);
@@ -91,201 +103,310 @@ Vector<T>& Vector<T>::operator=(const Values&&... values) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-Vector<T>& Vector<T>::operator+=(const Vector<T>& other) noexcept 
+template <typename T, typename Allocator>
+Vector<T, Allocator>& Vector<T, Allocator>::operator+=(const Vector<T, Allocator>& other) noexcept 
 { 
     addValues(other); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-Vector<T>& Vector<T>::operator+=(const T (&values)[ValueCount]) noexcept 
+Vector<T, Allocator>& Vector<T, Allocator>::operator+=(const T (&values)[ValueCount]) noexcept 
 { 
     addValues(values); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& Vector<T>::operator[](const size_t index) noexcept 
+template <typename T, typename Allocator>
+T& Vector<T, Allocator>::operator[](const size_t index) noexcept 
 { 
     return myData[index]; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& Vector<T>::operator[](const size_t index) const noexcept 
+template <typename T, typename Allocator>
+const T& Vector<T, Allocator>::operator[](const size_t index) const noexcept 
 { 
     return myData[index]; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::data() const noexcept { return myData; }
+template <typename T, typename Allocator>
+const T* Vector<T, Allocator>::data() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t Vector<T>::size() const noexcept { return mySize; }
+template <typename T, typename Allocator>
+size_t Vector<T, Allocator>::size() const noexcept { return mySize; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::empty() const noexcept { return mySize == 0U; }
+template <typename T, typename Allocator>
+size_t Vector<T, Allocator>::capacity() const noexcept { return myCapacity; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::begin() noexcept { return Iterator{myData}; }
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::Iterator Vector<T, Allocator>::begin() noexcept
+{
+    return Iterator{myData};
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::begin() const noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::begin() const noexcept 
 { 
     return ConstIterator{myData};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::end() noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::Iterator Vector<T, Allocator>::end() noexcept 
 { 
     return Iterator{myData + mySize}; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::end() const noexcept  
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::end() const noexcept  
 { 
     return ConstIterator{myData + mySize};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::rbegin() noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::Iterator Vector<T, Allocator>::rbegin() noexcept 
 { 
     return mySize > 0U ? Iterator{myData + mySize - 1U} : Iterator{nullptr}; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::rbegin() const noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::rbegin() const noexcept 
 { 
     return mySize > 0U ? ConstIterator{myData + mySize - 1U} : ConstIterator{nullptr}; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::Iterator Vector<T>::rend() noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::Iterator Vector<T, Allocator>::rend() noexcept 
 { 
     return mySize > 0U ? Iterator{myData - 1U} : Iterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename Vector<T>::ConstIterator Vector<T>::rend() const noexcept 
+template <typename T, typename Allocator>
+typename Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::rend() const noexcept 
 { 
     return mySize > 0U ? ConstIterator{myData - 1U} : ConstIterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* Vector<T>::last() noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+template <typename T, typename Allocator>
+T* Vector<T, Allocator>::last() noexcept { return mySize > 0U ? myData + mySize - 1U : nullptr; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* Vector<T>::last() const noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+template <typename T, typename Allocator>
+const T* Vector<T, Allocator>::last() const noexcept 
+{ 
+    return mySize > 0U ? myData + mySize - 1U : nullptr; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::clear() noexcept 
+template <typename T, typename Allocator>
+void Vector<T, Allocator>::clear() noexcept 
 {
-    utils::deleteMemory<T>(myData);
-    myData = nullptr;
-    mySize = 0U;
+    for (size_t i{}; i < mySize; ++i) { utils::destroy(myData + i); }
+    myAllocator->deallocate(myData);
+    myData     = nullptr;
+    mySize     = 0U;
+    myCapacity = 0U;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::resize(const size_t newSize) noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::resize(const size_t newSize) noexcept 
 {
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
-    if (copy == nullptr) { return false; }
-    myData = copy;
+    if (!reserve(newSize)) { return false; }
+    for (size_t i{newSize}; i < mySize; ++i) { utils::destroy(myData + i); }
+    for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
     mySize = newSize;
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::pushBack(const T& value) noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::reserve(const size_t newCapacity) noexcept 
 {
-    if (!resize(mySize + 1U)) { return false; }
-    myData[mySize - 1U] = value;
-    return true;
+    return newCapacity <= myCapacity ? true : reallocate(newCapacity);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::popBack() noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::shrinkToFit() noexcept 
 {
-    if (mySize <= 1U) 
+    if (mySize == myCapacity) { return true; }
+
+    if (mySize == 0U)
     {
         clear();
         return true;
-    } 
-    else 
-    {
-        return resize(mySize - 1U);
     }
+    return reallocate(mySize);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::copy(const Vector<T>& other) noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::pushBack(const T& value) noexcept 
 {
-    if (!resize(other.mySize)) { return false; }
-    assign(other);
-    return true;
+    return emplaceBack(value);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void Vector<T>::assign(const Vector<T>& other, const size_t offset) noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::pushBack(T&& value) noexcept 
 {
-    for (size_t i{}; offset + i < mySize && i < other.mySize; ++i) 
+    return emplaceBack(utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+bool Vector<T, Allocator>::emplaceBack(Args&&... args) noexcept 
+{
+    if (mySize == myCapacity)
     {
-        myData[offset + i] = other.myData[i];
+        // Create the value before growing, since the arguments may refer to elements of this
+        // vector, which are relocated during growth.
+        T value(utils::forward<Args>(args)...);
+        if (!grow(mySize + 1U)) { return false; }
+        utils::construct(myData + mySize++, utils::move(value));
     }
+    else { utils::construct(myData + mySize++, utils::forward<Args>(args)...); }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-template <size_t ValueCount>
-void Vector<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept 
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::popBack() noexcept 
+{
+    if (mySize == 0U) { return false; }
+    utils::destroy(myData + --mySize);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::insert(const size_t index, const T& value) noexcept 
 {
-    for (size_t i{}; i < ValueCount && offset + i < mySize; ++i) 
+    // Copy the value first, since it may refer to an element of this vector.
+    return insert(index, T{value});
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::insert(const size_t index, T&& value) noexcept 
+{
+    if (index > mySize) { return false; }
+    if (index == mySize) { return emplaceBack(utils::move(value)); }
+    if ((mySize == myCapacity) && !grow(mySize + 1U)) { return false; }
+
+    // Shift the subsequent values one step back, then move the value into place.
+    utils::construct(myData + mySize, utils::move(myData[mySize - 1U]));
+    for (size_t i{mySize - 1U}; i > index; --i) { myData[i] = utils::move(myData[i - 1U]); }
+    myData[index] = utils::move(value);
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::erase(const size_t index) noexcept 
+{
+    if (index >= mySize) { return false; }
+
+    // Shift the subsequent values one step forward, then destroy the last value.
+    for (size_t i{index}; i + 1U < mySize; ++i) { myData[i] = utils::move(myData[i + 1U]); }
+    return popBack();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::copy(const Vector<T, Allocator>& other) noexcept 
+{
+    // Store the size of the other vector up front, since the vectors may be the same.
+    const auto count{other.mySize};
+    if (!reserve(mySize + count)) { return false; }
+    for (size_t i{}; i < count; ++i) { utils::construct(myData + mySize++, other.myData[i]); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::reallocate(const size_t newCapacity) noexcept 
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        // Trivially copyable elements can be relocated by the allocator, possibly in place.
+        auto copy{static_cast<T*>(myAllocator->reallocate(myData, sizeof(T) * mySize, 
+                                                          sizeof(T) * newCapacity))};
+        if (copy == nullptr) { return false; }
+        myData = copy;
+    }
+    else
     {
-        myData[offset + i] = values[i];
+        // Move the elements to the new block, then destroy the moved-from elements.
+        auto copy{static_cast<T*>(myAllocator->allocate(sizeof(T) * newCapacity))};
+        if (copy == nullptr) { return false; }
+
+        for (size_t i{}; i < mySize; ++i)
+        {
+            utils::construct(copy + i, utils::move(myData[i]));
+            utils::destroy(myData + i);
+        }
+        myAllocator->deallocate(myData);
+        myData = copy;
     }
+    myCapacity = newCapacity;
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool Vector<T>::addValues(const Vector<T>& other) noexcept 
+template <typename T, typename Allocator>
+Allocator& Vector<T, Allocator>::allocator() const noexcept { return *myAllocator; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::grow(const size_t minCapacity) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + other.mySize)) { return false; }
-    assign(other, offset);
-    return true;
+    // Grow by 50 % rather than doubling, which keeps the overhead low on a small heap.
+    auto newCapacity{myCapacity + myCapacity / 2U};
+    if (newCapacity < MinCapacity) { newCapacity = MinCapacity; }
+    if (newCapacity < minCapacity) { newCapacity = minCapacity; }
+
+    // Fall back to the minimum capacity if the allocator can't hold the geometric growth.
+    return reallocate(newCapacity) || ((newCapacity > minCapacity) && reallocate(minCapacity));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool Vector<T, Allocator>::addValues(const Vector<T, Allocator>& other) noexcept 
+{
+    if ((mySize + other.mySize > myCapacity) && !grow(mySize + other.mySize)) { return false; }
+    return copy(other);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-bool Vector<T>::addValues(const T (&values)[ValueCount]) noexcept 
+bool Vector<T, Allocator>::addValues(const T (&values)[ValueCount]) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + ValueCount)) { return false; }
-    assign(values, offset);
+    if ((mySize + ValueCount > myCapacity) && !grow(mySize + ValueCount)) { return false; }
+    for (size_t i{}; i < ValueCount; ++i) { utils::construct(myData + mySize++, values[i]); }
     return true;
 }
 } // namespace container
@@ -10,10 +10,11 @@ namespace container
 /**
  * @brief Implementation of mutable list iterators.
  *
- * @tparam T The list type.
+ * @tparam T         The list type.
+ * @tparam Allocator The node allocator of the list.
  */
-template <typename T>
-class List<T>::Iterator final
+template <typename T, typename Allocator>
+class List<T, Allocator>::Iterator final
 {
 public:
     /**
@@ -195,7 +196,7 @@ public:
      * @brief Get the address of the node the iterator is pointing at. 
      * 
      * @note A void pointer is returned to keep information about nodes 
-     *       private within the List<T> class.
+     *       private within the List<T, Allocator> class.
      *
      * @return Pointer to the node the iterator is pointing at.
      */
@@ -208,10 +209,11 @@ private:
 /**
  * @brief Implementation of constant list iterators.
  *
- * @tparam T The list type.
+ * @tparam T         The list type.
+ * @tparam Allocator The node allocator of the list.
  */
-template <typename T>
-class List<T>::ConstIterator 
+template <typename T, typename Allocator>
+class List<T, Allocator>::ConstIterator 
 {
 public:
     /**
@@ -386,7 +388,7 @@ public:
      * @brief Get the address of the node the iterator is pointing at. 
      * 
      * @note A void pointer is returned to keep information about nodes 
-     *       private within the List<T> class.
+     *       private within the List<T, Allocator> class.
      *
      * @return Pointer to the node the iterator is pointing at.
      */
@@ -0,0 +1,280 @@
+/**
+ * @brief Implementation of ring buffer iterators.
+ *
+ * @note This file is included in <ring_buffer.h> and shall not be included directly.
+ */
+#pragma once
+
+namespace container
+{
+/**
+ * @brief Implementation of mutable ring buffer iterators.
+ *
+ *        The iterator refers to a position of the ring buffer by its free-running index,
+ *        i.e. iterating wraps around the end of the underlying buffer.
+ *
+ * @tparam T    The value type.
+ * @tparam Size The buffer size.
+ */
+template <typename T, size_t Size>
+class RingBuffer<T, Size>::Iterator final
+{
+public:
+    /**
+     * @brief Create empty iterator.
+     */
+    Iterator() noexcept
+        : myData{nullptr}
+        , myIndex{} {}
+
+    /**
+     * @brief Create iterator pointing at given position of a ring buffer.
+     *
+     * @param[in] data  Pointer to the buffer of the ring buffer.
+     * @param[in] index The free-running index of the position.
+     */
+    Iterator(T* data, const uint8_t index) noexcept
+        : myData{data}
+        , myIndex{index} {}
+
+    /**
+     * @brief Increment the position the iterator is pointing at (prefix operator).
+     *
+     * @return Reference to this iterator.
+     */
+    Iterator& operator++() noexcept
+    {
+        ++myIndex;
+        return *this;
+    }
+
+    /**
+     * @brief Decrement the position the iterator is pointing at (prefix operator).
+     *
+     * @return Reference to this iterator.
+     */
+    Iterator& operator--() noexcept
+    {
+        --myIndex;
+        return *this;
+    }
+
+    /**
+     * @brief Increment the position the iterator is pointing at (postfix operator).
+     *
+     * @return The previous state of this iterator.
+     */
+    Iterator operator++(int) noexcept
+    {
+        auto previous{*this};
+        ++myIndex;
+        return previous;
+    }
+
+    /**
+     * @brief Decrement the position the iterator is pointing at (postfix operator).
+     *
+     * @return The previous state of this iterator.
+     */
+    Iterator operator--(int) noexcept
+    {
+        auto previous{*this};
+        --myIndex;
+        return previous;
+    }
+
+    /**
+     * @brief Increment the iterator given number of times.
+     *
+     * @param[in] incrementCount The number of times the iterator will be incremented.
+     */
+    void operator+=(const size_t incrementCount) noexcept
+    {
+        myIndex = static_cast<uint8_t>(myIndex + incrementCount);
+    }
+
+    /**
+     * @brief Decrement the iterator given number of times.
+     *
+     * @param[in] decrementCount The number of times the iterator will be decremented.
+     */
+    void operator-=(const size_t decrementCount) noexcept
+    {
+        myIndex = static_cast<uint8_t>(myIndex - decrementCount);
+    }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at the same position.
+     *
+     * @param[in] other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same position, false otherwise.
+     */
+    bool operator==(const Iterator& other) const noexcept
+    {
+        return (myData == other.myData) && (myIndex == other.myIndex);
+    }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at different positions.
+     *
+     * @param[in] other Reference to other iterator.
+     *
+     * @return True if the iterators point at different positions, false otherwise.
+     */
+    bool operator!=(const Iterator& other) const noexcept { return !(*this == other); }
+
+    /**
+     * @brief Get the value the iterator is pointing at.
+     *
+     * @return Reference to the value the iterator is pointing at.
+     */
+    T& operator*() noexcept { return myData[myIndex & IndexMask]; }
+
+    /**
+     * @brief Get the value the iterator is pointing at.
+     *
+     * @return Reference to the value the iterator is pointing at.
+     */
+    const T& operator*() const noexcept { return myData[myIndex & IndexMask]; }
+
+private:
+    /** Pointer to the buffer of the ring buffer. */
+    T* myData;
+
+    /** The free-running index of the position the iterator is pointing at. */
+    uint8_t myIndex;
+};
+
+/**
+ * @brief Implementation of constant ring buffer iterators.
+ *
+ *        The iterator refers to a position of the ring buffer by its free-running index,
+ *        i.e. iterating wraps around the end of the underlying buffer.
+ *
+ * @tparam T    The value type.
+ * @tparam Size The buffer size.
+ */
+template <typename T, size_t Size>
+class RingBuffer<T, Size>::ConstIterator final
+{
+public:
+    /**
+     * @brief Create empty iterator.
+     */
+    ConstIterator() noexcept
+        : myData{nullptr}
+        , myIndex{} {}
+
+    /**
+     * @brief Create iterator pointing at given position of a ring buffer.
+     *
+     * @param[in] data  Pointer to the buffer of the ring buffer.
+     * @param[in] index The free-running index of the position.
+     */
+    ConstIterator(const T* data, const uint8_t index) noexcept
+        : myData{data}
+        , myIndex{index} {}
+
+    /**
+     * @brief Increment the position the iterator is pointing at (prefix operator).
+     *
+     * @return Reference to this iterator.
+     */
+    ConstIterator& operator++() noexcept
+    {
+        ++myIndex;
+        return *this;
+    }
+
+    /**
+     * @brief Decrement the position the iterator is pointing at (prefix operator).
+     *
+     * @return Reference to this iterator.
+     */
+    ConstIterator& operator--() noexcept
+    {
+        --myIndex;
+        return *this;
+    }
+
+    /**
+     * @brief Increment the position the iterator is pointing at (postfix operator).
+     *
+     * @return The previous state of this iterator.
+     */
+    ConstIterator operator++(int) noexcept
+    {
+        auto previous{*this};
+        ++myIndex;
+        return previous;
+    }
+
+    /**
+     * @brief Decrement the position the iterator is pointing at (postfix operator).
+     *
+     * @return The previous state of this iterator.
+     */
+    ConstIterator operator--(int) noexcept
+    {
+        auto previous{*this};
+        --myIndex;
+        return previous;
+    }
+
+    /**
+     * @brief Increment the iterator given number of times.
+     *
+     * @param[in] incrementCount The number of times the iterator will be incremented.
+     */
+    void operator+=(const size_t incrementCount) noexcept
+    {
+        myIndex = static_cast<uint8_t>(myIndex + incrementCount);
+    }
+
+    /**
+     * @brief Decrement the iterator given number of times.
+     *
+     * @param[in] decrementCount The number of times the iterator will be decremented.
+     */
+    void operator-=(const size_t decrementCount) noexcept
+    {
+        myIndex = static_cast<uint8_t>(myIndex - decrementCount);
+    }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at the same position.
+     *
+     * @param[in] other Reference to other iterator.
+     *
+     * @return True if the iterators point at the same position, false otherwise.
+     */
+    bool operator==(const ConstIterator& other) const noexcept
+    {
+        return (myData == other.myData) && (myIndex == other.myIndex);
+    }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at different positions.
+     *
+     * @param[in] other Reference to other iterator.
+     *
+     * @return True if the iterators point at different positions, false otherwise.
+     */
+    bool operator!=(const ConstIterator& other) const noexcept { return !(*this == other); }
+
+    /**
+     * @brief Get the value the iterator is pointing at.
+     *
+     * @return Reference to the value the iterator is pointing at.
+     */
+    const T& operator*() const noexcept { return myData[myIndex & IndexMask]; }
+
+private:
+    /** Pointer to the buffer of the ring buffer. */
+    const T* myData;
+
+    /** The free-running index of the position the iterator is pointing at. */
+    uint8_t myIndex;
+};
+} // namespace container
@@ -10,10 +10,11 @@ namespace container
 /**
  * @brief Implementation of mutable vector iterators.
  *
- * @tparam T The vector type.
+ * @tparam T         The vector type.
+ * @tparam Allocator The allocator of the vector.
  */
-template <typename T>
-class Vector<T>::Iterator final
+template <typename T, typename Allocator>
+class Vector<T, Allocator>::Iterator final
 {
 public:
     /**
@@ -242,10 +243,11 @@ private:
 /**
  * @brief Implementation of constant vector iterators.
  *
- * @tparam T The vector type.
+ * @tparam T         The vector type.
+ * @tparam Allocator The allocator of the vector.
  */
-template <typename T>
-class Vector<T>::ConstIterator
+template <typename T, typename Allocator>
+class Vector<T, Allocator>::ConstIterator
 {
 public:
     /**
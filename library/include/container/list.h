@@ -5,14 +5,21 @@
 
 #include <stddef.h>
 
+#include "memory/heap_allocator.h"
+
 namespace container 
 {
 /**
  * @brief Class for implementation of doubly linked lists.
  * 
- * @tparam T The list type.
+ *        Nodes are allocated by the given allocator, which must provide
+ *        void* allocate(size_t size) and void deallocate(void* block). Lists created without
+ *        an allocator instance share one instance per allocator type, e.g. one static pool.
+ * 
+ * @tparam T         The list type.
+ * @tparam Allocator The node allocator (default = heap).
  */
-template <typename T>
+template <typename T, typename Allocator = memory::HeapAllocator>
 class List
 {        
 public:
@@ -27,6 +34,13 @@ public:
      */
     explicit List() noexcept;
 
+    /**
+     * @brief Create empty list allocating nodes with given allocator.
+     *
+     * @param[in] allocator Reference to the node allocator, which must outlive the list.
+     */
+    explicit List(Allocator& allocator) noexcept;
+
     /**
      * @brief Create list of given size initialized with given start value.
      *
@@ -51,20 +65,21 @@ public:
     ~List() noexcept;
 
     /**
-     * @brief Create list as a copy of another list.
+     * @brief Create list as a copy of another list, using the same allocator.
      *
      * @param[in] other Reference to other list to copy from.
      */
-    List(const List<T>& other) noexcept;
+    List(const List& other) noexcept;
 
     /**
      * @brief Move memory from another list.
      * 
-     *        The other list is emptied once the move operation is completed.
+     *        The other list is emptied once the move operation is completed. The allocator
+     *        of the other list is used by this list from now on.
      *
      * @param[in] other Reference to other list to move memory from.
      */
-    List(List<T>&& other) noexcept;
+    List(List&& other) noexcept;
 
      /**
      * @brief Copy the content of list to assigned list. 
@@ -75,12 +90,13 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(const List<T>& other) noexcept;
+    List& operator=(const List& other) noexcept;
 
     /**
      * @brief Move the content from other list.
      * 
-     *        Previous values are cleared before copying.
+     *        Previous values are cleared before copying. The allocator of the other list
+     *        is used by this list from now on.
      * 
      *        The other list is emptied once the move operation is completed.
      *
@@ -88,7 +104,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(List<T>&& other) noexcept;
+    List& operator=(List&& other) noexcept;
 
     /**
      * @brief Add values from another list.
@@ -97,7 +113,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator+=(const List<T>& other) noexcept;
+    List& operator+=(const List& other) noexcept;
 
     /**
      * @brief Push values to the back of list.
@@ -109,7 +125,7 @@ public:
      * @return Reference to this list.
      */
     template <size_t ValueCount>
-    List<T>& operator+=(const T (&values)[ValueCount]) noexcept;
+    List& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get reference to the value at given position in the list.
@@ -223,6 +239,15 @@ public:
      */
     bool pushFront(const T& value) noexcept;
 
+    /**
+     * @brief Move value to the front of list.
+     *
+     * @param[in] value Reference to the value to move.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    bool pushFront(T&& value) noexcept;
+
     /**
      * @brief Insert value at the back of list.
      *
@@ -232,10 +257,44 @@ public:
      */
     bool pushBack(const T& value) noexcept;
 
+    /**
+     * @brief Move value to the back of list.
+     *
+     * @param[in] value Reference to the value to move.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct value in place at the front of list.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceFront(Args&&... args) noexcept;
+
+    /**
+     * @brief Construct value in place at the back of list.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
     /**
      * @brief Insert value at given position in the list.
      *
      * @param[in] iterator Reference to iterator pointing at the location to place the new value.
+     *                     The new value is placed before the value the iterator is pointing at.
      * @param[in] value    Reference to the value to add.
      * 
      * @return True if the value was added, false otherwise.
@@ -255,22 +314,43 @@ public:
     /**
      * @brief Remove value at given position in the list.
      *
-     * @param[in] iterator Reference to iterator pointing at the value to remove.
+     * @param[in] iterator Reference to iterator pointing at the value to remove. The iterator
+     *                     is set to point at the next value once the value is removed.
      *
      * @return True if the value was removed, false otherwise.
      */
     bool remove(Iterator& iterator) noexcept;
 
+    /**
+     * @brief Get the allocator of the list.
+     *
+     * @return Reference to the node allocator.
+     */
+    Allocator& allocator() const noexcept;
+
+    /**
+     * @brief Get the size of each node, i.e. the block size required by node allocators.
+     *
+     *        The node size doesn't depend on the allocator, so List<T>::nodeSize() can be used
+     *        to size a pool for List<T, Pool>.
+     *
+     * @return The node size in bytes.
+     */
+    static constexpr size_t nodeSize() noexcept;
+
 protected:
     /** Node holding data stored in the list. */
     struct Node;
 
-    bool copy(const List<T>& other) noexcept;
-    template <size_t ValueCount>
-    void assign(const T (&values)[ValueCount], size_t offset = 0U) noexcept;
+    bool copy(const List& other) noexcept;
     template <size_t ValueCount>
     bool addValues(const T (&values)[ValueCount]) noexcept;
+    void link(Node* node, Node* next) noexcept;
+    void unlink(Node* node) noexcept;
     void removeAllNodes() noexcept;
+    template <typename... Args>
+    Node* createNode(Args&&... args) noexcept;
+    void destroyNode(Node* node) noexcept;
 
     /** Pointer to the first node of the list. */
     Node* myFirst;
@@ -280,6 +360,9 @@ protected:
 
     /** The size of the list in number of nodes. */
     size_t mySize;
+
+    /** Pointer to the node allocator. */
+    Allocator* myAllocator;
 };
 } // namespace container
 
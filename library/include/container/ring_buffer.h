@@ -0,0 +1,202 @@
+/**
+ * @brief Implementation of lock-free ring buffers of any type.
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace container 
+{
+/**
+ * @brief Class for implementation of lock-free single-producer/single-consumer ring buffers.
+ * 
+ *        One producer, for instance an interrupt handler, can push values while one consumer, 
+ *        for instance the main loop, pops them without disabling interrupts. The indexes 
+ *        are free-running 8-bit values, which are read and written atomically on AVR.
+ * 
+ *        Values can be pushed and popped one at a time or in bulk, where a bulk operation
+ *        copies the values in at most two contiguous chunks and publishes them at once.
+ * 
+ *        Iterators traverse the values from the front to the back of the ring buffer and 
+ *        shall only be used by the consumer. Values pushed after begin() or end() was called
+ *        aren't covered by the iteration.
+ * 
+ * @tparam T    The value type.
+ * @tparam Size The buffer size. Must be a power of two in the range [1, 128].
+ */
+template <typename T, size_t Size>
+class RingBuffer
+{
+    // Generate a compiler error if the buffer size can't be indexed with free-running 
+    // 8-bit indexes.
+    static_assert((0U < Size) && (128U >= Size) && (0U == (Size & (Size - 1U))),
+                  "Ring buffer size must be a power of two in the range [1, 128]!");
+
+public:
+    /** Ring buffer iterator. */
+    class Iterator;
+
+    /** Constant ring buffer iterator. */
+    class ConstIterator;
+
+    /**
+     * @brief Create empty ring buffer.
+     */
+    RingBuffer() noexcept;
+
+    /**
+     * @brief Delete ring buffer.
+     */
+    ~RingBuffer() noexcept = default;
+
+    /**
+     * @brief Push value to the back of the ring buffer. Only call from the producer.
+     * 
+     * @param[in] value The value to push.
+     * 
+     * @return True if the value was pushed, false if the ring buffer is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Pop value from the front of the ring buffer. Only call from the consumer.
+     * 
+     * @param[out] value Reference to variable to store the popped value.
+     * 
+     * @return True if a value was popped, false if the ring buffer is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Push values to the back of the ring buffer. Only call from the producer.
+     * 
+     *        As many values as there is space for are pushed.
+     * 
+     * @param[in] values Pointer to the values to push.
+     * @param[in] count  The number of values to push.
+     * 
+     * @return The number of values pushed.
+     */
+    size_t push(const T* values, size_t count) noexcept;
+
+    /**
+     * @brief Pop values from the front of the ring buffer. Only call from the consumer.
+     * 
+     * @param[out] values   Pointer to buffer to store the popped values.
+     * @param[in]  maxCount The max number of values to pop, i.e. the size of the buffer.
+     * 
+     * @return The number of values popped.
+     */
+    size_t pop(T* values, size_t maxCount) noexcept;
+
+    /**
+     * @brief Push referenced values to the back of the ring buffer. Only call from the producer.
+     * 
+     *        As many values as there is space for are pushed.
+     * 
+     * @tparam ValueCount The number of values to push.
+     * 
+     * @param[in] values Reference to the values to push.
+     * 
+     * @return The number of values pushed.
+     */
+    template <size_t ValueCount>
+    size_t push(const T (&values)[ValueCount]) noexcept;
+
+    /**
+     * @brief Pop values from the front of the ring buffer. Only call from the consumer.
+     * 
+     * @tparam ValueCount The max number of values to pop.
+     * 
+     * @param[out] values Reference to buffer to store the popped values.
+     * 
+     * @return The number of values popped.
+     */
+    template <size_t ValueCount>
+    size_t pop(T (&values)[ValueCount]) noexcept;
+
+    /**
+     * @brief Get the number of values in the ring buffer.
+     * 
+     * @return The number of values in the ring buffer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of the ring buffer.
+     * 
+     * @return The max number of values the ring buffer can hold.
+     */
+    static constexpr size_t capacity() noexcept { return Size; }
+
+    /**
+     * @brief Check whether the ring buffer is empty.
+     * 
+     * @return True if the ring buffer is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check whether the ring buffer is full.
+     * 
+     * @return True if the ring buffer is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Get the front of the ring buffer. Only call from the consumer.
+     * 
+     * @return Iterator pointing at the front of the ring buffer.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the front of the ring buffer. Only call from the consumer.
+     * 
+     * @return Iterator pointing at the front of the ring buffer.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of the ring buffer. Only call from the consumer.
+     * 
+     * @return Iterator pointing just past the back of the ring buffer.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of the ring buffer. Only call from the consumer.
+     * 
+     * @return Iterator pointing just past the back of the ring buffer.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Clear ring buffer content. Only call from the consumer.
+     */
+    void clear() noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete; // No copy constructor.
+    RingBuffer(RingBuffer&&)                 = delete; // No move constructor.
+    RingBuffer& operator=(const RingBuffer&) = delete; // No copy assignment.
+    RingBuffer& operator=(RingBuffer&&)      = delete; // No move assignment.
+
+private:
+    /** Mask used to wrap indexes. */
+    static constexpr uint8_t IndexMask{Size - 1U};
+
+    static void copy(const T* source, T* destination, size_t count) noexcept;
+
+    /** Buffer holding the values. */
+    T myData[Size];
+
+    /** Index of the next free position, only written by the producer. */
+    uint8_t myHead;
+
+    /** Index of the next value to pop, only written by the consumer. */
+    uint8_t myTail;
+};
+} // namespace container
+
+#include "impl/ring_buffer_impl.h"
+#include "iterator/ring_buffer_iterator.h"
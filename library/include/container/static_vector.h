@@ -0,0 +1,373 @@
+/**
+ * @brief Implementation of vectors of any type with static capacity.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/vector.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of vectors with static capacity.
+ *
+ *        The vector holds up to Capacity elements stored inline, i.e. no heap memory is used,
+ *        which makes the memory usage deterministic. The vector provides the same interface
+ *        and iterators as container::Vector, enabling the two to be used interchangeably.
+ *        Pushing values to a full vector fails, while exceeding the capacity with values
+ *        known at compile time generates a compiler error.
+ *
+ *        Elements are constructed in place and destroyed when removed.
+ *
+ * @tparam T The vector type.
+ * @tparam Capacity The maximum number of elements the vector can hold.
+ */
+template <typename T, size_t Capacity>
+class StaticVector
+{
+    // Generate a compiler error if the capacity is set to 0.
+    static_assert(Capacity > 0U, "Static vector capacity must be greater than 0!");
+
+public:
+    /** Static vector iterator. */
+    using Iterator = typename Vector<T>::Iterator;
+
+    /** Constant static vector iterator. */
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Create empty vector.
+     */
+    StaticVector() noexcept;
+
+    /**
+     * @brief Create vector of given size.
+     *
+     *        The vector is left empty if the size exceeds the capacity.
+     *
+     * @param[in] size The size of vector, i.e. the number of elements it holds.
+     */
+    explicit StaticVector(size_t size) noexcept;
+
+    /**
+     * @brief Create vector containing given values.
+     *
+     * @tparam Values Parameter pack containing values, must not exceed the capacity.
+     *
+     * @param[in] values The values to add to the vector.
+     */
+    template <typename... Values>
+    explicit StaticVector(const Values&&... values) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    StaticVector(const StaticVector<T, Capacity>& other) noexcept;
+
+    /**
+     * @brief Move the elements of another vector.
+     *
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to other vector to move the elements from.
+     */
+    StaticVector(StaticVector<T, Capacity>&& other) noexcept;
+
+    /**
+     * @brief Delete vector.
+     */
+    ~StaticVector() noexcept;
+
+    /**
+     * @brief Copy the content of vector to assigned vector.
+     *
+     *        Previous values are cleared before copying.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    StaticVector<T, Capacity>& operator=(const StaticVector<T, Capacity>& other) noexcept;
+
+    /**
+     * @brief Move the content from other vector.
+     *
+     *        Previous values are cleared before moving.
+     *
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to vector holding the data to move.
+     *
+     * @return Reference to this vector.
+     */
+    StaticVector<T, Capacity>& operator=(StaticVector<T, Capacity>&& other) noexcept;
+
+    /**
+     * @brief Add values from another vector.
+     *
+     *        No values are added if the capacity is insufficient.
+     *
+     * @param[in] other Reference to vector holding the values to add.
+     *
+     * @return Reference to this vector.
+     */
+    StaticVector<T, Capacity>& operator+=(const StaticVector<T, Capacity>& other) noexcept;
+
+    /**
+     * @brief Push referenced values to the back of vector.
+     *
+     *        No values are added if the capacity is insufficient.
+     *
+     * @tparam ValueCount The number of values to add, must not exceed the capacity.
+     *
+     * @param[in] values Reference to the values to add.
+     *
+     * @return Reference to this vector.
+     */
+    template <size_t ValueCount>
+    StaticVector<T, Capacity>& operator+=(const T (&values)[ValueCount]) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    T& operator[](size_t index) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    const T& operator[](size_t index) const noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    const T* data() const noexcept;
+
+    /**
+     * @brief Get the size of vector in the number of elements it holds.
+     *
+     * @return The size of vector as an unsigned integer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of vector in the number of elements it can hold.
+     *
+     * @return The capacity of vector as an unsigned integer.
+     */
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+    /**
+     * @brief Check if the vector is empty.
+     *
+     * @return True if the vector is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the vector is full.
+     *
+     * @return True if the vector is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the reverse beginning of the vector.
+     *
+     * @return Iterator pointing at the reverse beginning of the vector.
+     */
+    Iterator rbegin() noexcept;
+
+    /**
+     * @brief Get the reverse beginning of the vector.
+     *
+     * @return Iterator pointing at the reverse beginning of the vector.
+     */
+    ConstIterator rbegin() const noexcept;
+
+    /**
+     * @brief Get the reverse end of the vector.
+     *
+     * @return Iterator pointing at the reverse end of the vector.
+     */
+    Iterator rend() noexcept;
+
+    /**
+     * @brief Get the reverse end of vector.
+     *
+     * @return Iterator pointing at the reverse end of the vector.
+     */
+    ConstIterator rend() const noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector, or nullptr if the vector is empty.
+     */
+    T* last() noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector, or nullptr if the vector is empty.
+     */
+    const T* last() const noexcept;
+
+    /**
+     * @brief Clear content of vector.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Resize the vector to given new size.
+     *
+     * @param[in] newSize The new size of vector.
+     *
+     * @return True if the vector was resized, false if the new size exceeds the capacity.
+     */
+    bool resize(size_t newSize) noexcept;
+
+    /**
+     * @brief Check that the vector can hold given number of elements.
+     *
+     *        Provided for compatibility with container::Vector, no memory is allocated.
+     *
+     * @param[in] newCapacity The requested capacity of vector.
+     *
+     * @return True if the capacity is at least the requested capacity, false otherwise.
+     */
+    bool reserve(size_t newCapacity) const noexcept;
+
+    /**
+     * @brief Provided for compatibility with container::Vector, the capacity is static.
+     *
+     * @return True always.
+     */
+    bool shrinkToFit() const noexcept;
+
+    /**
+     * @brief Push new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false if the vector is full.
+     */
+    bool pushBack(const T& value) noexcept;
+
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was moved to the back of vector, false if the vector is full.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value in place at the back of vector.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     *
+     * @param[in] args The arguments to pass to the constructor of T.
+     *
+     * @return True if the value was constructed at the back of vector, false if the vector
+     *         is full.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
+    /**
+     * @brief Pop value at the back of vector.
+     *
+     * @return True if the last value of vector was popped, false if the vector is empty.
+     */
+    bool popBack() noexcept;
+
+    /**
+     * @brief Insert value at given index, shifting subsequent values one step back.
+     *
+     * @param[in] index The index to insert the value at, at most the size of vector.
+     * @param[in] value Reference to the value to insert.
+     *
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(size_t index, const T& value) noexcept;
+
+    /**
+     * @brief Move value to given index, shifting subsequent values one step back.
+     *
+     * @param[in] index The index to insert the value at, at most the size of vector.
+     * @param[in] value Reference to the value to move.
+     *
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(size_t index, T&& value) noexcept;
+
+    /**
+     * @brief Erase value at given index, shifting subsequent values one step forward.
+     *
+     * @param[in] index The index of the value to erase.
+     *
+     * @return True if the value was erased, false if the index is out of range.
+     */
+    bool erase(size_t index) noexcept;
+
+protected:
+    bool copy(const StaticVector<T, Capacity>& other) noexcept;
+    void move(StaticVector<T, Capacity>& other) noexcept;
+
+    template <size_t ValueCount>
+    bool addValues(const T (&values)[ValueCount]) noexcept;
+
+    union
+    {
+        /** Inline field holding data, elements are constructed as they are added. */
+        T myData[Capacity];
+    };
+
+    /** The size of the vector in number of elements it holds. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/static_vector_impl.h"
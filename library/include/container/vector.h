@@ -5,25 +5,49 @@
 
 #include <stddef.h>
 
+#include "memory/heap_allocator.h"
+
 namespace container 
 {
 /**
  * @brief Class for implementation of dynamic vectors.
  * 
- * @tparam T The vector type.
+ *        The vector keeps track of its size and capacity separately. When pushing values to a
+ *        full vector, the capacity grows geometrically (by 50 %, at least to MinCapacity 
+ *        elements), making the amortized cost of pushBack() constant. Popping values never
+ *        releases memory, use shrinkToFit() to release unused capacity.
+ * 
+ *        Elements are constructed in place and destroyed when removed. On growth, trivially 
+ *        copyable elements are relocated via reallocation, other elements are moved.
+ * 
+ *        Memory is allocated by the given allocator. Vectors created without an allocator
+ *        instance share one instance per allocator type.
+ * 
+ * @tparam T         The vector type.
+ * @tparam Allocator The allocator (default = heap).
  */
-template <typename T>
+template <typename T, typename Allocator = memory::HeapAllocator>
 class Vector
 {
 public:
     class Iterator;      // Vector iterator.
     class ConstIterator; // Constant vector iterator.
 
+    /** The minimum capacity allocated when a push requires the vector to grow. */
+    static constexpr size_t MinCapacity{4U};
+
     /**
      * @brief Create empty vector.
      */
     Vector() noexcept;
 
+    /**
+     * @brief Create empty vector allocating memory with given allocator.
+     *
+     * @param[in] allocator Reference to the allocator, which must outlive the vector.
+     */
+    explicit Vector(Allocator& allocator) noexcept;
+
     /**
      * @brief Create vector of given size.
      *
@@ -42,16 +66,17 @@ public:
     explicit Vector(const Values&&... values) noexcept;
 
     /**
-     * @brief Create vector as a copy of another vector.
+     * @brief Create vector as a copy of another vector, using the same allocator.
      *
      * @param[in] other Reference to other vector to copy from.
      */
-    Vector(const Vector<T>& other) noexcept;
+    Vector(const Vector& other) noexcept;
 
     /**
      * @brief Move memory from another vector.
      * 
-     *        The other vector is emptied once the move operation is completed.
+     *        The other vector is emptied once the move operation is completed. The allocator
+     *        of the other vector is used by this vector from now on.
      *
      * @param[in] other Reference to other vector to move memory from.
      */
@@ -71,20 +96,21 @@ public:
      * 
      * @return Reference to this vector.
      */
-    Vector<T>& operator=(const Vector<T>& other) noexcept;
+    Vector& operator=(const Vector& other) noexcept;
 
     /**
      * @brief Move the content from other vector.
      * 
      *        Previous values are cleared before copying.
      * 
-     *        The other vector is emptied once the move operation is completed.
+     *        The other vector is emptied once the move operation is completed. The allocator
+     *        of the other vector is used by this vector from now on.
      *
      * @param[in] other Reference to vector holding the data to move. 
      * 
      * @return Reference to this vector.
      */
-    Vector<T>& operator=(Vector<T>&& other) noexcept;
+    Vector& operator=(Vector&& other) noexcept;
 
     /**
      * @brief Assign given values to vector.
@@ -98,7 +124,7 @@ public:
      * @return Reference to this vector.
      */
     template <typename... Values>
-    Vector<T>& operator=(const Values&&... values) noexcept;
+    Vector& operator=(const Values&&... values) noexcept;
 
     /**
      * @brief Add values from another vector.
@@ -107,7 +133,7 @@ public:
      * 
      * @return Reference to this vector.
      */
-    Vector<T>& operator+=(const Vector<T>& other) noexcept;
+    Vector& operator+=(const Vector& other) noexcept;
 
     /**
      * @brief Push referenced values to the back of vector.
@@ -119,7 +145,7 @@ public:
      * @return Reference to this vector.
      */
     template <size_t ValueCount>
-    Vector<T>& operator+=(const T (&values)[ValueCount]) noexcept;
+    Vector& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get element at given index in the vector.
@@ -147,12 +173,20 @@ public:
     const T* data() const noexcept;
 
     /**
-     * @brief Get the size of vector in the number of elements it can hold.
+     * @brief Get the size of vector in the number of elements it holds.
      *
      * @return The size of vector as an unsigned integer.
      */
     size_t size() const noexcept;
 
+    /**
+     * @brief Get the capacity of vector in the number of elements it can hold without 
+     *        reallocating memory.
+     *
+     * @return The capacity of vector as an unsigned integer.
+     */
+    size_t capacity() const noexcept;
+
     /**
      * @brief Check if the vector is empty.
      *
@@ -231,12 +265,15 @@ public:
     const T* last() const noexcept;
 
     /**
-     * @brief Clear content of vector.
+     * @brief Clear content of vector and release its memory.
      */
     void clear() noexcept;
 
     /**
      * @brief Resize the vector to given new size.
+     * 
+     *        Memory is only reallocated if the new size exceeds the capacity, in which case
+     *        the capacity is set to the new size.
      *
      * @param[in] newSize The new size of vector.
      * 
@@ -244,6 +281,24 @@ public:
      */
     bool resize(size_t newSize) noexcept;
 
+    /**
+     * @brief Reserve memory for at least given number of elements.
+     * 
+     *        The size of the vector is left unchanged.
+     *
+     * @param[in] newCapacity The requested capacity of vector.
+     * 
+     * @return True if the capacity is at least the requested capacity, false otherwise.
+     */
+    bool reserve(size_t newCapacity) noexcept;
+
+    /**
+     * @brief Release unused memory, reducing the capacity of vector to its size.
+     * 
+     * @return True if the capacity now matches the size, false otherwise.
+     */
+    bool shrinkToFit() noexcept;
+
     /**
      * @brief Push new value to the back of vector.
      *
@@ -253,22 +308,81 @@ public:
      */
     bool pushBack(const T& value) noexcept;
 
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     * 
+     * @return True if the value was moved to the back of vector, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value in place at the back of vector.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was constructed at the back of vector, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
     /** 
-     * @brief Pop value at the back of vector noexcept.
+     * @brief Pop value at the back of vector.
+     * 
+     *        The capacity of the vector is left unchanged.
      *
-     * @return True if the last value of vector was popped, false otherwise.
+     * @return True if the last value of vector was popped, false if the vector is empty.
      */
     bool popBack() noexcept;
 
-protected:
+    /**
+     * @brief Insert value at given index, shifting subsequent values one step back.
+     *
+     * @param[in] index The index to insert the value at, at most the size of vector.
+     * @param[in] value Reference to the value to insert.
+     * 
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(size_t index, const T& value) noexcept;
+
+    /**
+     * @brief Move value to given index, shifting subsequent values one step back.
+     *
+     * @param[in] index The index to insert the value at, at most the size of vector.
+     * @param[in] value Reference to the value to move.
+     * 
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(size_t index, T&& value) noexcept;
 
-    bool copy(const Vector<T>& other) noexcept;
-    void assign(const Vector<T>& other, size_t offset = 0) noexcept;
+    /**
+     * @brief Erase value at given index, shifting subsequent values one step forward.
+     * 
+     *        The capacity of the vector is left unchanged.
+     *
+     * @param[in] index The index of the value to erase.
+     * 
+     * @return True if the value was erased, false if the index is out of range.
+     */
+    bool erase(size_t index) noexcept;
 
-    template <size_t ValueCount>
-    void assign(const T (&values)[ValueCount], size_t offset = 0) noexcept;
+    /**
+     * @brief Get the allocator of the vector.
+     *
+     * @return Reference to the allocator.
+     */
+    Allocator& allocator() const noexcept;
+
+protected:
 
-    bool addValues(const Vector<T>& other) noexcept;
+    bool copy(const Vector& other) noexcept;
+    bool reallocate(size_t newCapacity) noexcept;
+    bool grow(size_t minCapacity) noexcept;
+
+    bool addValues(const Vector& other) noexcept;
 
     template <size_t ValueCount>
     bool addValues(const T (&values)[ValueCount]) noexcept;
@@ -276,8 +390,14 @@ protected:
     /** Pointer to dynamic field holding data. */
     T* myData;
 
-    /** The size of the field in number of elements it can hold. */
+    /** The size of the vector in number of elements it holds. */
     size_t mySize;
+
+    /** The capacity of the field in number of elements it can hold. */
+    size_t myCapacity;
+
+    /** Pointer to the allocator. */
+    Allocator* myAllocator;
 };
 } // namespace container
 
@@ -0,0 +1,138 @@
+/**
+ * @brief System clock driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/clock/interface.h"
+
+namespace driver 
+{
+namespace clock
+{
+/**
+ * @brief System clock driver for ATmega328P.
+ * 
+ *        Use the singleton design pattern to ensure only one system clock exists.
+ * 
+ *        The clock is based on the 16-bit Timer 1 running freely with a prescaler of 8,
+ *        i.e. the resolution is 0.5 us. The counter overflows every 32.768 ms, which is
+ *        the only interrupt used. The overflows are counted in software to extend the time
+ *        to 32 bits, while each reading is made atomically, also when an overflow is pending.
+ * 
+ *        Timer 1 is reserved while the clock is enabled, which leaves Timer 0 and Timer 2 
+ *        for timer::Atmega328p. The clock is enabled on creation.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /** CPU frequency in Hz. */
+    static constexpr uint32_t CpuFrequency_hz{16000000UL};
+
+    /** Timer prescaler. */
+    static constexpr uint8_t Prescaler{8U};
+
+    /** Number of timer counts per microsecond. */
+    static constexpr uint8_t CountsPerUs{CpuFrequency_hz / Prescaler / 1000000UL};
+
+    /** Time between each timer overflow in microseconds. */
+    static constexpr uint32_t OverflowInterval_us{65536UL / CountsPerUs};
+
+    /**
+     * @brief Get the singleton system clock instance.
+     * 
+     * @return Reference to the singleton system clock instance.
+     */
+    static Interface& getInstance() noexcept;
+
+    /**
+     * @brief Check whether the clock is initialized.
+     * 
+     * @return True if the clock is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the clock is enabled.
+     * 
+     * @return True if the clock is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of the clock. The clock keeps its time while disabled.
+     * 
+     *        Disabling the clock releases Timer 1 for use by timer::Atmega328p.
+     * 
+     * @param[in] enable True to enable the clock, false otherwise.
+     * 
+     * @return True on success, false if Timer 1 is used by a timer.
+     */
+    bool setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Get the time elapsed since the clock was started.
+     * 
+     * @return The elapsed time in microseconds.
+     */
+    uint32_t micros() const noexcept override;
+
+    /**
+     * @brief Get the time elapsed since the clock was started.
+     * 
+     * @return The elapsed time in milliseconds.
+     */
+    uint32_t millis() const noexcept override;
+
+    /** 
+     * @brief Timer overflow handler. 
+     */
+    void handleOverflow() noexcept;
+
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Structure holding a snapshot of the clock.
+     */
+    struct Snapshot
+    {
+        /** The number of timer overflows. */
+        uint32_t overflowCount;
+
+        /** Whole milliseconds elapsed at the last overflow. */
+        uint32_t ms;
+
+        /** Microseconds elapsed since the last whole millisecond at the last overflow. */
+        uint16_t fraction_us;
+
+        /** Timer counter value. */
+        uint16_t counter;
+    };
+
+    Atmega328p() noexcept;
+    ~Atmega328p() noexcept override = default;
+    Snapshot snapshot() const noexcept;
+    static void addOverflow(Snapshot& time) noexcept;
+
+    /** The number of timer overflows. */
+    volatile uint32_t myOverflowCount;
+
+    /** Whole milliseconds elapsed at the last overflow. */
+    volatile uint32_t myMillis;
+
+    /** Microseconds elapsed since the last whole millisecond at the last overflow. */
+    volatile uint16_t myFraction_us;
+
+    /** Timer counter value saved while the clock is disabled. */
+    uint16_t myPausedCounter;
+
+    /** Indicate whether the clock is enabled. */
+    bool myEnabled;
+};
+} // namespace clock
+} // namespace driver
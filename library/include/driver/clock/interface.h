@@ -0,0 +1,69 @@
+/**
+ * @brief System clock interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace clock
+{
+/**
+ * @brief System clock interface.
+ * 
+ *        The system clock is a monotonic clock used for measuring elapsed time, such as
+ *        latencies, loop times and the age of sensor samples.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check whether the clock is initialized.
+     * 
+     * @return True if the clock is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Check whether the clock is enabled.
+     * 
+     * @return True if the clock is enabled, false otherwise.
+     */
+    virtual bool isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Set enablement of the clock. The clock keeps its time while disabled.
+     * 
+     * @param[in] enable True to enable the clock, false otherwise.
+     * 
+     * @return True on success, false if the clock couldn't be enabled.
+     */
+    virtual bool setEnabled(bool enable) noexcept = 0;
+
+    /**
+     * @brief Get the time elapsed since the clock was started.
+     * 
+     *        The time wraps around after 2^32 us (about 71.6 minutes), compute elapsed time as
+     *        the difference between two readings to handle the wrap-around.
+     * 
+     * @return The elapsed time in microseconds.
+     */
+    virtual uint32_t micros() const noexcept = 0;
+
+    /**
+     * @brief Get the time elapsed since the clock was started.
+     * 
+     *        The time wraps around after 2^32 ms (about 49.7 days).
+     * 
+     * @return The elapsed time in milliseconds.
+     */
+    virtual uint32_t millis() const noexcept = 0;
+};
+} // namespace clock
+} // namespace driver
@@ -0,0 +1,114 @@
+/**
+ * @brief System clock stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/clock/interface.h"
+
+namespace driver 
+{
+namespace clock
+{
+/**
+ * @brief System clock stub.
+ * 
+ *        The time is only updated via advance_us() and setTime_us(), which makes it possible 
+ *        to simulate the passage of time in tests.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] time_us Start time in microseconds (default = 0).
+     */
+    explicit Stub(const uint64_t time_us = 0U) noexcept
+        : myTime_us{time_us}
+        , myEnabled{true}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check whether the clock is initialized.
+     * 
+     * @return True if the clock is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return true; }
+
+    /**
+     * @brief Check whether the clock is enabled.
+     * 
+     * @return True if the clock is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override { return myEnabled; }
+
+    /**
+     * @brief Set enablement of the clock.
+     * 
+     * @param[in] enable True to enable the clock, false otherwise.
+     * 
+     * @return True, since the stub can always be enabled.
+     */
+    bool setEnabled(const bool enable) noexcept override 
+    { 
+        myEnabled = enable; 
+        return true;
+    }
+
+    /**
+     * @brief Get the simulated time.
+     * 
+     * @return The simulated time in microseconds.
+     */
+    uint32_t micros() const noexcept override { return static_cast<uint32_t>(myTime_us); }
+
+    /**
+     * @brief Get the simulated time.
+     * 
+     * @return The simulated time in milliseconds.
+     */
+    uint32_t millis() const noexcept override 
+    { 
+        return static_cast<uint32_t>(myTime_us / 1000U); 
+    }
+
+    /**
+     * @brief Advance the simulated time. The time is only advanced while enabled.
+     * 
+     * @param[in] duration_us The duration to advance the time with in microseconds.
+     */
+    void advance_us(const uint64_t duration_us) noexcept 
+    { 
+        if (myEnabled) { myTime_us += duration_us; }
+    }
+
+    /**
+     * @brief Set the simulated time.
+     * 
+     * @param[in] time_us The new time in microseconds.
+     */
+    void setTime_us(const uint64_t time_us) noexcept { myTime_us = time_us; }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** The simulated time in microseconds. */
+    uint64_t myTime_us;
+
+    /** Indicate whether the clock is enabled. */
+    bool myEnabled;
+};
+} // namespace clock
+} // namespace driver
@@ -18,6 +18,7 @@ public:
         : m_value{false}
         , m_initialized{true}
         , m_interruptEnabled{false}
+        , m_toggleCount{0U}
     {}
 
     ~Stub() noexcept override = default;
@@ -50,6 +51,7 @@ public:
         if (m_initialized)
         {
             m_value = !m_value;
+            m_toggleCount++;
         }
     }
 
@@ -74,6 +76,11 @@ public:
         return m_interruptEnabled;
     }
 
+    std::uint32_t toggleCount() const noexcept
+    {
+        return m_toggleCount;
+    }
+
     void setInitialized(bool initialized) noexcept
     {
         m_initialized = initialized;
@@ -88,6 +95,7 @@ private:
     bool m_value;
     bool m_initialized;
     bool m_interruptEnabled;
+    std::uint32_t m_toggleCount;
 };
 
 } // namespace gpio
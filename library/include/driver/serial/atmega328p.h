@@ -20,6 +20,73 @@ namespace serial
 class Atmega328p final : public Interface
 {
 public:
+    /**
+     * @brief Enumeration of transmission modes.
+     */
+    enum class TxMode : uint8_t
+    {
+        Blocking, // Busy-wait until each character has been put in the data register.
+        Buffered, // Queue characters in the transmit buffer, transmit via interrupts.
+    };
+
+    /**
+     * @brief Enumeration of policies for handling a full transmit buffer in buffered mode.
+     */
+    enum class OverflowPolicy : uint8_t
+    {
+        Drop,            // Discard new characters that don't fit in the buffer.
+        Block,           // Wait until there's room in the buffer.
+        OverwriteOldest, // Discard the oldest queued characters to make room for new ones.
+    };
+
+    /** Capacity of the transmit buffer in bytes. Must be a power of two. */
+    static constexpr uint16_t TxBufferSize{64U};
+
+    /** Capacity of the receive buffer in bytes. Must be a power of two. */
+    static constexpr uint16_t RxBufferSize{64U};
+
+    /** CPU frequency in Hz, used for computing baud rate settings. */
+    static constexpr uint32_t CpuFrequency_hz{16000000UL};
+
+    /** Baud rate used at startup in bps. */
+    static constexpr uint32_t DefaultBaudRate_bps{9600U};
+
+    /** Max supported baud rate in bps. */
+    static constexpr uint32_t MaxBaudRate_bps{1000000UL};
+
+    /** 
+     * Max accepted baud rate error in ppm (parts per million). The datasheet recommends max 2 %,
+     * the limit is set slightly higher to allow 115200 bps at 16 MHz (2.1 % error).
+     */
+    static constexpr uint32_t MaxBaudRateError_ppm{25000UL};
+
+    /**
+     * @brief Structure holding the settings for a given baud rate.
+     */
+    struct BaudRateConfig
+    {
+        bool isValid;          // Indicate whether the baud rate can be generated.
+        bool doubleSpeed;      // Indicate whether double speed mode (U2X0) is used.
+        uint16_t ubrr;         // Value of baud rate register UBRR0.
+        uint32_t baudRate_bps; // Actual baud rate in bps.
+        int32_t error_ppm;     // Deviation from the requested baud rate in ppm.
+    };
+
+    /**
+     * @brief Compute the settings for the given baud rate.
+     * 
+     *        Normal speed mode is preferred due to its better receiver tolerance, double speed
+     *        mode is only used if it results in a smaller baud rate error.
+     * 
+     * @param[in] baudRate_bps The requested baud rate in bps.
+     * @param[in] maxError_ppm Max accepted baud rate error in ppm.
+     * 
+     * @return The baud rate settings. The settings are invalid if the baud rate is out of range
+     *         or if the baud rate error exceeds the given max error.
+     */
+    static constexpr BaudRateConfig baudRateConfig(uint32_t baudRate_bps, 
+                                                   uint32_t maxError_ppm = MaxBaudRateError_ppm) noexcept;
+
     /**
      * @brief Get the singleton serial instance.
      * 
@@ -34,6 +101,41 @@ public:
      */
     uint32_t baudRate_bps() const noexcept override;
 
+    /**
+     * @brief Get the deviation between the actual and the requested baud rate.
+     * 
+     * @return The baud rate error in ppm (parts per million).
+     */
+    int32_t baudRateError_ppm() const noexcept;
+
+    /**
+     * @brief Set the baud rate of the serial device.
+     * 
+     *        Queued characters are transmitted before the baud rate is changed. Prefer the
+     *        template version for constant baud rates, which computes the settings at compile time.
+     * 
+     * @param[in] baudRate_bps The new baud rate in bps.
+     * @param[in] maxError_ppm Max accepted baud rate error in ppm.
+     * 
+     * @return True if the baud rate was set, false if the baud rate is out of range or if the 
+     *         baud rate error exceeds the given max error, in which case the baud rate is 
+     *         left unchanged.
+     */
+    bool setBaudRate(uint32_t baudRate_bps, 
+                     uint32_t maxError_ppm = MaxBaudRateError_ppm) noexcept;
+
+    /**
+     * @brief Set the baud rate of the serial device with settings computed at compile time.
+     * 
+     *        A compiler error is generated if the baud rate is out of range or if the baud rate
+     *        error exceeds the given max error.
+     * 
+     * @tparam BaudRate_bps The new baud rate in bps.
+     * @tparam MaxError_ppm Max accepted baud rate error in ppm.
+     */
+    template <uint32_t BaudRate_bps, uint32_t MaxError_ppm = MaxBaudRateError_ppm>
+    void setBaudRate() noexcept;
+
     /**
      * @brief Check whether the serial device is initialized.
      * 
@@ -66,6 +168,124 @@ public:
      */
     int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept override;
 
+    /**
+     * @brief Get the number of received bytes available for reading.
+     *
+     * @return The number of bytes in the receive buffer.
+     */
+    uint16_t available() const noexcept override;
+
+    /**
+     * @brief Read the data already received from the serial port without blocking.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     *
+     * @return The number of read characters (0 if no data is available), or -1 on error.
+     */
+    int16_t read(uint8_t* buffer, uint16_t size) const noexcept override;
+
+    /**
+     * @brief Read received data up to and including the given delimiter without blocking.
+     *
+     *        No data is consumed until the delimiter has been received, unless the read buffer
+     *        or the receive buffer is full, in which case as many bytes as fit are read.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     * @param[in] delimiter The delimiter to read until, such as a new line character.
+     *
+     * @return The number of read characters (0 if the delimiter hasn't been received yet),
+     *         or -1 on error.
+     */
+    int16_t readUntil(uint8_t* buffer, uint16_t size, uint8_t delimiter) const noexcept override;
+
+    /**
+     * @brief Get the number of received bytes discarded due to receive buffer overflow.
+     *
+     * @return The number of discarded bytes.
+     */
+    uint32_t rxDropCount() const noexcept;
+
+    /**
+     * @brief Receive complete interrupt handler.
+     *
+     *        Move the received byte from the data register to the receive buffer.
+     */
+    void handleRxInterrupt() noexcept;
+
+    /**
+     * @brief Get the free space in the transmit buffer.
+     *
+     *        In blocking mode, no characters are queued, hence 0 is always returned.
+     *
+     * @return The number of free bytes in the transmit buffer.
+     */
+    uint16_t txFreeSpace() const noexcept override;
+
+    /**
+     * @brief Write binary data to the serial port.
+     *
+     *        The bytes are transmitted as is, according to the current transmission mode and 
+     *        overflow policy. Bytes discarded due to overflow are counted as written.
+     *
+     * @param[in] buffer Buffer holding the data to write.
+     * @param[in] size Number of bytes to write.
+     *
+     * @return The number of written bytes (0 if the device is disabled), or -1 on error.
+     */
+    int16_t write(const uint8_t* buffer, uint16_t size) const noexcept override;
+
+    /**
+     * @brief Get the transmission mode.
+     *
+     * @return The transmission mode.
+     */
+    TxMode txMode() const noexcept;
+
+    /**
+     * @brief Set the transmission mode.
+     *
+     *        Characters queued in buffered mode are transmitted before switching to blocking mode.
+     *
+     * @param[in] mode The new transmission mode.
+     */
+    void setTxMode(TxMode mode) noexcept;
+
+    /**
+     * @brief Get the policy used when the transmit buffer is full.
+     *
+     * @return The overflow policy.
+     */
+    OverflowPolicy overflowPolicy() const noexcept;
+
+    /**
+     * @brief Set the policy used when the transmit buffer is full.
+     *
+     * @param[in] policy The new overflow policy.
+     */
+    void setOverflowPolicy(OverflowPolicy policy) noexcept;
+
+    /**
+     * @brief Get the number of characters discarded due to transmit buffer overflow.
+     *
+     * @return The number of discarded characters.
+     */
+    uint32_t txDropCount() const noexcept;
+
+    /**
+     * @brief Block until all queued characters have been transmitted.
+     */
+    void flush() noexcept;
+
+    /**
+     * @brief Data register empty interrupt handler.
+     *
+     *        Put the next queued character in the data register. The interrupt is disabled
+     *        once the transmit buffer is empty.
+     */
+    void handleTxInterrupt() noexcept;
+
     Atmega328p(const Atmega328p&)                      = delete; // No copy constructor.
     Atmega328p(Atmega328p&& other) noexcept            = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&)           = delete; // No copy assignment.
@@ -89,8 +309,82 @@ private:
      */
     void print(const char* str) const noexcept override;
 
+    /**
+     * @brief Print the given characters in the serial terminal.
+     * 
+     * @param[in] data Pointer to the characters to print.
+     * @param[in] length The number of characters to print.
+     */
+    void print(const char* data, uint16_t length) const noexcept override;
+
+    /**
+     * @brief Apply the given baud rate settings.
+     * 
+     * @param[in] config The baud rate settings to apply.
+     */
+    void applyBaudRate(const BaudRateConfig& config) noexcept;
+
+    /** The actual baud rate in bps. */
+    uint32_t myBaudRate_bps;
+
+    /** Deviation from the requested baud rate in ppm. */
+    int32_t myBaudRateError_ppm;
+
     /** Indicate whether serial transmission is enabled. */
     bool myEnabled;
+
+    /** The transmission mode. */
+    TxMode myTxMode;
+
+    /** Policy used when the transmit buffer is full. */
+    OverflowPolicy myOverflowPolicy;
 };
+
+// -----------------------------------------------------------------------------
+constexpr Atmega328p::BaudRateConfig Atmega328p::baudRateConfig(
+    const uint32_t baudRate_bps, const uint32_t maxError_ppm) noexcept
+{
+    constexpr uint16_t maxUbrr{4095U};
+    BaudRateConfig best{false, false, 0U, 0U, 0};
+
+    if ((0U == baudRate_bps) || (MaxBaudRate_bps < baudRate_bps)) { return best; }
+
+    // Try normal speed (16 samples per bit) first, then double speed (8 samples per bit).
+    for (uint8_t samplesPerBit{16U}; 8U <= samplesPerBit; samplesPerBit /= 2U)
+    {
+        const uint64_t divisor{static_cast<uint64_t>(samplesPerBit) * baudRate_bps};
+
+        // Round UBRR0 to the nearest value, skip the mode if the baud rate is out of range.
+        const uint64_t ubrrPlusOne{(CpuFrequency_hz + divisor / 2U) / divisor};
+        if ((0U == ubrrPlusOne) || (maxUbrr + 1U < ubrrPlusOne)) { continue; }
+
+        // Compute the actual baud rate and the deviation from the requested one.
+        const uint64_t actualDivisor{samplesPerBit * ubrrPlusOne};
+        const uint32_t actual_bps{static_cast<uint32_t>(
+            (CpuFrequency_hz + actualDivisor / 2U) / actualDivisor)};
+        const uint64_t ratio_ppm{(CpuFrequency_hz * 1000000ULL + divisor * ubrrPlusOne / 2U) /
+                                 (divisor * ubrrPlusOne)};
+        const int32_t error_ppm{static_cast<int32_t>(static_cast<int64_t>(ratio_ppm) - 1000000)};
+        const uint32_t absError_ppm{static_cast<uint32_t>(0 > error_ppm ? -error_ppm : error_ppm)};
+        const uint32_t bestAbsError_ppm{
+            static_cast<uint32_t>(0 > best.error_ppm ? -best.error_ppm : best.error_ppm)};
+
+        if ((maxError_ppm >= absError_ppm) && (!best.isValid || (bestAbsError_ppm > absError_ppm)))
+        {
+            best = BaudRateConfig{true, 8U == samplesPerBit, 
+                                  static_cast<uint16_t>(ubrrPlusOne - 1U), actual_bps, error_ppm};
+        }
+    }
+    return best;
+}
+
+// -----------------------------------------------------------------------------
+template <uint32_t BaudRate_bps, uint32_t MaxError_ppm>
+void Atmega328p::setBaudRate() noexcept
+{
+    constexpr BaudRateConfig config{baudRateConfig(BaudRate_bps, MaxError_ppm)};
+    static_assert(config.isValid, "Baud rate out of range or baud rate error too large!");
+    applyBaudRate(config);
+}
 } // namespace serial
 } // namespace driver
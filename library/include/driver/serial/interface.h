@@ -4,7 +4,8 @@
 #pragma once
 
 #include <stdint.h>
-#include <stdio.h>
+
+#include "utils/format.h"
 
 namespace driver 
 {
@@ -60,11 +61,67 @@ public:
      */
     virtual int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept = 0;
 
+    /**
+     * @brief Get the number of received bytes available for reading.
+     *
+     * @return The number of bytes in the receive buffer.
+     */
+    virtual uint16_t available() const noexcept = 0;
+
+    /**
+     * @brief Read the data already received from the serial port without blocking.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     *
+     * @return The number of read characters (0 if no data is available), or -1 on error.
+     */
+    virtual int16_t read(uint8_t* buffer, uint16_t size) const noexcept = 0;
+
+    /**
+     * @brief Read received data up to and including the given delimiter without blocking.
+     *
+     *        No data is consumed until the delimiter has been received, unless the read buffer
+     *        or the receive buffer is full, in which case as many bytes as fit are read.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     * @param[in] delimiter The delimiter to read until, such as a new line character.
+     *
+     * @return The number of read characters (0 if the delimiter hasn't been received yet),
+     *         or -1 on error.
+     */
+    virtual int16_t readUntil(uint8_t* buffer, uint16_t size, uint8_t delimiter) const noexcept = 0;
+
+    /**
+     * @brief Get the free space in the transmit buffer.
+     *
+     *        This is the number of characters that can be printed without blocking the caller.
+     *
+     * @return The number of free bytes in the transmit buffer.
+     */
+    virtual uint16_t txFreeSpace() const noexcept = 0;
+
+    /**
+     * @brief Write binary data to the serial port.
+     *
+     *        The bytes are transmitted as is, unlike printed strings, where new lines are
+     *        combined with carriage returns.
+     *
+     * @param[in] buffer Buffer holding the data to write.
+     * @param[in] size Number of bytes to write.
+     *
+     * @return The number of written bytes, or -1 on error.
+     */
+    virtual int16_t write(const uint8_t* buffer, uint16_t size) const noexcept = 0;
+
     /**
      * @brief Print formatted string to the serial port.
      * 
      *        If the formatted string contains format specifiers, the additional arguments are 
-     *        formatted and inserted into the format string.
+     *        formatted and inserted into the format string. The characters are streamed directly
+     *        to the serial port, hence the length of the formatted string is unlimited.
+     *        See utils::format for supported format specifiers.
      *
      * @tparam Args  Parameter pack containing an arbitrary number of arguments.
      *
@@ -83,6 +140,14 @@ private:
      * @param[in] str The string to print.
      */
     virtual void print(const char* str) const noexcept = 0;
+
+    /**
+     * @brief Print the given characters in the serial terminal.
+     * 
+     * @param[in] data Pointer to the characters to print (not necessarily null-terminated).
+     * @param[in] length The number of characters to print.
+     */
+    virtual void print(const char* data, uint16_t length) const noexcept = 0;
 };
 
 // -----------------------------------------------------------------------------
@@ -95,16 +160,9 @@ bool Interface::printf(const char* format, const Args&... args) const noexcept
     // Format and insert given additional arguments (if any).
     if (0U < sizeof...(args))
     {
-        constexpr size_t length{101U};
-        char buffer[length]{'\0'};
-
-        // Suppress -Wformat-security: 'format' is always a developer-controlled string,
-        // never user-supplied, so this use of snprintf is safe.
-        #pragma GCC diagnostic push
-        #pragma GCC diagnostic ignored "-Wformat-security"
-        (void) (snprintf(buffer, length, format, args...));
-        #pragma GCC diagnostic pop
-        print(buffer);
+        // Stream the formatted characters to the serial port, no intermediate buffer needed.
+        auto sink{[this](const char* data, const uint16_t length) { print(data, length); }};
+        utils::format(sink, format, args...);
     }
     // Print the string, then return true to indicate success.
     else { print(format); }
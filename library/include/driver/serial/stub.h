@@ -29,6 +29,8 @@ public:
      */
     explicit Stub(const uint32_t baudRate_bps = 9600U) noexcept
         : myReadBuffer{}
+        , myReadIndex{0U}
+        , myWriteBuffer{}
         , myBaudRate_bps{baudRate_bps}
         , myEnabled{true}
         , m_txCount{0U}
@@ -94,15 +96,37 @@ public:
     {
         // Do not use the timeout in the stub implementation.
         (void)timeout_ms;
+        return read(buffer, size);
+    }
+
+    /**
+     * @brief Get the number of received bytes available for reading.
+     *
+     * @return The number of bytes in the simulated read buffer.
+     */
+    uint16_t available() const noexcept override
+    {
+        return static_cast<uint16_t>(myReadBuffer.size() - myReadIndex);
+    }
 
+    /**
+     * @brief Read the data already received from the serial port without blocking.
+     *
+     *        Read bytes are consumed, just like for the real serial device.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     *
+     * @return The number of read characters (0 if no data is available), or -1 on error.
+     */
+    int16_t read(uint8_t* buffer, const uint16_t size) const noexcept override
+    {
         if ((nullptr == buffer) || (size == 0U))
         {
             return -1;
         }
 
-        const uint16_t storedBytes{
-            static_cast<uint16_t>(myReadBuffer.size())
-        };
+        const uint16_t storedBytes{available()};
 
         const uint16_t bytesToRead{
             size < storedBytes ? size : storedBytes
@@ -110,12 +134,89 @@ public:
 
         for (uint16_t i = 0U; i < bytesToRead; ++i)
         {
-            buffer[i] = myReadBuffer[i];
+            buffer[i] = myReadBuffer[myReadIndex++];
         }
 
         return static_cast<int16_t>(bytesToRead);
     }
 
+    /**
+     * @brief Read received data up to and including the given delimiter without blocking.
+     *
+     *        No data is consumed until the delimiter has been received, unless the read buffer
+     *        is full, in which case as many bytes as fit are read.
+     *
+     * @param[out] buffer Read buffer.
+     * @param[in] size Buffer size in bytes.
+     * @param[in] delimiter The delimiter to read until, such as a new line character.
+     *
+     * @return The number of read characters (0 if the delimiter hasn't been received yet),
+     *         or -1 on error.
+     */
+    int16_t readUntil(uint8_t* buffer,
+                      const uint16_t size,
+                      const uint8_t delimiter) const noexcept override
+    {
+        if ((nullptr == buffer) || (size == 0U))
+        {
+            return -1;
+        }
+
+        const uint16_t storedBytes{available()};
+
+        for (uint16_t i = 0U; i < storedBytes; ++i)
+        {
+            if (delimiter == myReadBuffer[myReadIndex + i])
+            {
+                return read(buffer, size < i + 1U ? size : i + 1U);
+            }
+        }
+
+        return size <= storedBytes ? read(buffer, size) : 0;
+    }
+
+    /**
+     * @brief Get the free space in the transmit buffer.
+     *
+     *        The stub prints immediately, hence the transmit buffer never fills up.
+     *
+     * @return The number of free bytes in the transmit buffer.
+     */
+    uint16_t txFreeSpace() const noexcept override
+    {
+        return UINT16_MAX;
+    }
+
+    /**
+     * @brief Write binary data to the serial port.
+     *
+     *        The data is stored in the simulated write buffer.
+     *
+     * @param[in] buffer Buffer holding the data to write.
+     * @param[in] size Number of bytes to write.
+     *
+     * @return The number of written bytes (0 if the device is disabled), or -1 on error.
+     */
+    int16_t write(const uint8_t* buffer, const uint16_t size) const noexcept override
+    {
+        if ((nullptr == buffer) || (size == 0U))
+        {
+            return -1;
+        }
+
+        if (!myEnabled)
+        {
+            return 0;
+        }
+
+        for (uint16_t i = 0U; i < size; ++i)
+        {
+            myWriteBuffer.pushBack(buffer[i]);
+        }
+
+        return static_cast<int16_t>(size);
+    }
+
     /**
      * @brief Print the given string in the serial terminal.
      * 
@@ -136,12 +237,34 @@ public:
         #endif
     }
 
+    /**
+     * @brief Print the given characters in the serial terminal.
+     * 
+     * @param[in] data Pointer to the characters to print.
+     * @param[in] length The number of characters to print.
+     */
+    void print(const char* data, const uint16_t length) const noexcept override
+    {
+        if ((!myEnabled) || (nullptr == data))
+        {
+            return;
+        }
+
+        // Count transmissions for logic tests
+        ++m_txCount;
+
+        #ifdef TESTSUITE
+            std::cout.write(data, length);
+        #endif
+    }
+
     /**
      * @brief Clear the simulated read buffer.
      */
     void clearReadBuffer() noexcept
     {
         myReadBuffer.clear();
+        myReadIndex = 0U;
     } 
 
     /**
@@ -159,6 +282,7 @@ public:
         }
 
         myReadBuffer.resize(size);
+        myReadIndex = 0U;
         for (uint16_t i = 0U; i < size; ++i)
         {
             myReadBuffer[i] = buffer[i];
@@ -166,7 +290,47 @@ public:
     }
 
     /**
-     * @brief Get number of transmitted messages (test helper).
+     * @brief Simulate received data by appending to the read buffer.
+     * 
+     *        Unread data is kept, just like for the receive buffer of the real serial device.
+     * 
+     * @param[in] buffer Buffer containing the data to simulate.
+     * @param[in] size Size of the buffer in bytes.
+     */
+    void appendReadBuffer(const uint8_t* buffer,
+                          const uint16_t size) noexcept
+    { 
+        if ((nullptr == buffer) || (size == 0U))
+        {
+            return;
+        }
+
+        for (uint16_t i = 0U; i < size; ++i)
+        {
+            myReadBuffer.pushBack(buffer[i]);
+        }
+    }
+
+    /**
+     * @brief Get the simulated write buffer, which holds all binary data written so far.
+     *
+     * @return Reference to the simulated write buffer.
+     */
+    const container::Vector<uint8_t>& writeBuffer() const noexcept
+    {
+        return myWriteBuffer;
+    }
+
+    /**
+     * @brief Clear the simulated write buffer.
+     */
+    void clearWriteBuffer() noexcept
+    {
+        myWriteBuffer.clear();
+    }
+
+    /**
+     * @brief Get number of transmissions, i.e. print calls (test helper).
      */
     std::size_t txCount() const noexcept
     {
@@ -182,13 +346,19 @@ private:
     /** Simulated read buffer. */
     container::Vector<uint8_t> myReadBuffer;
 
+    /** Index of the next byte to read in the simulated read buffer. */
+    mutable uint16_t myReadIndex;
+
+    /** Simulated write buffer. */
+    mutable container::Vector<uint8_t> myWriteBuffer;
+
     /** Baud rate in bps (bits per second). */
     const uint32_t myBaudRate_bps;
 
     /** Indicate whether serial transmission is enabled. */
     bool myEnabled;
 
-    /** Number of transmitted messages (test helper). */
+    /** Number of transmissions (test helper). */
     mutable std::size_t m_txCount;
 };
 
@@ -19,7 +19,7 @@
 
 #include "driver/tempsensor/interface.h"
 #include "driver/adc/interface.h"
-#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/interface.h"
 
 namespace driver
 {
@@ -41,7 +41,7 @@ public:
      */
     Smart(uint8_t channel,
           adc::Interface& adc,
-          const ml::lin_reg::Fixed& model) noexcept;
+          const ml::lin_reg::Interface& model) noexcept;
 
     /**
      * @brief Check whether the sensor is initialized.
@@ -54,10 +54,10 @@ public:
     int16_t read() const noexcept override;
 
 private:
-    uint8_t                    m_channel;
-    adc::Interface&            m_adc;
-    const ml::lin_reg::Fixed&  m_model;
-    bool                       m_initialized;
+    uint8_t                        m_channel;
+    adc::Interface&                m_adc;
+    const ml::lin_reg::Interface&  m_model;
+    bool                           m_initialized;
 };
 
 } // namespace tempsensor
@@ -99,6 +99,18 @@ public:
      */
     void handleCallback() noexcept;
 
+    /**
+     * @brief Reserve or release Timer 1 for use outside the timer driver.
+     * 
+     *        Timer 1 is the only 16-bit timer circuit, which is used by the system clock, see
+     *        clock::Atmega328p. Timers created while Timer 1 is reserved use Timer 0 and Timer 2.
+     * 
+     * @param[in] reserve True to reserve Timer 1, false to release it.
+     * 
+     * @return True on success, false if Timer 1 is already used by a timer.
+     */
+    static bool reserveTimer1(bool reserve) noexcept;
+
     Atmega328p()                             = delete; // No default constructor.
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
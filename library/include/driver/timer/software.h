@@ -0,0 +1,180 @@
+/**
+ * @brief Software timer driven by a hierarchical timing wheel.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/timer/interface.h"
+
+namespace driver
+{
+namespace timer
+{
+class Wheel;
+
+/**
+ * @brief Software timer driven by a hierarchical timing wheel.
+ *
+ *        Any number of software timers can share one hardware timer via a timer::Wheel.
+ *        Starting and stopping a timer is O(1) regardless of the number of timers.
+ *
+ *        Just like for the hardware timers, the callback is invoked on timeout and
+ *        hasTimedOut() returns true until the callback returns. If no callback is used,
+ *        hasTimedOut() returns true until the timer is started, stopped or restarted.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Software final : public Interface
+{
+public:
+    /**
+     * @brief Enumeration of timer modes.
+     */
+    enum class Mode : uint8_t
+    {
+        Periodic, // Restart the timer automatically on timeout.
+        OneShot,  // Stop the timer on timeout.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] wheel Reference to the timing wheel driving the timer.
+     * @param[in] timeout_ms The timeout in milliseconds.
+     * @param[in] callback Callback to invoke on timeout (default = none).
+     * @param[in] startTimer Start the timer immediately (default = false).
+     * @param[in] mode The timer mode (default = periodic).
+     */
+    explicit Software(Wheel& wheel, uint32_t timeout_ms, void (*callback)() = nullptr,
+                      bool startTimer = false, Mode mode = Mode::Periodic) noexcept;
+
+    /**
+     * @brief Destructor. Stops the timer.
+     */
+    ~Software() noexcept override;
+
+    /**
+     * @brief Check if the timer is initialized.
+     *        A timer with a timeout of 0 ms is uninitialized.
+     *
+     * @return True if the timer is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the timer is enabled.
+     *
+     * @return True if the timer is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Check whether the timer has timed out.
+     *
+     * @return True if the timer has timed out, false otherwise.
+     */
+    bool hasTimedOut() const noexcept override;
+
+    /**
+     * @brief Get the timeout of the timer.
+     *        The timeout is rounded to a whole number of ticks.
+     *
+     * @return The timeout in milliseconds.
+     */
+    uint32_t timeout_ms() const noexcept override;
+
+    /**
+     * @brief Set timeout of the timer.
+     *        A running timer uses the new timeout from the next timeout or restart.
+     *
+     * @param[in] timeout_ms The new timeout in milliseconds.
+     */
+    void setTimeout_ms(uint32_t timeout_ms) noexcept override;
+
+    /**
+     * @brief Start the timer. A running timer is left running.
+     */
+    void start() noexcept override;
+
+    /**
+     * @brief Stop the timer.
+     */
+    void stop() noexcept override;
+
+    /**
+     * @brief Toggle the timer.
+     */
+    void toggle() noexcept override;
+
+    /**
+     * @brief Restart the timer with the full timeout.
+     */
+    void restart() noexcept override;
+
+    /**
+     * @brief Get the timer mode.
+     *
+     * @return The timer mode.
+     */
+    Mode mode() const noexcept;
+
+    /**
+     * @brief Set the timer mode.
+     *
+     * @param[in] mode The new timer mode.
+     */
+    void setMode(Mode mode) noexcept;
+
+    Software()                           = delete; // No default constructor.
+    Software(const Software&)            = delete; // No copy constructor.
+    Software(Software&&)                 = delete; // No move constructor.
+    Software& operator=(const Software&) = delete; // No copy assignment.
+    Software& operator=(Software&&)      = delete; // No move assignment.
+
+private:
+    friend class Wheel;
+
+    /**
+     * @brief Handle timeout, invoked by the timing wheel.
+     */
+    void handleTimeout() noexcept;
+
+    /**
+     * @brief Convert the given timeout to ticks of the timing wheel.
+     *
+     * @param[in] timeout_ms The timeout in milliseconds.
+     *
+     * @return The timeout in ticks, at least one tick unless the timeout is 0.
+     */
+    uint32_t toTicks(uint32_t timeout_ms) const noexcept;
+
+    /** Timing wheel driving the timer. */
+    Wheel& myWheel;
+
+    /** Callback to invoke on timeout. */
+    void (*myCallback)();
+
+    /** Next timer in the same slot of the timing wheel. */
+    Software* myNext;
+
+    /** Pointer to the pointer pointing at this timer, used for O(1) removal. */
+    Software** myPrevNext;
+
+    /** The tick at which the timer expires. */
+    uint32_t myExpiry;
+
+    /** The timeout in ticks. */
+    uint32_t myTimeoutTicks;
+
+    /** The timer mode. */
+    Mode myMode;
+
+    /** Indicate whether the timer is enabled. */
+    volatile bool myEnabled;
+
+    /** Indicate whether the timer has timed out. */
+    volatile bool myTimedOut;
+};
+} // namespace timer
+} // namespace driver
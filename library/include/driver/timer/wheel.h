@@ -0,0 +1,143 @@
+/**
+ * @brief Hierarchical timing wheel multiplexing software timers on one hardware timer.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace timer
+{
+class Software;
+
+/**
+ * @brief Hierarchical timing wheel multiplexing software timers on one hardware timer.
+ *
+ *        The wheel consists of four levels of 16 slots each. Timers expiring within 16 ticks
+ *        are put in the slot of the lowest level corresponding to their expiry tick, timers
+ *        further away are put in a higher level and moved (cascaded) one level down at a time
+ *        as their expiry tick approaches. Timers expiring more than 65535 ticks ahead are
+ *        cascaded from the top level until in range.
+ *
+ *        Starting and stopping a timer is thereby O(1) regardless of the number of timers,
+ *        while each tick only processes the timers of one slot per level.
+ *
+ *        Call tick() from a periodic hardware timer interrupt, such as the callback of a
+ *        timer::Atmega328p instance, and create any number of timer::Software instances on top.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Wheel final
+{
+public:
+    /** The number of levels of the wheel. */
+    static constexpr uint8_t LevelCount{4U};
+
+    /** The number of bits used for indexing the slots of each level. */
+    static constexpr uint8_t SlotBits{4U};
+
+    /** The number of slots of each level. */
+    static constexpr uint8_t SlotCount{1U << SlotBits};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] tickInterval_us Time between each call to tick() in microseconds
+     *                            (default = 1000 us).
+     */
+    explicit Wheel(uint32_t tickInterval_us = 1000U) noexcept;
+
+    /**
+     * @brief Destructor. Stops all timers of the wheel.
+     */
+    ~Wheel() noexcept;
+
+    /**
+     * @brief Get the time between each tick.
+     *
+     * @return The tick interval in microseconds.
+     */
+    uint32_t tickInterval_us() const noexcept;
+
+    /**
+     * @brief Get the number of ticks since the wheel was created.
+     *
+     * @return The number of elapsed ticks.
+     */
+    uint32_t tickCount() const noexcept;
+
+    /**
+     * @brief Get the number of running timers.
+     *
+     * @return The number of running timers.
+     */
+    uint16_t activeTimerCount() const noexcept;
+
+    /**
+     * @brief Advance the wheel one tick and handle expired timers.
+     *
+     *        Callbacks of expired timers are invoked from this function, i.e. from the
+     *        interrupt context if called from an interrupt handler.
+     */
+    void tick() noexcept;
+
+    Wheel(const Wheel&)            = delete; // No copy constructor.
+    Wheel(Wheel&&)                 = delete; // No move constructor.
+    Wheel& operator=(const Wheel&) = delete; // No copy assignment.
+    Wheel& operator=(Wheel&&)      = delete; // No move assignment.
+
+private:
+    friend class Software;
+
+    /**
+     * @brief Schedule the given timer to expire at the given tick.
+     *
+     * @param[in] timer Reference to the timer to schedule. Must not be scheduled already.
+     * @param[in] expiry The tick at which the timer is to expire.
+     */
+    void schedule(Software& timer, uint32_t expiry) noexcept;
+
+    /**
+     * @brief Remove the given timer from the wheel.
+     *
+     * @param[in] timer Reference to the timer to remove. Must be scheduled.
+     */
+    void cancel(Software& timer) noexcept;
+
+    /**
+     * @brief Put the given timer in the slot corresponding to its expiry tick.
+     *
+     * @param[in] timer Reference to the timer to insert.
+     */
+    void insert(Software& timer) noexcept;
+
+    /**
+     * @brief Detach the timers of the given slot.
+     *
+     * @param[in] slot Reference to the slot to detach.
+     * @param[out] list Reference to the list to move the timers of the slot to.
+     */
+    static void detach(Software*& slot, Software*& list) noexcept;
+
+    /**
+     * @brief Move the timers of the current slot of the given level one level down.
+     *
+     * @param[in] level The level to cascade.
+     */
+    void cascade(uint8_t level) noexcept;
+
+    /** Slots holding lists of scheduled timers, indexed by level and slot. */
+    Software* mySlots[LevelCount][SlotCount];
+
+    /** Time between each tick in microseconds. */
+    const uint32_t myTickInterval_us;
+
+    /** The number of ticks since the wheel was created. */
+    volatile uint32_t myTickCount;
+
+    /** The number of running timers. */
+    uint16_t myActiveTimerCount;
+};
+} // namespace timer
+} // namespace driver
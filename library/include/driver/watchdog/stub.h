@@ -26,6 +26,7 @@ public:
      */
     Stub(const uint16_t timeout_ms = 1024U) noexcept
         : myTimeout_ms{timeout_ms}
+        , myResetCount{0U}
     {}
 
     /**
@@ -78,7 +79,14 @@ public:
     /**
      * @brief Reset the watchdog timer.
      */
-    void reset() noexcept override {}
+    void reset() noexcept override { myResetCount++; }
+
+    /**
+     * @brief Get the number of times the watchdog timer has been reset.
+     * 
+     * @return The number of resets.
+     */
+    uint32_t resetCount() const noexcept { return myResetCount; }
 
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
@@ -89,6 +97,9 @@ private:
     /** Watchdog timeout in ms. */
     uint16_t myTimeout_ms;
 
+    /** The number of times the watchdog timer has been reset. */
+    uint32_t myResetCount;
+
     /** Indicate whether the watchdog is enabled. */
     bool myEnabled;
 };
@@ -3,8 +3,21 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 namespace logic
 {
+/**
+ * @brief Enumeration of events posted by interrupt handlers to the logic implementation.
+ */
+enum class Event : uint8_t
+{
+    ButtonPressed,        // A button event occurred.
+    DebounceTimerTimeout, // The debounce timer has timed out.
+    ToggleTimerTimeout,   // The toggle timer has timed out.
+    TempTimerTimeout,     // The temperature timer has timed out.
+};
+
 /**
  * @brief Generic logic for an MCU with configurable hardware devices.
  */
@@ -30,6 +43,18 @@ public:
      */
     virtual void run(const bool& stop) noexcept = 0;
 
+    /**
+     * @brief Post event to be handled by the run loop.
+     * 
+     *        This function is lightweight and safe to call from one interrupt context at a time,
+     *        such as from the callbacks of the buttons and timers.
+     * 
+     * @param[in] event The event to post.
+     * 
+     * @return True if the event was posted, false if the event queue is full.
+     */
+    virtual bool postEvent(Event event) noexcept = 0;
+
     /**
      * @brief Handle button event.
      * 
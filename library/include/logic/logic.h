@@ -3,7 +3,9 @@
  */
 #pragma once
 
+#include "container/ring_buffer.h"
 #include "logic/interface.h"
+#include "scheduler/task.h"
 
 namespace driver
 {
@@ -30,6 +32,8 @@ namespace watchdog { class Interface; }
 
 } // namespace driver
 
+namespace scheduler { class Scheduler; }
+
 namespace logic
 {
 /**
@@ -47,11 +51,25 @@ namespace logic
  *              last stored state before power down was "on," the LED will automatically blink.
  *            - A temperature sensor to read the surrounding temperature.
  * 
+ *        Interrupt handlers post events via postEvent(), which are handled by the run loop. 
+ *        The CPU is put in idle sleep mode whenever there are no events to handle.
+ * 
+ *        The LED toggling and the temperature printouts can be run as tasks of a cooperative
+ *        scheduler instead of via timer callbacks, see registerTasks(). The toggle and 
+ *        temperature timers then only indicate whether the corresponding task is active.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Logic : public Interface
 {
 public:
+    /** The max number of events waiting to be handled. Bursts of up to this many events, e.g.
+        posted by interrupt handlers while the run loop is busy, are never dropped. */
+    static constexpr uint8_t EventQueueSize{16U};
+
+    /** Serial command to print the heap and stack usage statistics. */
+    static constexpr uint8_t MemoryStatsCommand{'m'};
+
     /**
      * @brief Constructor.
      *     
@@ -92,10 +110,44 @@ public:
     /**
      * @brief Run the system.  
      * 
+     *        Handle posted events in the order they were posted, then sleep until the next 
+     *        interrupt. The watchdog timer is reset once per iteration.
+     * 
      * @param[in] stop Reference to stop flag.                                                            
      */
     void run(const bool& stop) noexcept override;
 
+    /**
+     * @brief Post event to be handled by the run loop.
+     * 
+     *        Events posted when the event queue is full are dropped and counted.
+     * 
+     * @param[in] event The event to post.
+     * 
+     * @return True if the event was posted, false if the event queue is full.
+     */
+    bool postEvent(Event event) noexcept override;
+
+    /**
+     * @brief Get the number of events dropped due to a full event queue.
+     * 
+     * @return The number of dropped events.
+     */
+    uint32_t droppedEventCount() const noexcept;
+
+    /**
+     * @brief Register the periodic handlers as tasks of the given scheduler.
+     * 
+     *        The LED is toggled with the period of the toggle timer and the temperature is 
+     *        printed with the period of the temperature timer. The scheduler is run by the run 
+     *        loop, which then leaves resetting the watchdog timer to the scheduler.
+     * 
+     * @param[in] scheduler Reference to the scheduler. Must outlive the logic implementation.
+     * 
+     * @return True if the tasks were registered, false otherwise.
+     */
+    bool registerTasks(scheduler::Scheduler& scheduler) noexcept;
+
     /**
      * @brief Handle button event.
      * 
@@ -150,6 +202,18 @@ private:
     void handleToggleButtonPressed() noexcept;
     void handleTempButtonPressed() noexcept;
     void restoreToggleStateFromEeprom() noexcept;
+    void handleEvents() noexcept;
+    void handleEvent(Event event) noexcept;
+    void handleSerialCommands() noexcept;
+    void endDebounce() noexcept;
+    static void runToggleTask(void* context) noexcept;
+    static void runTempTask(void* context) noexcept;
+
+    /** Priority of the toggle task. */
+    static constexpr uint8_t ToggleTaskPriority{1U};
+
+    /** Priority of the temperature task. */
+    static constexpr uint8_t TempTaskPriority{2U};
 
     /** Toggle state address in EEPROM. */
     static constexpr uint16_t ToggleStateAddr{0U};
@@ -183,5 +247,20 @@ private:
 
     /** Temperature sensor. */
     driver::tempsensor::Interface& myTempSensor;
+
+    /** Events waiting to be handled by the run loop. */
+    container::RingBuffer<Event, EventQueueSize> myEvents;
+
+    /** The number of events dropped due to a full event queue. */
+    volatile uint32_t myDroppedEventCount;
+
+    /** Scheduler running the tasks, if any. */
+    scheduler::Scheduler* myScheduler;
+
+    /** Task toggling the LED. */
+    scheduler::Task myToggleTask;
+
+    /** Task printing the temperature. */
+    scheduler::Task myTempTask;
 };
 } // namespace logic
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @brief Allocator interface, implemented by the heap, pools and arenas.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace memory
+{
+/**
+ * @brief Allocator interface.
+ *
+ *        Containers and smart pointers take the allocator type as a template parameter.
+ *        Implementations mark their functions final, so calls are resolved at compile time
+ *        unless the interface itself is used as allocator type.
+ */
+class Allocator
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Allocator() noexcept = default;
+
+    /**
+     * @brief Allocate memory.
+     *
+     *        The memory is aligned for any type.
+     *
+     * @param[in] size The number of bytes to allocate.
+     *
+     * @return Pointer to the allocated memory, or nullptr if the allocation failed.
+     */
+    virtual void* allocate(size_t size) noexcept = 0;
+
+    /**
+     * @brief Release memory allocated by this allocator.
+     *
+     * @param[in] block Pointer to the memory to release. Null pointers are ignored.
+     */
+    virtual void deallocate(void* block) noexcept = 0;
+
+    /**
+     * @brief Resize memory allocated by this allocator, possibly in place.
+     *
+     *        By default new memory is allocated, the content is copied and the old memory
+     *        is released. The old memory is kept if the reallocation fails.
+     *
+     * @param[in] block   Pointer to the memory to resize, or nullptr to allocate new memory.
+     * @param[in] size    The number of bytes of the content to preserve.
+     * @param[in] newSize The new size in bytes.
+     *
+     * @return Pointer to the resized memory, or nullptr if the reallocation failed.
+     */
+    virtual void* reallocate(void* block, size_t size, size_t newSize) noexcept;
+};
+
+/**
+ * @brief Static storage of allocators.
+ *
+ *        Allocators with static storage inherit the storage before the allocator using it,
+ *        so that the storage is created first.
+ *
+ * @tparam Size The size of the storage in bytes.
+ */
+template <size_t Size>
+struct StaticStorage
+{
+    /** The storage, aligned for any type. */
+    alignas(max_align_t) uint8_t myStorage[Size];
+};
+
+/**
+ * @brief Get the default instance of given allocator type.
+ *
+ *        Containers and smart pointers created without an allocator instance share the default
+ *        instance of their allocator type, e.g. one static pool per pool type.
+ *
+ * @tparam AllocatorType The allocator type, which must be default constructible.
+ *
+ * @return Reference to the default instance.
+ */
+template <typename AllocatorType>
+AllocatorType& defaultAllocator() noexcept;
+} // namespace memory
+
+#include "impl/allocator_impl.h"
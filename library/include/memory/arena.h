@@ -0,0 +1,155 @@
+/**
+ * @brief Monotonic arena allocators, used for data allocated once at startup.
+ */
+#pragma once
+
+#include "memory/allocator.h"
+
+namespace memory
+{
+/**
+ * @brief Monotonic arena allocator.
+ *
+ *        Memory is allocated by bumping an offset into a buffer, so allocations are O(1),
+ *        cost no block headers and never fragment. Released memory isn't reused, all memory
+ *        is reclaimed at once by resetting the arena. The most recent allocation can be
+ *        resized in place, which lets a growing vector stay in one block.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Arena : public Allocator
+{
+public:
+    /**
+     * @brief Create arena allocating memory from the given buffer.
+     *
+     * @param[in] buffer     Pointer to the buffer to allocate memory from.
+     * @param[in] bufferSize The size of the buffer in bytes.
+     */
+    Arena(void* buffer, size_t bufferSize) noexcept;
+
+    /**
+     * @brief Delete arena. Memory still in use is invalidated together with the buffer.
+     */
+    ~Arena() noexcept override = default;
+
+    /**
+     * @brief Allocate memory from the arena.
+     *
+     * @param[in] size The number of bytes to allocate.
+     *
+     * @return Pointer to the allocated memory, or nullptr if the arena is exhausted.
+     */
+    void* allocate(size_t size) noexcept override final;
+
+    /**
+     * @brief Release memory allocated from the arena.
+     *
+     *        The memory isn't reused until the arena is reset.
+     *
+     * @param[in] block Pointer to the memory to release.
+     */
+    void deallocate(void* block) noexcept override final;
+
+    /**
+     * @brief Resize memory allocated from the arena.
+     *
+     *        The most recent allocation is resized in place, other memory is copied to a new
+     *        allocation.
+     *
+     * @param[in] block   Pointer to the memory to resize, or nullptr to allocate new memory.
+     * @param[in] size    The number of bytes of the content to preserve.
+     * @param[in] newSize The new size in bytes.
+     *
+     * @return Pointer to the resized memory, or nullptr if the arena is exhausted.
+     */
+    void* reallocate(void* block, size_t size, size_t newSize) noexcept override final;
+
+    /**
+     * @brief Reset the arena, which reclaims all memory.
+     *
+     * @note Memory allocated from the arena mustn't be used after the arena is reset.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the number of bytes used, including alignment padding.
+     *
+     * @return The number of bytes used.
+     */
+    size_t used() const noexcept;
+
+    /**
+     * @brief Get the number of bytes available.
+     *
+     * @return The number of bytes left to allocate.
+     */
+    size_t available() const noexcept;
+
+    /**
+     * @brief Get the capacity of the arena.
+     *
+     * @return The total number of bytes of the arena.
+     */
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Get the number of allocations made since the arena was created or reset.
+     *
+     * @return The number of successful allocations, including resizes not made in place.
+     */
+    size_t allocationCount() const noexcept;
+
+    /**
+     * @brief Get the number of allocations that failed since the arena was created or reset.
+     *
+     * @return The number of failed allocations.
+     */
+    size_t failureCount() const noexcept;
+
+    Arena()                        = delete; // No default constructor.
+    Arena(const Arena&)            = delete; // No copy constructor.
+    Arena(Arena&&)                 = delete; // No move constructor.
+    Arena& operator=(const Arena&) = delete; // No copy assignment.
+    Arena& operator=(Arena&&)      = delete; // No move assignment.
+
+private:
+    /** Pointer to the beginning of the buffer. */
+    uint8_t* myBuffer;
+
+    /** The size of the buffer in bytes. */
+    size_t myCapacity;
+
+    /** The offset of the next allocation. */
+    size_t myOffset;
+
+    /** The offset of the most recent allocation. */
+    size_t myLastOffset;
+
+    /** The number of allocations made. */
+    size_t myAllocationCount;
+
+    /** The number of failed allocations. */
+    size_t myFailureCount;
+};
+
+/**
+ * @brief Monotonic arena allocator with static storage.
+ *
+ *        The buffer is stored inline, so the memory of the arena is reserved at compile time
+ *        when the arena is declared as a global or static object.
+ *
+ * @tparam Size The size of the arena in bytes.
+ */
+template <size_t Size>
+class StaticArena final : private StaticStorage<Size>, public Arena
+{
+public:
+    /**
+     * @brief Create arena with static storage.
+     */
+    StaticArena() noexcept;
+};
+} // namespace memory
+
+#include "impl/arena_impl.h"
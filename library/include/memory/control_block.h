@@ -0,0 +1,197 @@
+/**
+ * @brief Control blocks of shared and weak pointers.
+ *
+ * @note This file is included in <shared_ptr.h> and shall not be included directly.
+ */
+#pragma once
+
+#include "memory/ref_count.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+/**
+ * @brief Deleter destroying data and releasing its memory with an allocator.
+ *
+ * @tparam T         The data type.
+ * @tparam Allocator The allocator of the data.
+ */
+template <typename T, typename Allocator>
+struct AllocatorDeleter
+{
+    /** Pointer to the allocator of the data. */
+    Allocator* allocator;
+
+    /**
+     * @brief Destroy given data and release its memory.
+     *
+     * @param[in] data Pointer to the data to delete.
+     */
+    void operator()(T* data) const noexcept;
+};
+
+/**
+ * @brief Control block shared by shared and weak pointers pointing at the same data.
+ *
+ *        The block holds the number of owners, i.e. shared pointers, and the number of
+ *        observers, i.e. weak pointers plus one for all owners together. The data is destroyed
+ *        when the last owner is released, the block itself when the last observer is released.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam RefCount The reference count policy.
+ */
+template <typename RefCount>
+class ControlBlock
+{
+public:
+    /**
+     * @brief Create control block with one owner.
+     */
+    ControlBlock() noexcept;
+
+    /**
+     * @brief Delete control block.
+     */
+    virtual ~ControlBlock() noexcept = default;
+
+    /**
+     * @brief Add an owner of the data.
+     */
+    void addOwner() noexcept;
+
+    /**
+     * @brief Add an owner of the data, unless the data has already been destroyed.
+     *
+     * @return True if an owner was added, false otherwise.
+     */
+    bool addOwnerIfAlive() noexcept;
+
+    /**
+     * @brief Release an owner of the data. The data is destroyed with the last owner.
+     */
+    void releaseOwner() noexcept;
+
+    /**
+     * @brief Add an observer of the data.
+     */
+    void addObserver() noexcept;
+
+    /**
+     * @brief Release an observer of the data. The block is deleted with the last observer.
+     */
+    void releaseObserver() noexcept;
+
+    /**
+     * @brief Get the number of owners of the data.
+     *
+     * @return The number of owners.
+     */
+    size_t ownerCount() const noexcept;
+
+    ControlBlock(const ControlBlock&)            = delete; // No copy constructor.
+    ControlBlock(ControlBlock&&)                 = delete; // No move constructor.
+    ControlBlock& operator=(const ControlBlock&) = delete; // No copy assignment.
+    ControlBlock& operator=(ControlBlock&&)      = delete; // No move assignment.
+
+protected:
+    /**
+     * @brief Destroy the data, called when the last owner is released.
+     */
+    virtual void destroyData() noexcept = 0;
+
+    /**
+     * @brief Delete the block, called when the last observer is released.
+     */
+    virtual void destroyBlock() noexcept = 0;
+
+private:
+    /** The number of owners. */
+    size_t myOwnerCount;
+
+    /** The number of observers, plus one while there are owners. */
+    size_t myObserverCount;
+};
+
+/**
+ * @brief Control block of data allocated separately, deleted by a deleter.
+ *
+ * @tparam T         The data type.
+ * @tparam Deleter   The type of the deleter, called with a pointer to the data.
+ * @tparam Allocator The allocator of the block.
+ * @tparam RefCount  The reference count policy.
+ */
+template <typename T, typename Deleter, typename Allocator, typename RefCount>
+class SeparateControlBlock final : public ControlBlock<RefCount>
+{
+public:
+    /**
+     * @brief Create control block for given data.
+     *
+     * @param[in] data      Pointer to the data.
+     * @param[in] deleter   The deleter of the data.
+     * @param[in] allocator Reference to the allocator of the block.
+     */
+    SeparateControlBlock(T* data, const Deleter& deleter, Allocator& allocator) noexcept;
+
+private:
+    void destroyData() noexcept override;
+    void destroyBlock() noexcept override;
+
+    /** Pointer to the data. */
+    T* myData;
+
+    /** The deleter of the data. */
+    Deleter myDeleter;
+
+    /** Pointer to the allocator of the block. */
+    Allocator* myAllocator;
+};
+
+/**
+ * @brief Control block holding the data, so that data and counts are allocated at once.
+ *
+ * @tparam T         The data type.
+ * @tparam Allocator The allocator of the block.
+ * @tparam RefCount  The reference count policy.
+ */
+template <typename T, typename Allocator, typename RefCount>
+class InlineControlBlock final : public ControlBlock<RefCount>
+{
+public:
+    /**
+     * @brief Create control block constructing the data in place.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     *
+     * @param[in] allocator Reference to the allocator of the block.
+     * @param[in] args      The arguments to pass to the constructor of T.
+     */
+    template <typename... Args>
+    explicit InlineControlBlock(Allocator& allocator, Args&&... args) noexcept;
+
+    /**
+     * @brief Delete control block. The data has been destroyed by then.
+     */
+    ~InlineControlBlock() noexcept override {}
+
+    /**
+     * @brief Get the data held by the block.
+     *
+     * @return Pointer to the data.
+     */
+    T* data() noexcept;
+
+private:
+    void destroyData() noexcept override;
+    void destroyBlock() noexcept override;
+
+    /** Pointer to the allocator of the block. */
+    Allocator* myAllocator;
+
+    /** The data, constructed and destroyed explicitly. */
+    union { T myData; };
+};
+} // namespace memory
+
+#include "impl/control_block_impl.h"
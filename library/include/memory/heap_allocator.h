@@ -0,0 +1,51 @@
+/**
+ * @brief Allocator using the heap, i.e. the default allocator of containers.
+ */
+#pragma once
+
+#include "memory/allocator.h"
+
+namespace memory
+{
+/**
+ * @brief Allocator using the heap.
+ *
+ *        Each allocation is a separate call to malloc, which costs a block header and
+ *        fragments the heap when blocks of different sizes are allocated and released.
+ */
+class HeapAllocator final : public Allocator
+{
+public:
+    /**
+     * @brief Create heap allocator.
+     */
+    HeapAllocator() noexcept = default;
+
+    /**
+     * @brief Allocate memory on the heap.
+     *
+     * @param[in] size The number of bytes to allocate.
+     *
+     * @return Pointer to the allocated memory, or nullptr if the allocation failed.
+     */
+    void* allocate(size_t size) noexcept override;
+
+    /**
+     * @brief Release memory allocated on the heap.
+     *
+     * @param[in] block Pointer to the memory to release. Null pointers are ignored.
+     */
+    void deallocate(void* block) noexcept override;
+
+    /**
+     * @brief Resize memory allocated on the heap via realloc, possibly in place.
+     *
+     * @param[in] block   Pointer to the memory to resize, or nullptr to allocate new memory.
+     * @param[in] size    The number of bytes of the content to preserve (unused).
+     * @param[in] newSize The new size in bytes.
+     *
+     * @return Pointer to the resized memory, or nullptr if the reallocation failed.
+     */
+    void* reallocate(void* block, size_t size, size_t newSize) noexcept override;
+};
+} // namespace memory
@@ -0,0 +1,17 @@
+/**
+ * @brief Implementation details of the allocator interface.
+ *
+ * @note Don't include this header, use <allocator.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename AllocatorType>
+AllocatorType& defaultAllocator() noexcept
+{
+    static AllocatorType myInstance{};
+    return myInstance;
+}
+} // namespace memory
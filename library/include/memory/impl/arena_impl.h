@@ -0,0 +1,17 @@
+/**
+ * @brief Implementation details of class memory::StaticArena.
+ *
+ * @note Don't include this header, use <arena.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <size_t Size>
+StaticArena<Size>::StaticArena() noexcept
+    : Arena{this->myStorage, Size}
+{
+    static_assert(Size > 0U, "Static arenas must have a size greater than 0!");
+}
+} // namespace memory
@@ -0,0 +1,120 @@
+/**
+ * @brief Implementation details of control blocks of shared and weak pointers.
+ *
+ * @note Don't include this header, use <shared_ptr.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+void AllocatorDeleter<T, Allocator>::operator()(T* data) const noexcept
+{
+    utils::destroy(data);
+    allocator->deallocate(data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+ControlBlock<RefCount>::ControlBlock() noexcept
+    : myOwnerCount{1U}
+    , myObserverCount{1U} {}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+void ControlBlock<RefCount>::addOwner() noexcept { RefCount::increment(myOwnerCount); }
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+bool ControlBlock<RefCount>::addOwnerIfAlive() noexcept
+{
+    return RefCount::incrementIfNonZero(myOwnerCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+void ControlBlock<RefCount>::releaseOwner() noexcept
+{
+    // The owners together hold one observer count, which keeps the block alive for weak pointers.
+    if (RefCount::decrement(myOwnerCount) == 0U)
+    {
+        destroyData();
+        releaseObserver();
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+void ControlBlock<RefCount>::addObserver() noexcept { RefCount::increment(myObserverCount); }
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+void ControlBlock<RefCount>::releaseObserver() noexcept
+{
+    if (RefCount::decrement(myObserverCount) == 0U) { destroyBlock(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+size_t ControlBlock<RefCount>::ownerCount() const noexcept
+{
+    return RefCount::load(myOwnerCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter, typename Allocator, typename RefCount>
+SeparateControlBlock<T, Deleter, Allocator, RefCount>::SeparateControlBlock(
+    T* data, const Deleter& deleter, Allocator& allocator) noexcept
+    : ControlBlock<RefCount>{}
+    , myData{data}
+    , myDeleter{deleter}
+    , myAllocator{&allocator} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter, typename Allocator, typename RefCount>
+void SeparateControlBlock<T, Deleter, Allocator, RefCount>::destroyData() noexcept
+{
+    myDeleter(myData);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter, typename Allocator, typename RefCount>
+void SeparateControlBlock<T, Deleter, Allocator, RefCount>::destroyBlock() noexcept
+{
+    auto allocator{myAllocator};
+    utils::destroy(this);
+    allocator->deallocate(this);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+template <typename... Args>
+InlineControlBlock<T, Allocator, RefCount>::InlineControlBlock(Allocator& allocator,
+                                                               Args&&... args) noexcept
+    : ControlBlock<RefCount>{}
+    , myAllocator{&allocator}
+{
+    utils::construct(&myData, utils::forward<Args>(args)...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+T* InlineControlBlock<T, Allocator, RefCount>::data() noexcept { return &myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+void InlineControlBlock<T, Allocator, RefCount>::destroyData() noexcept
+{
+    utils::destroy(&myData);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+void InlineControlBlock<T, Allocator, RefCount>::destroyBlock() noexcept
+{
+    auto allocator{myAllocator};
+    utils::destroy(this);
+    allocator->deallocate(this);
+}
+} // namespace memory
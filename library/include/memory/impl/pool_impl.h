@@ -0,0 +1,25 @@
+/**
+ * @brief Implementation details of class memory::StaticPool.
+ *
+ * @note Don't include this header, use <pool.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t BlockCount>
+StaticPool<BlockSize, BlockCount>::StaticPool() noexcept
+    : Pool{this->myStorage, storageSize(), BlockSize}
+{
+    static_assert(BlockSize > 0U, "Static pools must have a block size greater than 0!");
+    static_assert(BlockCount > 0U, "Static pools must have a block count greater than 0!");
+}
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t BlockCount>
+constexpr size_t StaticPool<BlockSize, BlockCount>::storageSize() noexcept
+{
+    return Pool::alignedBlockSize(BlockSize) * BlockCount + Pool::flagsSize(BlockCount);
+}
+} // namespace memory
@@ -0,0 +1,29 @@
+/**
+ * @brief Implementation details of plain reference counts.
+ *
+ * @note Don't include this header, use <ref_count.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+namespace refcount
+{
+// -----------------------------------------------------------------------------
+inline void Plain::increment(size_t& count) noexcept { ++count; }
+
+// -----------------------------------------------------------------------------
+inline bool Plain::incrementIfNonZero(size_t& count) noexcept
+{
+    if (count == 0U) { return false; }
+    ++count;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+inline size_t Plain::decrement(size_t& count) noexcept { return --count; }
+
+// -----------------------------------------------------------------------------
+inline size_t Plain::load(const size_t& count) noexcept { return count; }
+} // namespace refcount
+} // namespace memory
@@ -1,7 +1,7 @@
 /**
  * @brief Implementation details of class memory::SharedPtr and associated
  *        factory functions.
- * 
+ *
  * @note Don't include this header, use <shared_ptr.h> instead!
  */
 #pragma once
@@ -10,143 +10,207 @@ namespace memory
 {
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(T* data) noexcept
-    : myData{data}
-    , myRefCount{newRefCount()} {}
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(T* data) noexcept
+    : SharedPtr{data, defaultAllocator<Allocator>()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(T* data, Allocator& allocator) noexcept
+    : SharedPtr{data, AllocatorDeleter<T, Allocator>{&allocator}, allocator} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(const SharedPtr<T>& other) noexcept
+template <typename T, typename Allocator, typename RefCount>
+template <typename Deleter>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(T* data, const Deleter& deleter) noexcept
+    : SharedPtr{data, deleter, defaultAllocator<Allocator>()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+template <typename Deleter>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(T* data, const Deleter& deleter,
+                                             Allocator& allocator) noexcept
+    : myData{nullptr}
+    , myBlock{nullptr}
+    , myAllocator{&allocator}
+{
+    createBlock(data, deleter);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(const SharedPtr& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount} 
+    , myBlock{other.myBlock}
+    , myAllocator{other.myAllocator}
 {
-    (*myRefCount)++;
+    if (myBlock) { myBlock->addOwner(); }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(SharedPtr<T>&& other) noexcept
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(SharedPtr&& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount}
+    , myBlock{other.myBlock}
+    , myAllocator{other.myAllocator}
 {
-    other.myData     = nullptr;
-    other.myRefCount = nullptr;
+    other.myData  = nullptr;
+    other.myBlock = nullptr;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::~SharedPtr() noexcept { reset(); }
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::~SharedPtr() noexcept { release(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr<T>& other) noexcept
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>&
+    SharedPtr<T, Allocator, RefCount>::operator=(const SharedPtr& other) noexcept
 {
     if (this != &other)
     {
+        // Add the owner before releasing, in case both pointers are the last owners.
+        if (other.myBlock) { other.myBlock->addOwner(); }
         release();
-        myData = other.myData;
-        myRefCount = other.myRefCount;
-        (*myRefCount)++;
+        myData      = other.myData;
+        myBlock     = other.myBlock;
+        myAllocator = other.myAllocator;
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr<T>&& other) noexcept
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>&
+    SharedPtr<T, Allocator, RefCount>::operator=(SharedPtr&& other) noexcept
 {
     if (this != &other)
     {
         release();
-        myData           = other.myData;
-        myRefCount       = other.myRefCount;
-        other.myData     = nullptr;
-        other.myRefCount = nullptr;
+        myData        = other.myData;
+        myBlock       = other.myBlock;
+        myAllocator   = other.myAllocator;
+        other.myData  = nullptr;
+        other.myBlock = nullptr;
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::operator bool() const { return myData != nullptr; }
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::operator bool() const { return myData != nullptr; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& SharedPtr<T>::operator*() noexcept { return *myData; }
+template <typename T, typename Allocator, typename RefCount>
+T& SharedPtr<T, Allocator, RefCount>::operator*() noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& SharedPtr<T>::operator*() const noexcept { return *myData; }
+template <typename T, typename Allocator, typename RefCount>
+const T& SharedPtr<T, Allocator, RefCount>::operator*() const noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::operator->() noexcept { return myData; }
+template <typename T, typename Allocator, typename RefCount>
+T* SharedPtr<T, Allocator, RefCount>::operator->() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* SharedPtr<T>::operator->() const noexcept { return myData; }
+template <typename T, typename Allocator, typename RefCount>
+const T* SharedPtr<T, Allocator, RefCount>::operator->() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::get() noexcept { return myData; }
+template <typename T, typename Allocator, typename RefCount>
+T* SharedPtr<T, Allocator, RefCount>::get() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* SharedPtr<T>::get() const noexcept { return myData; }
+template <typename T, typename Allocator, typename RefCount>
+const T* SharedPtr<T, Allocator, RefCount>::get() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::reset(T* newData) noexcept
+template <typename T, typename Allocator, typename RefCount>
+void SharedPtr<T, Allocator, RefCount>::reset(T* newData) noexcept
 {
     release();
-    myData     = newData;
-    myRefCount = newRefCount();
+    createBlock(newData, AllocatorDeleter<T, Allocator>{myAllocator});
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::release() noexcept
+template <typename T, typename Allocator, typename RefCount>
+T* SharedPtr<T, Allocator, RefCount>::release() noexcept
 {
-    decrementReferenceCount();
-    myData     = nullptr;
-    myRefCount = nullptr;
+    if (myBlock) { myBlock->releaseOwner(); }
+    myData  = nullptr;
+    myBlock = nullptr;
     return nullptr;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t* SharedPtr<T>::newRefCount() noexcept { return new size_t{1U}; }
-
-// -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::decrementReferenceCount() noexcept
+template <typename T, typename Allocator, typename RefCount>
+size_t SharedPtr<T, Allocator, RefCount>::useCount() const noexcept
 {
-    if (myRefCount && (--(*myRefCount) == 0U)) { releaseMemory(); }
+    return myBlock ? myBlock->ownerCount() : 0U;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::releaseMemory() noexcept
+template <typename T, typename Allocator, typename RefCount>
+Allocator& SharedPtr<T, Allocator, RefCount>::allocator() const noexcept { return *myAllocator; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount>::SharedPtr(T* data, Block* block,
+                                             Allocator& allocator) noexcept
+    : myData{data}
+    , myBlock{block}
+    , myAllocator{&allocator} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+template <typename Deleter>
+void SharedPtr<T, Allocator, RefCount>::createBlock(T* data, const Deleter& deleter) noexcept
 {
-    utils::deleteMemory(myData);
-    utils::deleteMemory(myRefCount);
-    myData     = nullptr;
-    myRefCount = nullptr;
+    if (data == nullptr) { return; }
+    using SeparateBlock = SeparateControlBlock<T, Deleter, Allocator, RefCount>;
+    auto block{static_cast<SeparateBlock*>(myAllocator->allocate(sizeof(SeparateBlock)))};
+
+    // Delete the data if the control block can't be allocated, since it can't be shared.
+    if (block == nullptr)
+    {
+        deleter(data);
+        return;
+    }
+    myData  = data;
+    myBlock = utils::construct(block, data, deleter, *myAllocator);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T, typename... Args>
-SharedPtr<T> makeShared(Args&&... args) noexcept
+template <typename T, typename RefCount, typename... Args>
+SharedPtr<T, HeapAllocator, RefCount> makeShared(Args&&... args) noexcept
 {
-    return SharedPtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return allocateShared<T, RefCount>(defaultAllocator<HeapAllocator>(),
+                                       utils::forward<Args>(args)...);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 SharedPtr<T> makeShared() noexcept
 {
+    static_assert(type_traits::is_trivially_copyable<T>::value,
+                  "Fields can only hold trivially copyable types!");
     return SharedPtr<T>{utils::newMemory<T>(Size)};
 }
 
-} // namespace memory
\ No newline at end of file
+// -----------------------------------------------------------------------------
+template <typename T, typename RefCount, typename Allocator, typename... Args>
+SharedPtr<T, Allocator, RefCount> allocateShared(Allocator& allocator, Args&&... args) noexcept
+{
+    // Allocate the control block and the object at once, the object is part of the block.
+    using InlineBlock = InlineControlBlock<T, Allocator, RefCount>;
+    auto block{static_cast<InlineBlock*>(allocator.allocate(sizeof(InlineBlock)))};
+    if (block == nullptr) { return SharedPtr<T, Allocator, RefCount>{nullptr, allocator}; }
+
+    utils::construct(block, allocator, utils::forward<Args>(args)...);
+
+    // Pass the block as a base pointer, else the deleter constructor would be a better match.
+    ControlBlock<RefCount>* const base{block};
+    return SharedPtr<T, Allocator, RefCount>{block->data(), base, allocator};
+}
+
+} // namespace memory
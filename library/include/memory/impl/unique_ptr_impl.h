@@ -10,91 +10,118 @@ namespace memory
 {
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::UniquePtr(T* data) noexcept
-    : myData{data} {}
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>::UniquePtr(T* data) noexcept
+    : UniquePtr{data, defaultAllocator<Allocator>()} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::UniquePtr(UniquePtr<T>&& other) noexcept
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>::UniquePtr(T* data, Allocator& allocator) noexcept
+    : myData{data}
+    , myAllocator{&allocator} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>::UniquePtr(UniquePtr<T, Allocator>&& other) noexcept
     : myData{other.myData} 
+    , myAllocator{other.myAllocator}
 { 
     other.myData = nullptr; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::~UniquePtr() noexcept { reset(); }
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>::~UniquePtr() noexcept { reset(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>& UniquePtr<T>::operator=(UniquePtr<T>&& other) noexcept
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>& UniquePtr<T, Allocator>::operator=(UniquePtr<T, Allocator>&& other) noexcept
 {
     if (this != &other)
     {
         reset(other.myData);
+        myAllocator  = other.myAllocator;
         other.myData = nullptr;
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::operator bool() const { return myData != nullptr; }
+template <typename T, typename Allocator>
+UniquePtr<T, Allocator>::operator bool() const { return myData != nullptr; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& UniquePtr<T>::operator*() noexcept { return *myData; }
+template <typename T, typename Allocator>
+T& UniquePtr<T, Allocator>::operator*() noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& UniquePtr<T>::operator*() const noexcept { return *myData; }
+template <typename T, typename Allocator>
+const T& UniquePtr<T, Allocator>::operator*() const noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::operator->() noexcept { return myData; }
+template <typename T, typename Allocator>
+T* UniquePtr<T, Allocator>::operator->() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* UniquePtr<T>::operator->() const noexcept { return myData; }
+template <typename T, typename Allocator>
+const T* UniquePtr<T, Allocator>::operator->() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::get() noexcept { return myData; }
+template <typename T, typename Allocator>
+T* UniquePtr<T, Allocator>::get() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* UniquePtr<T>::get() const noexcept { return myData; }
+template <typename T, typename Allocator>
+const T* UniquePtr<T, Allocator>::get() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void UniquePtr<T>::reset(T* newData) noexcept
+template <typename T, typename Allocator>
+void UniquePtr<T, Allocator>::reset(T* newData) noexcept
 {
-    utils::deleteMemory(myData);
+    if (myData != nullptr)
+    {
+        utils::destroy(myData);
+        myAllocator->deallocate(myData);
+    }
     myData = newData;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::release() noexcept
+template <typename T, typename Allocator>
+T* UniquePtr<T, Allocator>::release() noexcept
 {
     T* copy{myData};
     myData = nullptr;
     return copy;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+Allocator& UniquePtr<T, Allocator>::allocator() const noexcept { return *myAllocator; }
+
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
-UniquePtr<T> makeUnique(Args&&... args)
+UniquePtr<T> makeUnique(Args&&... args) noexcept
 {
-    return UniquePtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return UniquePtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-UniquePtr<T> makeUnique()
+UniquePtr<T> makeUnique() noexcept
 {
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+                  "Fields can only hold trivially copyable types!");
     return UniquePtr<T>{utils::newMemory<T>(Size)};
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename... Args>
+UniquePtr<T, Allocator> allocateUnique(Allocator& allocator, Args&&... args) noexcept
+{
+    auto data{static_cast<T*>(allocator.allocate(sizeof(T)))};
+    if (data != nullptr) { utils::construct(data, utils::forward<Args>(args)...); }
+    return UniquePtr<T, Allocator>{data, allocator};
+}
+
 } // namespace memory
\ No newline at end of file
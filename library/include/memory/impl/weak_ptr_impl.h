@@ -0,0 +1,117 @@
+/**
+ * @brief Implementation details of class memory::WeakPtr.
+ *
+ * @note Don't include this header, use <weak_ptr.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>::WeakPtr() noexcept
+    : myData{nullptr}
+    , myBlock{nullptr}
+    , myAllocator{&defaultAllocator<Allocator>()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>::WeakPtr(const SharedPtr<T, Allocator, RefCount>& shared) noexcept
+    : myData{shared.myData}
+    , myBlock{shared.myBlock}
+    , myAllocator{shared.myAllocator}
+{
+    if (myBlock) { myBlock->addObserver(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>::WeakPtr(const WeakPtr& other) noexcept
+    : myData{other.myData}
+    , myBlock{other.myBlock}
+    , myAllocator{other.myAllocator}
+{
+    if (myBlock) { myBlock->addObserver(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>::WeakPtr(WeakPtr&& other) noexcept
+    : myData{other.myData}
+    , myBlock{other.myBlock}
+    , myAllocator{other.myAllocator}
+{
+    other.myData  = nullptr;
+    other.myBlock = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>::~WeakPtr() noexcept { reset(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>&
+    WeakPtr<T, Allocator, RefCount>::operator=(const WeakPtr& other) noexcept
+{
+    if (this != &other)
+    {
+        // Add the observer before releasing, in case both pointers are the last observers.
+        if (other.myBlock) { other.myBlock->addObserver(); }
+        reset();
+        myData      = other.myData;
+        myBlock     = other.myBlock;
+        myAllocator = other.myAllocator;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+WeakPtr<T, Allocator, RefCount>&
+    WeakPtr<T, Allocator, RefCount>::operator=(WeakPtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        myData        = other.myData;
+        myBlock       = other.myBlock;
+        myAllocator   = other.myAllocator;
+        other.myData  = nullptr;
+        other.myBlock = nullptr;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+bool WeakPtr<T, Allocator, RefCount>::expired() const noexcept { return useCount() == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+SharedPtr<T, Allocator, RefCount> WeakPtr<T, Allocator, RefCount>::lock() const noexcept
+{
+    // Only add an owner if the data is still alive, else it's already been destroyed.
+    if (myBlock && myBlock->addOwnerIfAlive())
+    {
+        return SharedPtr<T, Allocator, RefCount>{myData, myBlock, *myAllocator};
+    }
+    return SharedPtr<T, Allocator, RefCount>{nullptr, *myAllocator};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+size_t WeakPtr<T, Allocator, RefCount>::useCount() const noexcept
+{
+    return myBlock ? myBlock->ownerCount() : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename RefCount>
+void WeakPtr<T, Allocator, RefCount>::reset() noexcept
+{
+    if (myBlock) { myBlock->releaseObserver(); }
+    myData  = nullptr;
+    myBlock = nullptr;
+}
+} // namespace memory
@@ -0,0 +1,232 @@
+/**
+ * @brief Fixed-block memory pools, used to allocate container nodes without the heap.
+ */
+#pragma once
+
+#include "memory/allocator.h"
+
+namespace memory
+{
+/**
+ * @brief Fixed-block memory pool.
+ *
+ *        The pool divides a buffer into blocks of equal size. Released blocks are kept in an
+ *        intrusive free list, so both allocation and release are O(1) and the pool never
+ *        fragments. Blocks that have never been used are handed out in order, which means the
+ *        buffer doesn't have to be initialized when the pool is created. One bit per block is
+ *        reserved at the end of the buffer to track the blocks in use, so that invalid
+ *        releases such as double frees can be rejected.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Pool : public Allocator
+{
+public:
+    /**
+     * @brief Create pool dividing the given buffer into blocks.
+     *
+     *        The block size is rounded up to fit a pointer and to keep every block aligned.
+     *        Bytes before the first aligned address of the buffer are left unused, and one bit
+     *        per block is reserved after the blocks.
+     *
+     * @param[in] buffer     Pointer to the buffer to allocate blocks from.
+     * @param[in] bufferSize The size of the buffer in bytes.
+     * @param[in] blockSize  The size of each block in bytes.
+     */
+    Pool(void* buffer, size_t bufferSize, size_t blockSize) noexcept;
+
+    /**
+     * @brief Delete pool. Blocks still in use are invalidated together with the buffer.
+     */
+    ~Pool() noexcept override = default;
+
+    /**
+     * @brief Allocate a block.
+     *
+     * @param[in] size The number of bytes to allocate. Must not exceed the block size.
+     *
+     * @return Pointer to the allocated block, or nullptr if the requested size is too large
+     *         or if all blocks are in use.
+     */
+    void* allocate(size_t size) noexcept override final;
+
+    /**
+     * @brief Release a block allocated from this pool.
+     *
+     * @param[in] block Pointer to the block to release. Null pointers, pointers outside the
+     *                  pool, pointers not pointing at the start of a block, and blocks not in
+     *                  use, e.g. double frees, are ignored.
+     */
+    void deallocate(void* block) noexcept override final;
+
+    /**
+     * @brief Resize a block allocated from this pool, which is only possible within the block.
+     *
+     * @param[in] block   Pointer to the block to resize, or nullptr to allocate a new block.
+     * @param[in] size    The number of bytes of the content to preserve (unused).
+     * @param[in] newSize The new size in bytes.
+     *
+     * @return Pointer to the block, or nullptr if the new size exceeds the block size.
+     */
+    void* reallocate(void* block, size_t size, size_t newSize) noexcept override final;
+
+    /**
+     * @brief Check whether given memory belongs to this pool.
+     *
+     * @param[in] block Pointer to the memory to check.
+     *
+     * @return True if the memory is located in the buffer of this pool, false otherwise.
+     */
+    bool owns(const void* block) const noexcept;
+
+    /**
+     * @brief Get the size of each block.
+     *
+     * @return The block size in bytes, after rounding.
+     */
+    size_t blockSize() const noexcept;
+
+    /**
+     * @brief Get the number of blocks of the pool.
+     *
+     * @return The total number of blocks.
+     */
+    size_t blockCount() const noexcept;
+
+    /**
+     * @brief Get the number of blocks in use.
+     *
+     * @return The number of allocated blocks.
+     */
+    size_t usedCount() const noexcept;
+
+    /**
+     * @brief Get the max number of blocks in use at the same time since the pool was created.
+     *
+     * @return The peak number of allocated blocks.
+     */
+    size_t peakUsedCount() const noexcept;
+
+    /**
+     * @brief Check whether all blocks are in use.
+     *
+     * @return True if the pool is exhausted, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Get the size of blocks after rounding.
+     *
+     * @param[in] blockSize The requested block size in bytes.
+     *
+     * @return The block size rounded up to fit a pointer and to keep every block aligned.
+     */
+    static constexpr size_t alignedBlockSize(const size_t blockSize) noexcept
+    {
+        const size_t size{blockSize < sizeof(void*) ? sizeof(void*) : blockSize};
+        return (size + alignof(max_align_t) - 1U) / alignof(max_align_t) * alignof(max_align_t);
+    }
+
+    /**
+     * @brief Get the number of bytes reserved to track the blocks in use.
+     *
+     * @param[in] blockCount The number of blocks.
+     *
+     * @return The number of bytes holding one bit per block.
+     */
+    static constexpr size_t flagsSize(const size_t blockCount) noexcept
+    {
+        return (blockCount + 7U) / 8U;
+    }
+
+    Pool()                       = delete; // No default constructor.
+    Pool(const Pool&)            = delete; // No copy constructor.
+    Pool(Pool&&)                 = delete; // No move constructor.
+    Pool& operator=(const Pool&) = delete; // No copy assignment.
+    Pool& operator=(Pool&&)      = delete; // No move assignment.
+
+private:
+    /** Released block, linked to the next released block. */
+    struct FreeBlock { FreeBlock* next; };
+
+    /**
+     * @brief Get the index of a block.
+     *
+     * @param[in] block Pointer to the start of a block of this pool.
+     *
+     * @return The index of the block in the buffer.
+     */
+    size_t blockIndex(const void* block) const noexcept;
+
+    /**
+     * @brief Check whether a touched block is in use.
+     *
+     * @param[in] index The index of the block.
+     *
+     * @return True if the block is in use, false if it has been released.
+     */
+    bool isUsed(size_t index) const noexcept;
+
+    /**
+     * @brief Mark a touched block as used or released.
+     *
+     * @param[in] index The index of the block.
+     * @param[in] used  True to mark the block as used, false to mark it as released.
+     */
+    void setUsed(size_t index, bool used) noexcept;
+
+    /** Pointer to the first block of the buffer. */
+    uint8_t* myBuffer;
+
+    /** Pointer to the flags after the blocks, one bit per block set while the block is used. */
+    uint8_t* myUsedFlags;
+
+    /** Pointer to the most recently released block. */
+    FreeBlock* myFreeList;
+
+    /** The size of each block in bytes. */
+    size_t myBlockSize;
+
+    /** The total number of blocks. */
+    size_t myBlockCount;
+
+    /** The number of blocks handed out from the buffer so far, used or released. */
+    size_t myTouchedCount;
+
+    /** The number of blocks in use. */
+    size_t myUsedCount;
+
+    /** The peak number of blocks in use. */
+    size_t myPeakUsedCount;
+};
+
+/**
+ * @brief Fixed-block memory pool with static storage.
+ *
+ *        The blocks are stored inline, so the memory of the pool is reserved at compile time
+ *        when the pool is declared as a global or static object.
+ *
+ * @tparam BlockSize  The size of each block in bytes.
+ * @tparam BlockCount The number of blocks of the pool.
+ */
+template <size_t BlockSize, size_t BlockCount>
+class StaticPool final 
+    : private StaticStorage<Pool::alignedBlockSize(BlockSize) * BlockCount
+                            + Pool::flagsSize(BlockCount)>, public Pool
+{
+public:
+    /**
+     * @brief Create pool with static storage.
+     */
+    StaticPool() noexcept;
+
+    /**
+     * @brief Get the size of the pool storage.
+     *
+     * @return The number of bytes reserved by the pool.
+     */
+    static constexpr size_t storageSize() noexcept;
+};
+} // namespace memory
+
+#include "impl/pool_impl.h"
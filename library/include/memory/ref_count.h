@@ -0,0 +1,99 @@
+/**
+ * @brief Reference count policies of shared pointers.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace memory
+{
+namespace refcount
+{
+/**
+ * @brief Plain reference count, for pointers only shared within one execution context.
+ */
+struct Plain
+{
+    /**
+     * @brief Increment given count.
+     *
+     * @param[in, out] count Reference to the count.
+     */
+    static void increment(size_t& count) noexcept;
+
+    /**
+     * @brief Increment given count unless it's zero.
+     *
+     * @param[in, out] count Reference to the count.
+     *
+     * @return True if the count was incremented, false if it's zero.
+     */
+    static bool incrementIfNonZero(size_t& count) noexcept;
+
+    /**
+     * @brief Decrement given count.
+     *
+     * @param[in, out] count Reference to the count.
+     *
+     * @return The decremented count.
+     */
+    static size_t decrement(size_t& count) noexcept;
+
+    /**
+     * @brief Read given count.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The count.
+     */
+    static size_t load(const size_t& count) noexcept;
+};
+
+/**
+ * @brief Interrupt-guarded reference count, for pointers shared between interrupt service
+ *        routines and the main loop.
+ *
+ *        Interrupts are disabled while a count is updated, since updating a count of more
+ *        than one byte takes several instructions on AVR. The global interrupt flag is
+ *        restored afterwards, so the count can also be updated from interrupt service routines.
+ */
+struct Guarded
+{
+    /**
+     * @brief Increment given count with interrupts disabled.
+     *
+     * @param[in, out] count Reference to the count.
+     */
+    static void increment(size_t& count) noexcept;
+
+    /**
+     * @brief Increment given count unless it's zero, with interrupts disabled.
+     *
+     * @param[in, out] count Reference to the count.
+     *
+     * @return True if the count was incremented, false if it's zero.
+     */
+    static bool incrementIfNonZero(size_t& count) noexcept;
+
+    /**
+     * @brief Decrement given count with interrupts disabled.
+     *
+     * @param[in, out] count Reference to the count.
+     *
+     * @return The decremented count.
+     */
+    static size_t decrement(size_t& count) noexcept;
+
+    /**
+     * @brief Read given count with interrupts disabled.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The count.
+     */
+    static size_t load(const size_t& count) noexcept;
+};
+} // namespace refcount
+} // namespace memory
+
+#include "impl/ref_count_impl.h"
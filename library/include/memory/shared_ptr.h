@@ -3,162 +3,275 @@
  */
 #pragma once
 
+#include "memory/control_block.h"
+#include "memory/heap_allocator.h"
+#include "memory/ref_count.h"
 #include "utils/utils.h"
 
 namespace memory
 {
+template <typename T, typename Allocator, typename RefCount>
+class WeakPtr;
+
 /**
  * @brief Shared pointer implementation.
- * 
- * @tparam T The pointer type.
+ *
+ *        Pointers sharing ownership of data share a control block holding the reference counts.
+ *        The data is deleted when the last pointer sharing ownership of it is released, by
+ *        default by destroying it and releasing its memory with the allocator of the pointer.
+ *
+ *        Use makeShared() or allocateShared() to allocate the data and the control block at
+ *        once. Pointers created from raw pointers allocate the control block separately.
+ *
+ * @tparam T         The pointer type.
+ * @tparam Allocator The allocator of the held data and the control block (default = heap).
+ * @tparam RefCount  The reference count policy (default = plain). Use refcount::Guarded for
+ *                   pointers shared between interrupt service routines and the main loop.
  */
-template <typename T>
+template <typename T, typename Allocator = HeapAllocator, typename RefCount = refcount::Plain>
 class SharedPtr final
 {
 public:
     /**
      * @brief Create new shared pointer.
-     * 
-     * @param[in] data Pointer to data for which to take ownership (default = none).
+     *
+     *        The pointer is empty if the control block can't be allocated, in which case
+     *        the data is deleted.
+     *
+     * @param[in] data Pointer to data for which to take ownership (default = none). The data
+     *                 must be allocated by the default instance of the allocator type.
      */
     SharedPtr(T* data = nullptr) noexcept;
 
+    /**
+     * @brief Create new shared pointer holding data allocated by given allocator.
+     *
+     *        The pointer is empty if the control block can't be allocated, in which case
+     *        the data is deleted.
+     *
+     * @param[in] data      Pointer to data for which to take ownership.
+     * @param[in] allocator Reference to the allocator of the data and the control block,
+     *                      which must outlive the pointer.
+     */
+    SharedPtr(T* data, Allocator& allocator) noexcept;
+
+    /**
+     * @brief Create new shared pointer holding data deleted by given deleter.
+     *
+     *        The pointer is empty if the control block can't be allocated, in which case
+     *        the data is deleted.
+     *
+     * @tparam Deleter The type of the deleter, called with a pointer to the data.
+     *
+     * @param[in] data    Pointer to data for which to take ownership.
+     * @param[in] deleter The deleter to call once the last owner is released.
+     */
+    template <typename Deleter>
+    SharedPtr(T* data, const Deleter& deleter) noexcept;
+
+    /**
+     * @brief Create new shared pointer holding data deleted by given deleter.
+     *
+     *        The pointer is empty if the control block can't be allocated, in which case
+     *        the data is deleted.
+     *
+     * @tparam Deleter The type of the deleter, called with a pointer to the data.
+     *
+     * @param[in] data      Pointer to data for which to take ownership.
+     * @param[in] deleter   The deleter to call once the last owner is released.
+     * @param[in] allocator Reference to the allocator of the control block, which must outlive
+     *                      the pointer.
+     */
+    template <typename Deleter>
+    SharedPtr(T* data, const Deleter& deleter, Allocator& allocator) noexcept;
+
     /**
      * @brief Create new shared pointer, which shares ownership with another pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to copy from.
      */
-    SharedPtr(const SharedPtr<T>& other) noexcept;
+    SharedPtr(const SharedPtr& other) noexcept;
 
     /**
      * @brief Create new shared pointer, which takes ownership over memory owned by other pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to move memory from.
      */
-    SharedPtr(SharedPtr<T>&& other) noexcept;
+    SharedPtr(SharedPtr&& other) noexcept;
 
     /**
      * @brief Release allocated resources before deletion.
-     * 
+     *
      * @note Deletion only occurs if this is the last pointer to point at the shared memory.
      */
     ~SharedPtr() noexcept;
 
     /**
      * @brief Copy resources from other shared pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to copy from.
-     * 
+     *
      * @return Reference to this shared pointer.
      */
-    SharedPtr<T>& operator=(const SharedPtr<T>& other) noexcept;
-   
+    SharedPtr& operator=(const SharedPtr& other) noexcept;
+
     /**
      * @brief Move resources from other shared pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to move memory from.
-     * 
+     *
      * @return Reference to this shared pointer.
      */
-    SharedPtr<T>& operator=(SharedPtr<T>&& other) noexcept;
+    SharedPtr& operator=(SharedPtr&& other) noexcept;
 
     /**
      * @brief Check if the pointer isn't null.
-     * 
+     *
      * @return True if the pointer isn't null, false otherwise.
      */
     operator bool() const;
 
     /**
      * @brief Overload of operator * to provide held data.
-     * 
+     *
      * @return Reference to held data.
      */
     T& operator*() noexcept;
-    
+
     /**
      * @brief Overload of operator * to provide held data.
-     * 
+     *
      * @return Reference to held data.
      */
     const T& operator*() const noexcept;
-    
+
     /**
      * @brief Overload of operator -> to provide held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     T* operator->() noexcept;
 
     /**
      * @brief Overload of operator -> to provide held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     const T* operator->() const noexcept;
 
     /**
      * @brief Get pointer to held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     T* get() noexcept;
 
     /**
      * @brief Get pointer to held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     const T* get() const noexcept;
 
     /**
      * @brief Reset shared pointer by releasing currently held data.
-     * 
-     * @param[in] newData Pointer to new data to take ownership over (default = none).
+     *
+     * @param[in] newData Pointer to new data to take ownership over (default = none). The data
+     *                    must be allocated by the allocator of this pointer.
      */
     void reset(T* newData = nullptr) noexcept;
 
     /**
-     * @brief Release ownership over held data.
-     * 
-     * @return Pointer to currently held data.
+     * @brief Release this pointer's share of the ownership over held data.
+     *
+     *        The data is deleted if this was the last pointer sharing ownership of it.
+     *
+     * @return Always nullptr, since the data may be deleted or still owned by other pointers.
      */
     T* release() noexcept;
 
+    /**
+     * @brief Get the number of pointers sharing ownership of held data.
+     *
+     * @return The number of owners, or 0 if the pointer is empty.
+     */
+    size_t useCount() const noexcept;
+
+    /**
+     * @brief Get the allocator of the pointer.
+     *
+     * @return Reference to the allocator.
+     */
+    Allocator& allocator() const noexcept;
+
 private:
+    friend class WeakPtr<T, Allocator, RefCount>;
+
+    template <typename U, typename R, typename A, typename... Args>
+    friend SharedPtr<U, A, R> allocateShared(A& allocator, Args&&... args) noexcept;
+
+    /** Control block of the pointer. */
+    using Block = ControlBlock<RefCount>;
 
-    static size_t* newRefCount() noexcept;
-    void decrementReferenceCount() noexcept;
-    void releaseMemory() noexcept;
+    SharedPtr(T* data, Block* block, Allocator& allocator) noexcept;
+    template <typename Deleter>
+    void createBlock(T* data, const Deleter& deleter) noexcept;
 
-    T* myData;          // Pointer to shared data/memory.
-    size_t* myRefCount; // The number of pointers sharing ownership of data.
+    T* myData;              // Pointer to shared data/memory.
+    Block* myBlock;         // Pointer to the control block holding the reference counts.
+    Allocator* myAllocator; // Pointer to the allocator of the data and the control block.
 };
 
 /**
- * @brief Create shared pointer taking ownership of given data.
- * 
- * @tparam T The pointer type.
- * @tparam Args The types of arguments to pass to the constructor of T.
- * 
+ * @brief Create shared pointer holding a new object allocated on the heap.
+ *
+ *        The object and the control block are allocated at once.
+ *
+ * @tparam T        The pointer type.
+ * @tparam RefCount The reference count policy (default = plain).
+ * @tparam Args     The types of arguments to pass to the constructor of T.
+ *
  * @param[in] args The arguments to pass to the constructor of T.
- * 
- * @return Shared pointer holding ownership over given data.
+ *
+ * @return Shared pointer holding ownership over the new object, or an empty pointer if
+ *         the allocation failed.
  */
-template <typename T, typename... Args>
-SharedPtr<T> makeShared(Args&&... args) noexcept;
+template <typename T, typename RefCount = refcount::Plain, typename... Args>
+SharedPtr<T, HeapAllocator, RefCount> makeShared(Args&&... args) noexcept;
 
 /**
  * @brief Create shared pointer pointing at new field of given size.
- * 
+ *
+ *        The field is uninitialized, hence only trivially copyable types are supported.
+ *
  * @tparam T    The pointer/field type.
  * @tparam Size The size of new field.
- * 
+ *
  * @return Shared pointer holding ownership over the new field.
  */
 template <typename T, size_t Size>
 SharedPtr<T> makeShared() noexcept;
 
+/**
+ * @brief Create shared pointer holding a new object allocated by given allocator.
+ *
+ *        The object and the control block are allocated at once.
+ *
+ * @tparam T         The pointer type.
+ * @tparam RefCount  The reference count policy (default = plain).
+ * @tparam Allocator The allocator type.
+ * @tparam Args      The types of arguments to pass to the constructor of T.
+ *
+ * @param[in] allocator Reference to the allocator, which must outlive the pointer.
+ * @param[in] args      The arguments to pass to the constructor of T.
+ *
+ * @return Shared pointer holding ownership over the new object, or an empty pointer if
+ *         the allocation failed.
+ */
+template <typename T, typename RefCount = refcount::Plain, typename Allocator, typename... Args>
+SharedPtr<T, Allocator, RefCount> allocateShared(Allocator& allocator, Args&&... args) noexcept;
+
 } // namespace memory
 
 #include "impl/shared_ptr_impl.h"
+#include "weak_ptr.h"
@@ -0,0 +1,153 @@
+/**
+ * @brief Heap and stack instrumentation.
+ *
+ *        Define MEMORY_STATS to track the heap usage of utils::newMemory(),
+ *        utils::reallocMemory() and utils::deleteMemory(), i.e. of the heap allocator and thereby
+ *        the containers and smart pointers using it. Each block is then prefixed by a header
+ *        holding its size, so that released bytes can be accounted for. Without MEMORY_STATS
+ *        the heap functions call malloc, realloc and free directly and the counters stay at 0.
+ *
+ *        The stack is monitored by painting the unused stack memory with a known pattern
+ *        at startup. The deepest stack usage since then is found by searching for the first
+ *        overwritten byte, which catches the stack usage of interrupt service routines as well.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace driver
+{
+namespace serial { class Interface; }
+} // namespace driver
+
+namespace memory
+{
+namespace stats
+{
+/** Byte pattern of painted stack memory. */
+constexpr uint8_t StackPaint{0xC5U};
+
+/**
+ * @brief Structure holding heap usage statistics.
+ */
+struct Heap
+{
+    size_t liveBytes;         // The number of allocated bytes not yet released.
+    size_t peakBytes;         // The max number of live bytes since startup or the last reset.
+    uint32_t allocationCount; // The number of successful allocations and reallocations.
+    uint32_t failureCount;    // The number of failed allocations and reallocations.
+};
+
+/**
+ * @brief Check whether the heap usage is tracked, i.e. whether MEMORY_STATS is defined.
+ *
+ * @return True if the heap usage is tracked, false otherwise.
+ */
+constexpr bool enabled() noexcept
+{
+#ifdef MEMORY_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Get the heap usage statistics.
+ *
+ * @return The heap usage statistics.
+ */
+Heap heap() noexcept;
+
+/**
+ * @brief Reset the peak usage to the live usage and clear the allocation and failure counts.
+ *
+ *        The live usage isn't affected, since the tracked blocks are still allocated.
+ */
+void resetHeap() noexcept;
+
+/**
+ * @brief Allocate tracked memory on the heap.
+ *
+ * @note Use utils::newMemory() instead, which calls this function if MEMORY_STATS is defined.
+ *
+ * @param[in] size The number of bytes to allocate.
+ *
+ * @return Pointer to the allocated memory, or nullptr if the allocation failed.
+ */
+void* allocate(size_t size) noexcept;
+
+/**
+ * @brief Resize tracked memory on the heap.
+ *
+ * @note Use utils::reallocMemory() instead, which calls this function if MEMORY_STATS is defined.
+ *
+ * @param[in] block   Pointer to the memory to resize, or nullptr to allocate new memory.
+ * @param[in] newSize The new size in bytes. The memory is released if the new size is 0.
+ *
+ * @return Pointer to the resized memory, or nullptr if the reallocation failed, in which
+ *         case the old memory is kept.
+ */
+void* reallocate(void* block, size_t newSize) noexcept;
+
+/**
+ * @brief Release tracked memory on the heap.
+ *
+ * @note Use utils::deleteMemory() instead, which calls this function if MEMORY_STATS is defined.
+ *
+ * @param[in] block Pointer to the memory to release. Null pointers are ignored.
+ */
+void release(void* block) noexcept;
+
+/**
+ * @brief Paint given memory region with the stack paint pattern.
+ *
+ * @param[in] begin Pointer to the start of the region.
+ * @param[in] end   Pointer to the end of the region (exclusive).
+ */
+void paintStack(uint8_t* begin, uint8_t* end) noexcept;
+
+/**
+ * @brief Get the max stack usage of given painted stack region.
+ *
+ *        The stack grows downwards from the end of the region, hence the usage is the
+ *        number of bytes above the lowest overwritten byte. The heap grows upwards into the
+ *        region from its start, hence the search starts at the end of the heap, if given.
+ *
+ * @param[in] begin   Pointer to the start of the region.
+ * @param[in] end     Pointer to the end of the region (exclusive).
+ * @param[in] heapEnd Pointer to the end of the heap (exclusive). Ignored if not in the region.
+ *
+ * @return The max stack usage in bytes.
+ */
+size_t stackHighWaterMark(const uint8_t* begin, const uint8_t* end,
+                          const uint8_t* heapEnd = nullptr) noexcept;
+
+/**
+ * @brief Paint the unused stack memory, i.e. the memory between the heap and the stack.
+ *
+ *        Call this function at startup. Heap memory allocated in the painted region later on
+ *        isn't reported as stack usage, since the search starts at the current end of the heap.
+ *
+ * @note The stack isn't painted on the host.
+ */
+void paintStack() noexcept;
+
+/**
+ * @brief Get the max stack usage since the stack was painted.
+ *
+ * @return The max stack usage in bytes, or 0 if the stack hasn't been painted.
+ */
+size_t stackHighWaterMark() noexcept;
+
+/**
+ * @brief Print the heap and stack usage statistics.
+ *
+ * @param[in] serial Reference to the serial device to print with.
+ *
+ * @return True if the statistics were printed, false otherwise.
+ */
+bool print(const driver::serial::Interface& serial) noexcept;
+} // namespace stats
+} // namespace memory
@@ -3,6 +3,7 @@
  */
 #pragma once
 
+#include "memory/heap_allocator.h"
 #include "utils/utils.h"
 
 namespace memory
@@ -10,11 +11,13 @@ namespace memory
 /**
  * @brief Unique pointer implementation.
  * 
- *        This class is non-copyable.
+ *        This class is non-copyable. The held data is destroyed and its memory is released
+ *        by the allocator of the pointer.
  * 
- * @tparam T The pointer type.
+ * @tparam T         The pointer type.
+ * @tparam Allocator The allocator of the held data (default = heap).
  */
-template <typename T>
+template <typename T, typename Allocator = HeapAllocator>
 class UniquePtr final
 {
 public:
@@ -22,16 +25,25 @@ public:
     /**
      * @brief Create new unique pointer.
      * 
-     * @param[in] data Pointer to data for which to take ownership (default = none).
+     * @param[in] data Pointer to data for which to take ownership (default = none). The data 
+     *                 must be allocated by the default instance of the allocator type.
      */
     explicit UniquePtr(T* data = nullptr) noexcept;
 
+    /**
+     * @brief Create new unique pointer holding data allocated by given allocator.
+     * 
+     * @param[in] data      Pointer to data for which to take ownership.
+     * @param[in] allocator Reference to the allocator of the data, which must outlive the pointer.
+     */
+    UniquePtr(T* data, Allocator& allocator) noexcept;
+
     /**
      * @brief Create new unique pointer, which takes ownership over memory owned by other pointer.
      * 
      * @param[in] other Reference to other unique pointer to move memory from.
      */
-    UniquePtr(UniquePtr<T>&& other) noexcept;
+    UniquePtr(UniquePtr&& other) noexcept;
 
     /**
      * @brief Release allocated resources before deletion.
@@ -45,7 +57,7 @@ public:
      * 
      * @return Reference to this unique pointer.
      */
-    UniquePtr<T>& operator=(UniquePtr<T>&& other) noexcept;
+    UniquePtr& operator=(UniquePtr&& other) noexcept;
 
     /**
      * @brief Check if the pointer isn't null.
@@ -110,11 +122,19 @@ public:
      */
     T* release() noexcept;
 
-    UniquePtr(const UniquePtr<T>&)               = delete; // No copy constructor.
-    UniquePtr<T>& operator=(const UniquePtr<T>&) = delete; // No copy assignment.
+    /**
+     * @brief Get the allocator of the pointer.
+     * 
+     * @return Reference to the allocator.
+     */
+    Allocator& allocator() const noexcept;
+
+    UniquePtr(const UniquePtr&)               = delete; // No copy constructor.
+    UniquePtr& operator=(const UniquePtr&) = delete; // No copy assignment.
 
 private:
-    T* myData; // Pointer to unique data.
+    T* myData;              // Pointer to unique data.
+    Allocator* myAllocator; // Pointer to the allocator of the data.
 };
 
 /**
@@ -133,6 +153,8 @@ UniquePtr<T> makeUnique(Args&&... args) noexcept;
 /**
  * @brief Create unique pointer pointing at new field of given size.
  * 
+ *        The field is uninitialized, hence only trivially copyable types are supported.
+ * 
  * @tparam T    The pointer/field type.
  * @tparam Size The size of new field.
  * 
@@ -141,6 +163,22 @@ UniquePtr<T> makeUnique(Args&&... args) noexcept;
 template <typename T, size_t Size>
 UniquePtr<T> makeUnique() noexcept;
 
+/**
+ * @brief Create unique pointer holding a new object allocated by given allocator.
+ * 
+ * @tparam T         The pointer type.
+ * @tparam Allocator The allocator type.
+ * @tparam Args      The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] allocator Reference to the allocator, which must outlive the pointer.
+ * @param[in] args      The arguments to pass to the constructor of T.
+ * 
+ * @return Unique pointer holding ownership over the new object, or an empty pointer if
+ *         the allocation failed.
+ */
+template <typename T, typename Allocator, typename... Args>
+UniquePtr<T, Allocator> allocateUnique(Allocator& allocator, Args&&... args) noexcept;
+
 } // namespace memory
 
 #include "impl/unique_ptr_impl.h"
@@ -0,0 +1,110 @@
+/**
+ * @brief Weak pointer implementation.
+ */
+#pragma once
+
+#include "memory/shared_ptr.h"
+
+namespace memory
+{
+/**
+ * @brief Weak pointer implementation.
+ *
+ *        Weak pointers observe data owned by shared pointers without owning it, which breaks
+ *        ownership cycles. The data is accessed by locking the pointer, which provides a shared
+ *        pointer holding the data, or an empty pointer if the data has already been deleted.
+ *
+ * @tparam T         The pointer type.
+ * @tparam Allocator The allocator of the observed shared pointers (default = heap).
+ * @tparam RefCount  The reference count policy of the observed shared pointers (default = plain).
+ */
+template <typename T, typename Allocator = HeapAllocator, typename RefCount = refcount::Plain>
+class WeakPtr final
+{
+public:
+    /**
+     * @brief Create new empty weak pointer.
+     */
+    WeakPtr() noexcept;
+
+    /**
+     * @brief Create new weak pointer observing the data of given shared pointer.
+     *
+     * @param[in] shared Reference to the shared pointer to observe.
+     */
+    WeakPtr(const SharedPtr<T, Allocator, RefCount>& shared) noexcept;
+
+    /**
+     * @brief Create new weak pointer observing the same data as another weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to copy from.
+     */
+    WeakPtr(const WeakPtr& other) noexcept;
+
+    /**
+     * @brief Create new weak pointer, which takes over the observation of other weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to move from.
+     */
+    WeakPtr(WeakPtr&& other) noexcept;
+
+    /**
+     * @brief Stop observing the data before deletion.
+     */
+    ~WeakPtr() noexcept;
+
+    /**
+     * @brief Observe the same data as other weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to copy from.
+     *
+     * @return Reference to this weak pointer.
+     */
+    WeakPtr& operator=(const WeakPtr& other) noexcept;
+
+    /**
+     * @brief Take over the observation of other weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to move from.
+     *
+     * @return Reference to this weak pointer.
+     */
+    WeakPtr& operator=(WeakPtr&& other) noexcept;
+
+    /**
+     * @brief Check if the observed data has been deleted.
+     *
+     * @return True if the pointer is empty or the data has been deleted, false otherwise.
+     */
+    bool expired() const noexcept;
+
+    /**
+     * @brief Get shared ownership of the observed data.
+     *
+     * @return Shared pointer holding the data, or an empty pointer if the data has expired.
+     */
+    SharedPtr<T, Allocator, RefCount> lock() const noexcept;
+
+    /**
+     * @brief Get the number of shared pointers owning the observed data.
+     *
+     * @return The number of owners, or 0 if the pointer is empty.
+     */
+    size_t useCount() const noexcept;
+
+    /**
+     * @brief Stop observing the data.
+     */
+    void reset() noexcept;
+
+private:
+    /** Control block of the pointer. */
+    using Block = ControlBlock<RefCount>;
+
+    T* myData;              // Pointer to observed data/memory.
+    Block* myBlock;         // Pointer to the control block holding the reference counts.
+    Allocator* myAllocator; // Pointer to the allocator of the observed shared pointers.
+};
+} // namespace memory
+
+#include "impl/weak_ptr_impl.h"
@@ -0,0 +1,250 @@
+/**
+ * @brief Fixed-point numbers for machine learning without floating-point math.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+/**
+ * @brief Enumeration of rounding modes of fixed-point numbers.
+ */
+enum class Rounding : uint8_t
+{
+    Down,    // Round towards negative infinity, i.e. drop the fractional bits (fastest).
+    Nearest, // Round to the nearest value, halfway values are rounded up.
+};
+
+/**
+ * @brief Enumeration of overflow modes of fixed-point numbers.
+ */
+enum class Overflow : uint8_t
+{
+    Saturate, // Clamp results to the range of the number.
+    Wrap,     // Let results wrap around (fastest).
+};
+
+/**
+ * @brief Signed fixed-point number stored in 32 bits.
+ *
+ *        The number holds 31 - FracBits integer bits and FracBits fractional bits, i.e.
+ *        Q15.16 plus the sign bit by default. Products are calculated with 64-bit intermediates,
+ *        hence no precision is lost before rounding.
+ *
+ * @tparam FracBits     The number of fractional bits (default = 16).
+ * @tparam RoundingMode The rounding mode of products and conversions (default = nearest).
+ * @tparam OverflowMode The overflow mode of arithmetic operations (default = saturate).
+ */
+template <uint8_t FracBits = 16U, Rounding RoundingMode = Rounding::Nearest,
+          Overflow OverflowMode = Overflow::Saturate>
+class FixedPoint final
+{
+    static_assert((FracBits > 0U) && (FracBits < 31U), "Invalid number of fractional bits!");
+
+public:
+    /** The number of fractional bits. */
+    static constexpr uint8_t FractionalBits{FracBits};
+
+    /** The raw value representing 1. */
+    static constexpr int32_t One{static_cast<int32_t>(1L << FracBits)};
+
+    /**
+     * @brief Create fixed-point number with value 0.
+     */
+    constexpr FixedPoint() noexcept;
+
+    /**
+     * @brief Create fixed-point number from given raw value.
+     *
+     * @param[in] raw The raw value, i.e. the value scaled by 2^FracBits.
+     *
+     * @return The fixed-point number.
+     */
+    static constexpr FixedPoint fromRaw(int32_t raw) noexcept;
+
+    /**
+     * @brief Create fixed-point number from given integer.
+     *
+     * @param[in] value The integer value.
+     *
+     * @return The fixed-point number, saturated or wrapped if out of range.
+     */
+    static constexpr FixedPoint fromInt(int32_t value) noexcept;
+
+    /**
+     * @brief Create fixed-point number from given floating-point number.
+     *
+     *        Use this function for constants, since it requires floating-point math at runtime.
+     *
+     * @param[in] value The floating-point value.
+     *
+     * @return The fixed-point number, saturated or wrapped if out of range.
+     */
+    static constexpr FixedPoint fromDouble(double value) noexcept;
+
+    /**
+     * @brief Get the smallest number.
+     *
+     * @return The smallest number.
+     */
+    static constexpr FixedPoint min() noexcept;
+
+    /**
+     * @brief Get the largest number.
+     *
+     * @return The largest number.
+     */
+    static constexpr FixedPoint max() noexcept;
+
+    /**
+     * @brief Get the raw value of the number.
+     *
+     * @return The raw value, i.e. the value scaled by 2^FracBits.
+     */
+    constexpr int32_t raw() const noexcept;
+
+    /**
+     * @brief Convert the number to an integer, rounded according to the rounding mode.
+     *
+     * @return The integer value.
+     */
+    constexpr int32_t toInt() const noexcept;
+
+    /**
+     * @brief Convert the number to a floating-point number.
+     *
+     * @return The floating-point value.
+     */
+    constexpr double toDouble() const noexcept;
+
+    /**
+     * @brief Add given number to this number.
+     *
+     * @param[in] other The number to add.
+     *
+     * @return Reference to this number.
+     */
+    constexpr FixedPoint& operator+=(FixedPoint other) noexcept;
+
+    /**
+     * @brief Subtract given number from this number.
+     *
+     * @param[in] other The number to subtract.
+     *
+     * @return Reference to this number.
+     */
+    constexpr FixedPoint& operator-=(FixedPoint other) noexcept;
+
+    /**
+     * @brief Multiply this number with given number.
+     *
+     * @param[in] other The number to multiply with.
+     *
+     * @return Reference to this number.
+     */
+    constexpr FixedPoint& operator*=(FixedPoint other) noexcept;
+
+    /**
+     * @brief Get the sum of two numbers.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return The sum.
+     */
+    friend constexpr FixedPoint operator+(FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    /**
+     * @brief Get the difference of two numbers.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return The difference.
+     */
+    friend constexpr FixedPoint operator-(FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+    /**
+     * @brief Get the product of two numbers.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return The product.
+     */
+    friend constexpr FixedPoint operator*(FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs *= rhs;
+    }
+
+    /**
+     * @brief Get the negated number.
+     *
+     * @param[in] number The number to negate.
+     *
+     * @return The negated number.
+     */
+    friend constexpr FixedPoint operator-(const FixedPoint number) noexcept
+    {
+        return FixedPoint{} - number;
+    }
+
+    /**
+     * @brief Check whether two numbers are equal.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return True if the numbers are equal, false otherwise.
+     */
+    friend constexpr bool operator==(const FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs.myRaw == rhs.myRaw;
+    }
+
+    /**
+     * @brief Check whether two numbers differ.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return True if the numbers differ, false otherwise.
+     */
+    friend constexpr bool operator!=(const FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs.myRaw != rhs.myRaw;
+    }
+
+    /**
+     * @brief Check whether a number is less than another number.
+     *
+     * @param[in] lhs The left-hand side number.
+     * @param[in] rhs The right-hand side number.
+     *
+     * @return True if the left-hand side number is the smaller, false otherwise.
+     */
+    friend constexpr bool operator<(const FixedPoint lhs, const FixedPoint rhs) noexcept
+    {
+        return lhs.myRaw < rhs.myRaw;
+    }
+
+private:
+    static constexpr int32_t narrow(int64_t value) noexcept;
+    static constexpr int64_t shiftDown(int64_t value, uint8_t bits) noexcept;
+
+    /** The raw value, i.e. the value scaled by 2^FracBits. */
+    int32_t myRaw;
+};
+
+/** Fixed-point number with 16 integer bits (including the sign bit) and 16 fractional bits. */
+using Q16_16 = FixedPoint<16U>;
+} // namespace ml
+
+#include "impl/fixed_point_impl.h"
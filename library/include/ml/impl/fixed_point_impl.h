@@ -0,0 +1,140 @@
+/**
+ * @brief Implementation details of class ml::FixedPoint.
+ *
+ * @note Don't include this header, use <fixed_point.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>::FixedPoint() noexcept
+    : myRaw{0} {}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::fromRaw(const int32_t raw) noexcept
+{
+    FixedPoint number{};
+    number.myRaw = raw;
+    return number;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::fromInt(const int32_t value) noexcept
+{
+    return fromRaw(narrow(static_cast<int64_t>(value) * One));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::fromDouble(const double value) noexcept
+{
+    // Round in the floating-point domain, then clamp before converting to avoid undefined
+    // behavior for values out of range of 64-bit integers.
+    const double scaled{value * One + (RoundingMode == Rounding::Nearest ? 0.5 : 0.0)};
+    constexpr double limit{9.0e18};
+    const double clamped{scaled < -limit ? -limit : (scaled > limit ? limit : scaled)};
+    const auto truncated{static_cast<int64_t>(clamped)};
+
+    // Conversions truncate towards 0, adjust negative values to round down.
+    const bool adjust{(static_cast<double>(truncated) > clamped)};
+    return fromRaw(narrow(adjust ? truncated - 1 : truncated));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::min() noexcept
+{
+    return fromRaw(INT32_MIN);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::max() noexcept
+{
+    return fromRaw(INT32_MAX);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr int32_t FixedPoint<FracBits, RoundingMode, OverflowMode>::raw() const noexcept
+{
+    return myRaw;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr int32_t FixedPoint<FracBits, RoundingMode, OverflowMode>::toInt() const noexcept
+{
+    return static_cast<int32_t>(shiftDown(myRaw, FracBits));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr double FixedPoint<FracBits, RoundingMode, OverflowMode>::toDouble() const noexcept
+{
+    return static_cast<double>(myRaw) / One;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>&
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::operator+=(const FixedPoint other) noexcept
+{
+    myRaw = narrow(static_cast<int64_t>(myRaw) + other.myRaw);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>&
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::operator-=(const FixedPoint other) noexcept
+{
+    myRaw = narrow(static_cast<int64_t>(myRaw) - other.myRaw);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr FixedPoint<FracBits, RoundingMode, OverflowMode>&
+    FixedPoint<FracBits, RoundingMode, OverflowMode>::operator*=(const FixedPoint other) noexcept
+{
+    // The product holds 2 * FracBits fractional bits, scale it back before narrowing.
+    myRaw = narrow(shiftDown(static_cast<int64_t>(myRaw) * other.myRaw, FracBits));
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr int32_t FixedPoint<FracBits, RoundingMode, OverflowMode>::narrow(
+    const int64_t value) noexcept
+{
+    if (OverflowMode == Overflow::Saturate)
+    {
+        if (value > INT32_MAX) { return INT32_MAX; }
+        if (value < INT32_MIN) { return INT32_MIN; }
+        return static_cast<int32_t>(value);
+    }
+    // Wrap around by keeping the low 32 bits.
+    return static_cast<int32_t>(static_cast<uint32_t>(static_cast<uint64_t>(value)));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits, Rounding RoundingMode, Overflow OverflowMode>
+constexpr int64_t FixedPoint<FracBits, RoundingMode, OverflowMode>::shiftDown(
+    const int64_t value, const uint8_t bits) noexcept
+{
+    // Shifting signed values rounds towards negative infinity, add half to round to nearest.
+    const int64_t half{RoundingMode == Rounding::Nearest ? (static_cast<int64_t>(1) << (bits - 1U))
+                                                         : 0};
+    return (value + half) >> bits;
+}
+} // namespace ml
@@ -0,0 +1,139 @@
+/**
+ * @brief Implementation details of the mini-batch gradient descent trainer.
+ *
+ * @note Don't include this header, use <trainer.h> instead!
+ */
+#pragma once
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/polynomial.h"
+
+namespace ml
+{
+/**
+ * @brief Trainable parameters of the linear regression model.
+ */
+template <>
+struct Trainable<lin_reg::Fixed>
+{
+    /** The number of parameters, i.e. the weight and the bias. */
+    static constexpr size_t ParameterCount{2U};
+
+    static void features(const double input, double (&features)[ParameterCount]) noexcept
+    {
+        features[0U] = input;
+        features[1U] = 1.0;
+    }
+
+    static void setParameters(lin_reg::Fixed& model,
+                              const double (&parameters)[ParameterCount]) noexcept
+    {
+        model.setParameters(parameters[0U], parameters[1U]);
+    }
+};
+
+/**
+ * @brief Trainable parameters of the polynomial regression model.
+ */
+template <size_t Degree>
+struct Trainable<lin_reg::Polynomial<Degree>>
+{
+    /** The number of parameters, i.e. the coefficients. */
+    static constexpr size_t ParameterCount{Degree + 1U};
+
+    static void features(const double input, double (&features)[ParameterCount]) noexcept
+    {
+        features[0U] = 1.0;
+        for (size_t i{1U}; i < ParameterCount; ++i) { features[i] = features[i - 1U] * input; }
+    }
+
+    static void setParameters(lin_reg::Polynomial<Degree>& model,
+                              const double (&parameters)[ParameterCount]) noexcept
+    {
+        model.setCoefficients(typename lin_reg::Polynomial<Degree>::Coefficients{parameters});
+    }
+};
+
+namespace trainer
+{
+// -----------------------------------------------------------------------------
+template <typename Model>
+double meanSquaredError(const Model& model, const Matrix1d& trainIn, const Matrix2d& trainOut,
+                        const size_t setCount) noexcept
+{
+    double sum{};
+    for (size_t i{}; i < setCount; ++i)
+    {
+        const double error{trainOut[i] - model.predict(trainIn[i])};
+        sum += error * error;
+    }
+    return sum / setCount;
+}
+} // namespace trainer
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+bool Trainer::train(Model& model, const Matrix1d& trainIn, const Matrix2d& trainOut,
+                    TrainResult* result) noexcept
+{
+    using Parameters = Trainable<Model>;
+    constexpr size_t ParameterCount{Parameters::ParameterCount};
+
+    // Check the configuration and the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if ((0U == setCount) || !isConfigValid() || !initOrder(setCount)) { return false; }
+    const size_t batchSize{myConfig.batchSize < setCount ? myConfig.batchSize : setCount};
+
+    // Calculate the loss every epoch only if it's used, else once after training.
+    const bool earlyStop{0.0 < myConfig.targetLoss};
+    const bool epochLoss{earlyStop || (nullptr != myEpochCallback)};
+
+    // Clear the trainable parameters before starting training.
+    double parameters[ParameterCount]{};
+    Parameters::setParameters(model, parameters);
+
+    double learningRate{myConfig.learningRate};
+    TrainResult stats{0U, 0.0, false};
+
+    for (size_t epoch{}; epoch < myConfig.epochCount; ++epoch)
+    {
+        if (myConfig.shuffle) { shuffleOrder(); }
+
+        for (size_t begin{}; begin < setCount; begin += batchSize)
+        {
+            const size_t end{setCount - begin > batchSize ? begin + batchSize : setCount};
+
+            // Accumulate the gradient of the batch, then update the parameters once.
+            double gradient[ParameterCount]{};
+            double features[ParameterCount]{};
+
+            for (size_t i{begin}; i < end; ++i)
+            {
+                const size_t index{myOrder[i]};
+                const double error{trainOut[index] - model.predict(trainIn[index])};
+                Parameters::features(trainIn[index], features);
+                for (size_t j{}; j < ParameterCount; ++j) { gradient[j] += error * features[j]; }
+            }
+            const double step{learningRate / (end - begin)};
+            for (size_t j{}; j < ParameterCount; ++j) { parameters[j] += step * gradient[j]; }
+            Parameters::setParameters(model, parameters);
+        }
+        stats.epochCount = epoch + 1U;
+
+        if (epochLoss)
+        {
+            stats.loss = trainer::meanSquaredError(model, trainIn, trainOut, setCount);
+            if (myEpochCallback) { myEpochCallback(stats.epochCount, stats.loss, myContext); }
+            if (earlyStop && (myConfig.targetLoss >= stats.loss))
+            {
+                stats.converged = true;
+                break;
+            }
+        }
+        learningRate = nextLearningRate(learningRate, epoch);
+    }
+    if (!epochLoss) { stats.loss = trainer::meanSquaredError(model, trainIn, trainOut, setCount); }
+    if (result) { *result = stats; }
+    return true;
+}
+} // namespace ml
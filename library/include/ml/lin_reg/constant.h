@@ -0,0 +1,109 @@
+/**
+ * @brief Linear regression model trained at compile time.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/lin_reg/interface.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Structure holding the coefficients of a straight line.
+ */
+struct Line
+{
+    double weight; // The weight (k-value).
+    double bias;   // The bias (m-value).
+    bool valid;    // Indicate whether the line was fitted, i.e. the data held two distinct inputs.
+};
+
+/**
+ * @brief Fit a straight line to given training data with closed-form least squares.
+ *
+ *        The fit is evaluated by the compiler when used to initialize a constexpr variable, in
+ *        which case no training remains at runtime. The same running means and centered sums
+ *        as lin_reg::LeastSquares are used, hence the coefficients match a fit at runtime.
+ *
+ * @tparam InCount The number of input values.
+ * @tparam OutCount The number of output values. Surplus values of either set are ignored.
+ *
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values.
+ *
+ * @return The fitted line, which is invalid if the data holds fewer than two distinct inputs.
+ */
+template <size_t InCount, size_t OutCount>
+constexpr Line fitLine(const double (&trainIn)[InCount], 
+                       const double (&trainOut)[OutCount]) noexcept;
+
+/**
+ * @brief Linear regression model with coefficients baked in at compile time.
+ *
+ *        The coefficients are template arguments, so predict() compiles down to a multiply-add
+ *        with immediate operands. The model holds no data and needs no training at runtime.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Coefficients The coefficients, typically a constexpr variable initialized by
+ *                      fitLine(). Must be valid.
+ */
+template <const Line& Coefficients>
+class Constant final : public Interface
+{
+    static_assert(Coefficients.valid, "Constant model requires valid coefficients!");
+
+public:
+    /** The model weight (k-value). */
+    static constexpr double Weight{Coefficients.weight};
+
+    /** The model bias (m-value). */
+    static constexpr double Bias{Coefficients.bias};
+
+    /**
+     * @brief Constructor.
+     */
+    constexpr Constant() noexcept = default;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Constant() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained, which is always the case.
+     *
+     * @return True.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given input at compile time.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    static constexpr double evaluate(double input) noexcept;
+
+    Constant(const Constant&)            = delete; // No copy constructor.
+    Constant(Constant&&)                 = delete; // No move constructor.
+    Constant& operator=(const Constant&) = delete; // No copy assignment.
+    Constant& operator=(Constant&&)      = delete; // No move assignment.
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/constant_impl.h"
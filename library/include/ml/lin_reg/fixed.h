@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/least_squares.h"
 #include "ml/types.h"
 
 namespace ml
@@ -58,6 +59,42 @@ public:
     bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount, 
                double learningRate = 0.01) noexcept;
 
+    /**
+     * @brief Fit the model to given training data with closed-form least squares.
+     *
+     *        The exact least-squares solution is computed in a single pass over the data,
+     *        which replaces training the model epoch by epoch.
+     *
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[out] result Pointer to structure to store the fit statistics in (default = none).
+     *
+     * @return True on success, false if the data holds fewer than two distinct inputs.
+     */
+    bool fit(const Matrix1d& trainIn, const Matrix2d& trainOut, Fit* result = nullptr) noexcept;
+
+    /**
+     * @brief Set the model parameters, e.g. parameters trained earlier, and mark the model trained.
+     *
+     * @param[in] weight The weight (k-value).
+     * @param[in] bias The bias (m-value).
+     */
+    void setParameters(double weight, double bias) noexcept;
+
+    /**
+     * @brief Get the model weight.
+     *
+     * @return The weight (k-value).
+     */
+    double weight() const noexcept;
+
+    /**
+     * @brief Get the model bias.
+     *
+     * @return The bias (m-value).
+     */
+    double bias() const noexcept;
+
     Fixed(const Fixed&)            = delete; // No copy constructor.
     Fixed(Fixed&&)                 = delete; // No move constructor.
     Fixed& operator=(const Fixed&) = delete; // No copy assignment.
@@ -0,0 +1,57 @@
+/**
+ * @brief Implementation details of the linear regression model trained at compile time.
+ *
+ * @note Don't include this header, use <constant.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <size_t InCount, size_t OutCount>
+constexpr Line fitLine(const double (&trainIn)[InCount], 
+                       const double (&trainOut)[OutCount]) noexcept
+{
+    constexpr size_t count{InCount < OutCount ? InCount : OutCount};
+    double meanIn{};
+    double meanOut{};
+    double sumInIn{};
+    double sumInOut{};
+
+    // Accumulate running means and centered sums, see LeastSquares::add().
+    for (size_t i{}; i < count; ++i)
+    {
+        const double deltaIn{trainIn[i] - meanIn};
+        const double deltaOut{trainOut[i] - meanOut};
+        meanIn   += deltaIn / (i + 1U);
+        meanOut  += deltaOut / (i + 1U);
+        sumInIn  += deltaIn * (trainIn[i] - meanIn);
+        sumInOut += deltaIn * (trainOut[i] - meanOut);
+    }
+    // Return an invalid line if the inputs don't vary.
+    if ((2U > count) || (0.0 >= sumInIn)) { return Line{0.0, 0.0, false}; }
+    const double weight{sumInOut / sumInIn};
+    return Line{weight, meanOut - weight * meanIn, true};
+}
+
+// -----------------------------------------------------------------------------
+template <const Line& Coefficients>
+bool Constant<Coefficients>::isTrained() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+template <const Line& Coefficients>
+double Constant<Coefficients>::predict(const double input) const noexcept
+{
+    return evaluate(input);
+}
+
+// -----------------------------------------------------------------------------
+template <const Line& Coefficients>
+constexpr double Constant<Coefficients>::evaluate(const double input) noexcept
+{
+    return Weight * input + Bias;
+}
+} // namespace lin_reg
+} // namespace ml
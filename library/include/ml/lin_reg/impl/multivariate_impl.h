@@ -0,0 +1,124 @@
+/**
+ * @brief Implementation details of the linear regression implementation with several inputs.
+ *
+ * @note Don't include this header, use <multivariate.h> instead!
+ */
+#pragma once
+
+#include "ml/lin_reg/normal_equations.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+Multivariate<InputCount>::Multivariate() noexcept
+    : myWeights{}
+    , myBias{}
+    , myInputs{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+bool Multivariate<InputCount>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+double Multivariate<InputCount>::predict(const double input) const noexcept
+{
+    double output{myBias + myWeights[0U] * input};
+    for (size_t i{1U}; i < InputCount; ++i) { output += myWeights[i] * myInputs[i]; }
+    return output;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+double Multivariate<InputCount>::predict(const Inputs& inputs) const noexcept
+{
+    double output{myBias};
+    for (size_t i{}; i < InputCount; ++i) { output += myWeights[i] * inputs[i]; }
+    return output;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+void Multivariate<InputCount>::predict(InputArrays inputs, double* const outputs, 
+                                       const size_t count) const noexcept
+{
+    // Copy the parameters and pointers, so they needn't be reloaded since the outputs may
+    // alias them. The loop over the inputs is unrolled, which leaves a single loop over the
+    // samples that the compiler can vectorize.
+    double weights[InputCount]{};
+    const double* data[InputCount]{};
+    for (size_t i{}; i < InputCount; ++i) 
+    { 
+        weights[i] = myWeights[i]; 
+        data[i]    = inputs[i];
+    }
+    const double bias{myBias};
+
+    for (size_t j{}; j < count; ++j)
+    {
+        double output{bias};
+#pragma GCC unroll 16
+        for (size_t i{}; i < InputCount; ++i) { output += weights[i] * data[i][j]; }
+        outputs[j] = output;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+bool Multivariate<InputCount>::fit(InputArrays trainIn, const double* const trainOut, 
+                                   const size_t setCount) noexcept
+{
+    if (nullptr == trainOut) { return false; }
+    NormalEquations<InputCount> equations{};
+    Inputs features{};
+
+    for (size_t j{}; j < setCount; ++j)
+    {
+        for (size_t i{}; i < InputCount; ++i) 
+        { 
+            if (nullptr == trainIn[i]) { return false; }
+            features[i] = trainIn[i][j]; 
+        }
+        equations.add(features, trainOut[j]);
+    }
+    if (!equations.solve(myWeights, myBias)) { return false; }
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+bool Multivariate<InputCount>::setInput(const size_t index, const double value) noexcept
+{
+    if ((0U == index) || (InputCount <= index)) { return false; }
+    myInputs[index] = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+void Multivariate<InputCount>::setParameters(const Inputs& weights, const double bias) noexcept
+{
+    for (size_t i{}; i < InputCount; ++i) { myWeights[i] = weights[i]; }
+    myBias    = bias;
+    myTrained = true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+const typename Multivariate<InputCount>::Inputs& 
+    Multivariate<InputCount>::weights() const noexcept
+{
+    return myWeights;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+double Multivariate<InputCount>::bias() const noexcept { return myBias; }
+} // namespace lin_reg
+} // namespace ml
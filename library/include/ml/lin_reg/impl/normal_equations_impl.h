@@ -0,0 +1,109 @@
+/**
+ * @brief Implementation details of the least-squares fitting of linear models.
+ *
+ * @note Don't include this header, use <normal_equations.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace detail
+{
+// -----------------------------------------------------------------------------
+constexpr double magnitude(const double value) noexcept { return value < 0.0 ? -value : value; }
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+NormalEquations<FeatureCount>::NormalEquations() noexcept
+    : mySums{}
+    , myCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+void NormalEquations<FeatureCount>::add(const Features& features, const double output) noexcept
+{
+    // Prepend the constant bias feature, then accumulate the upper triangle and the outputs.
+    double row[ParamCount]{1.0};
+    for (size_t i{}; i < FeatureCount; ++i) { row[i + 1U] = features[i]; }
+
+    for (size_t i{}; i < ParamCount; ++i)
+    {
+        for (size_t j{i}; j < ParamCount; ++j) { mySums[i][j] += row[i] * row[j]; }
+        mySums[i][ParamCount] += row[i] * output;
+    }
+    ++myCount;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+void NormalEquations<FeatureCount>::reset() noexcept { *this = NormalEquations{}; }
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+size_t NormalEquations<FeatureCount>::count() const noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool NormalEquations<FeatureCount>::solve(Features& weights, double& bias) const noexcept
+{
+    if (ParamCount > myCount) { return false; }
+
+    // Copy the upper triangle to a full matrix, since elimination modifies it.
+    double matrix[ParamCount][ParamCount + 1U]{};
+    for (size_t i{}; i < ParamCount; ++i)
+    {
+        for (size_t j{}; j < ParamCount; ++j)
+        {
+            matrix[i][j] = i <= j ? mySums[i][j] : mySums[j][i];
+        }
+        matrix[i][ParamCount] = mySums[i][ParamCount];
+    }
+
+    // Eliminate below the diagonal, swapping in the row with the largest pivot for stability.
+    // Treat pivots that are tiny relative to the diagonal as 0, i.e. a singular matrix.
+    for (size_t col{}; col < ParamCount; ++col)
+    {
+        size_t pivot{col};
+        for (size_t row{col + 1U}; row < ParamCount; ++row)
+        {
+            if (detail::magnitude(matrix[row][col]) > detail::magnitude(matrix[pivot][col]))
+            {
+                pivot = row;
+            }
+        }
+        if (detail::magnitude(matrix[pivot][col]) <= 1e-6 * mySums[col][col]) { return false; }
+
+        if (pivot != col)
+        {
+            for (size_t j{col}; j <= ParamCount; ++j)
+            {
+                const double temp{matrix[col][j]};
+                matrix[col][j]   = matrix[pivot][j];
+                matrix[pivot][j] = temp;
+            }
+        }
+        for (size_t row{col + 1U}; row < ParamCount; ++row)
+        {
+            const double factor{matrix[row][col] / matrix[col][col]};
+            for (size_t j{col}; j <= ParamCount; ++j) { matrix[row][j] -= factor * matrix[col][j]; }
+        }
+    }
+
+    // Substitute backwards, the first parameter is the bias.
+    double params[ParamCount]{};
+    for (size_t i{ParamCount}; i-- > 0U;)
+    {
+        double sum{matrix[i][ParamCount]};
+        for (size_t j{i + 1U}; j < ParamCount; ++j) { sum -= matrix[i][j] * params[j]; }
+        params[i] = sum / matrix[i][i];
+    }
+    bias = params[0U];
+    for (size_t i{}; i < FeatureCount; ++i) { weights[i] = params[i + 1U]; }
+    return true;
+}
+} // namespace lin_reg
+} // namespace ml
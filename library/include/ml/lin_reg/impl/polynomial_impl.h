@@ -0,0 +1,97 @@
+/**
+ * @brief Implementation details of the polynomial regression implementation.
+ *
+ * @note Don't include this header, use <polynomial.h> instead!
+ */
+#pragma once
+
+#include "ml/lin_reg/normal_equations.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+Polynomial<Degree>::Polynomial() noexcept
+    : myCoefficients{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+double Polynomial<Degree>::predict(const double input) const noexcept
+{
+    double output{myCoefficients[Degree]};
+    for (size_t i{Degree}; i-- > 0U;) { output = output * input + myCoefficients[i]; }
+    return output;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+void Polynomial<Degree>::predict(const double* const inputs, double* const outputs, 
+                                 const size_t count) const noexcept
+{
+    // Copy the coefficients so they needn't be reloaded, since outputs may alias them.
+    double coefficients[Degree + 1U]{};
+    for (size_t i{}; i <= Degree; ++i) { coefficients[i] = myCoefficients[i]; }
+
+    for (size_t j{}; j < count; ++j)
+    {
+        const double input{inputs[j]};
+        double output{coefficients[Degree]};
+        for (size_t i{Degree}; i-- > 0U;) { output = output * input + coefficients[i]; }
+        outputs[j] = output;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::fit(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Fit the powers of the input as features, the constant term is the bias.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    NormalEquations<Degree> equations{};
+    typename NormalEquations<Degree>::Features powers{};
+
+    for (size_t j{}; j < setCount; ++j)
+    {
+        double power{1.0};
+        for (size_t i{}; i < Degree; ++i)
+        {
+            power     *= trainIn[j];
+            powers[i] = power;
+        }
+        equations.add(powers, trainOut[j]);
+    }
+    typename NormalEquations<Degree>::Features weights{};
+    double bias{};
+    if (!equations.solve(weights, bias)) { return false; }
+
+    myCoefficients[0U] = bias;
+    for (size_t i{}; i < Degree; ++i) { myCoefficients[i + 1U] = weights[i]; }
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+void Polynomial<Degree>::setCoefficients(const Coefficients& coefficients) noexcept
+{
+    for (size_t i{}; i <= Degree; ++i) { myCoefficients[i] = coefficients[i]; }
+    myTrained = true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+const typename Polynomial<Degree>::Coefficients& 
+    Polynomial<Degree>::coefficients() const noexcept
+{
+    return myCoefficients;
+}
+} // namespace lin_reg
+} // namespace ml
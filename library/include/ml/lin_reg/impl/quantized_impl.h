@@ -0,0 +1,133 @@
+/**
+ * @brief Implementation details of the fixed-point linear regression model.
+ *
+ * @note Don't include this header, use <quantized.h> instead!
+ */
+#pragma once
+
+#include "container/vector.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <typename Number>
+Quantized<Number>::Quantized() noexcept
+    : myWeight{}
+    , myBias{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+bool Quantized<Number>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+double Quantized<Number>::predict(const double input) const noexcept
+{
+    return predict(Number::fromDouble(input)).toDouble();
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+Number Quantized<Number>::predict(const Number input) const noexcept
+{
+    return myWeight * input + myBias;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+bool Quantized<Number>::train(const Matrix1d& trainIn, const Matrix2d& trainOut,
+                              const size_t epochCount, const double learningRate) noexcept
+{
+    // Check the learning rate before converting it, since conversions saturate.
+    if ((0.0 >= learningRate) || (1.0 < learningRate)) { return false; }
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+
+    // Convert the training data once, so that the epochs only use fixed-point math.
+    container::Vector<Number> data{};
+    if (!data.resize(2U * setCount)) { return false; }
+
+    for (size_t i{}; i < setCount; ++i)
+    {
+        data[i]            = Number::fromDouble(trainIn[i]);
+        data[setCount + i] = Number::fromDouble(trainOut[i]);
+    }
+    return train(data.data(), data.data() + setCount, setCount, epochCount,
+                 Number::fromDouble(learningRate));
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+bool Quantized<Number>::train(const Number* trainIn, const Number* trainOut,
+                              const size_t setCount, const size_t epochCount,
+                              const Number learningRate) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if ((0U == epochCount) || (0U == setCount) || !trainIn || !trainOut) { return false; }
+    if ((learningRate < Number::fromRaw(1)) || (Number::fromInt(1) < learningRate)) { return false; }
+
+    // Clear the trainable parameters before starting training.
+    myWeight = Number{};
+    myBias   = Number{};
+
+    // Train the model the specified number of epochs.
+    for (size_t epoch{}; epoch < epochCount; ++epoch)
+    {
+        for (size_t i{}; i < setCount; ++i) { optimize(trainIn[i], trainOut[i], learningRate); }
+    }
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+bool Quantized<Number>::fit(const Matrix1d& trainIn, const Matrix2d& trainOut,
+                            Fit* result) noexcept
+{
+    Fit fit{};
+    if (!leastSquares(trainIn, trainOut, fit)) { return false; }
+
+    myWeight  = Number::fromDouble(fit.weight);
+    myBias    = Number::fromDouble(fit.bias);
+    myTrained = true;
+    if (result) { *result = fit; }
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+void Quantized<Number>::setParameters(const Number weight, const Number bias) noexcept
+{
+    myWeight  = weight;
+    myBias    = bias;
+    myTrained = true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+Number Quantized<Number>::weight() const noexcept { return myWeight; }
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+Number Quantized<Number>::bias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+template <typename Number>
+void Quantized<Number>::optimize(const Number input, const Number output,
+                                 const Number learningRate) noexcept
+{
+    // Check the input, directly set bias to output if 0 (special case), like lin_reg::Fixed.
+    // Otherwise, apply gradient descent to update both weight and bias.
+    if (Number{} == input) { myBias = output; }
+    else
+    {
+        const Number step{(output - predict(input)) * learningRate};
+        myBias   += step;
+        myWeight += step * input;
+    }
+}
+} // namespace lin_reg
+} // namespace ml
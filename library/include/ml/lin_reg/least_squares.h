@@ -0,0 +1,103 @@
+/**
+ * @brief Closed-form least-squares fitting of linear regression models.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Structure holding the result of a least-squares fit.
+ */
+struct Fit
+{
+    double weight;           // The fitted weight (k-value).
+    double bias;             // The fitted bias (m-value).
+    double rSquared;         // Coefficient of determination, 1.0 for a perfect fit.
+    double residualMse;      // Mean squared residual, i.e. the mean squared training error.
+    double residualStdError; // Residual standard error, using n - 2 degrees of freedom.
+    size_t count;            // The number of fitted samples.
+};
+
+/**
+ * @brief Streaming ordinary least-squares fit of a straight line.
+ *
+ *        The samples are accumulated in a single pass in constant memory, after which the
+ *        exact least-squares solution is computed in closed form. The accumulator keeps running
+ *        means and centered sums of products (Welford's method) rather than raw sums of x, y,
+ *        xy and xx, which would lose precision to cancellation with 32-bit doubles on AVR.
+ */
+class LeastSquares final
+{
+public:
+    /**
+     * @brief Create empty accumulator.
+     */
+    LeastSquares() noexcept;
+
+    /**
+     * @brief Add sample.
+     *
+     * @param[in] input The input value.
+     * @param[in] output The output value.
+     */
+    void add(double input, double output) noexcept;
+
+    /**
+     * @brief Remove all samples.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the number of added samples.
+     *
+     * @return The number of samples.
+     */
+    size_t count() const noexcept;
+
+    /**
+     * @brief Solve the least-squares problem for the added samples.
+     *
+     * @param[out] fit Reference to the structure to store the result in.
+     *
+     * @return True on success, false if fewer than two samples with distinct inputs were added.
+     */
+    bool solve(Fit& fit) const noexcept;
+
+private:
+    /** The number of samples. */
+    size_t myCount;
+
+    /** The mean input value. */
+    double myMeanIn;
+
+    /** The mean output value. */
+    double myMeanOut;
+
+    /** The centered sum of squared inputs. */
+    double mySumInIn;
+
+    /** The centered sum of products of inputs and outputs. */
+    double mySumInOut;
+
+    /** The centered sum of squared outputs. */
+    double mySumOutOut;
+};
+
+/**
+ * @brief Fit a straight line to given training data with ordinary least squares.
+ *
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values.
+ * @param[out] fit Reference to the structure to store the result in.
+ *
+ * @return True on success, false if the data holds fewer than two distinct inputs.
+ */
+bool leastSquares(const Matrix1d& trainIn, const Matrix2d& trainOut, Fit& fit) noexcept;
+} // namespace lin_reg
+} // namespace ml
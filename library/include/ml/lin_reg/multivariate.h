@@ -0,0 +1,154 @@
+/**
+ * @brief Linear regression implementation with several inputs.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+#include "ml/lin_reg/interface.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Linear regression implementation with several inputs.
+ *
+ *        The model predicts y = w[0] * x[0] + ... + w[n - 1] * x[n - 1] + b, e.g. a temperature
+ *        based on the sensor voltage, the supply voltage and the board temperature.
+ *
+ *        To be used via lin_reg::Interface, e.g. by tempsensor::Smart, the model treats the
+ *        given input as the first input and holds the other inputs, which are to be updated
+ *        with setInput() whenever they're measured.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam InputCount The number of inputs. Must be greater than 0.
+ */
+template <size_t InputCount>
+class Multivariate final : public Interface
+{
+    static_assert(InputCount > 0U, "Input count must be greater than 0!");
+
+public:
+    /** Input values or weights, one per input. */
+    using Inputs = container::Array<double, InputCount>;
+
+    /** Pointers to input value arrays, one per input (structure of arrays). */
+    using InputArrays = const double* const (&)[InputCount];
+
+    /**
+     * @brief Constructor.
+     */
+    Multivariate() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Multivariate() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given first input and the held other inputs.
+     *
+     * @param[in] input The first input.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given inputs.
+     *
+     * @param[in] inputs The inputs.
+     *
+     * @return The predicted value.
+     */
+    double predict(const Inputs& inputs) const noexcept;
+
+    /**
+     * @brief Predict based on given batch of inputs.
+     *
+     *        The inputs are passed as one array per input, so that the loop over the samples
+     *        can be vectorized.
+     *
+     * @param[in] inputs Pointers to the input values, one array of given size per input.
+     * @param[out] outputs Pointer to array to store the predicted values in. Must not overlap
+     *                     the inputs.
+     * @param[in] count The number of samples to predict.
+     */
+    void predict(InputArrays inputs, double* outputs, size_t count) const noexcept;
+
+    /**
+     * @brief Fit the model to given training data with least squares.
+     *
+     * @param[in] trainIn Pointers to the training data input values, one array per input.
+     * @param[in] trainOut Training data output values.
+     * @param[in] setCount The number of training samples.
+     *
+     * @return True on success, false if the data doesn't determine the model, e.g. if there
+     *         are fewer samples than inputs plus one or an input is constant.
+     */
+    bool fit(InputArrays trainIn, const double* trainOut, size_t setCount) noexcept;
+
+    /**
+     * @brief Set held input, used by predict(double) for all inputs but the first.
+     *
+     * @param[in] index The index of the input. Must be greater than 0 and less than InputCount.
+     * @param[in] value The input value.
+     *
+     * @return True on success, false if the index is invalid.
+     */
+    bool setInput(size_t index, double value) noexcept;
+
+    /**
+     * @brief Set the model parameters, e.g. parameters trained earlier, and mark the model trained.
+     *
+     * @param[in] weights The weights, one per input.
+     * @param[in] bias The bias.
+     */
+    void setParameters(const Inputs& weights, double bias) noexcept;
+
+    /**
+     * @brief Get the model weights.
+     *
+     * @return Reference to the weights, one per input.
+     */
+    const Inputs& weights() const noexcept;
+
+    /**
+     * @brief Get the model bias.
+     *
+     * @return The bias.
+     */
+    double bias() const noexcept;
+
+    Multivariate(const Multivariate&)            = delete; // No copy constructor.
+    Multivariate(Multivariate&&)                 = delete; // No move constructor.
+    Multivariate& operator=(const Multivariate&) = delete; // No copy assignment.
+    Multivariate& operator=(Multivariate&&)      = delete; // No move assignment.
+
+private:
+    /** Model weights, one per input. */
+    Inputs myWeights;
+
+    /** Model bias. */
+    double myBias;
+
+    /** Held inputs used by predict(double), the first input is unused. */
+    Inputs myInputs;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/multivariate_impl.h"
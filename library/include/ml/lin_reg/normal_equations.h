@@ -0,0 +1,85 @@
+/**
+ * @brief Least-squares fitting of linear models with several features.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Streaming least-squares fit of a linear model with given number of features.
+ *
+ *        The samples are accumulated in a single pass into the normal equations, i.e. the
+ *        sums of products of the features, a leading constant feature for the bias and the
+ *        output. The equations are solved by Gaussian elimination with partial pivoting, which
+ *        takes O(FeatureCount^3) time but no memory beyond the accumulated sums.
+ *
+ * @note The sums aren't centered, hence features of very different magnitude, such as high
+ *       powers in polynomial fits, lose precision with 32-bit doubles on AVR.
+ *
+ * @tparam FeatureCount The number of features. Must be greater than 0.
+ */
+template <size_t FeatureCount>
+class NormalEquations final
+{
+    static_assert(FeatureCount > 0U, "Feature count must be greater than 0!");
+
+public:
+    /** Features of a sample. */
+    using Features = container::Array<double, FeatureCount>;
+
+    /**
+     * @brief Create empty accumulator.
+     */
+    NormalEquations() noexcept;
+
+    /**
+     * @brief Add sample to the fit.
+     *
+     * @param[in] features The features of the sample.
+     * @param[in] output The output value of the sample.
+     */
+    void add(const Features& features, double output) noexcept;
+
+    /**
+     * @brief Remove all samples.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the number of added samples.
+     *
+     * @return The number of samples.
+     */
+    size_t count() const noexcept;
+
+    /**
+     * @brief Solve the normal equations for the least-squares weights and bias.
+     *
+     * @param[out] weights Reference to array to store the weights in.
+     * @param[out] bias Reference to variable to store the bias in.
+     *
+     * @return True on success, false if the samples don't determine the model, e.g. if there
+     *         are fewer samples than parameters or a feature is constant.
+     */
+    bool solve(Features& weights, double& bias) const noexcept;
+
+private:
+    /** The number of model parameters, i.e. the features and the bias. */
+    static constexpr size_t ParamCount{FeatureCount + 1U};
+
+    /** Augmented matrix [X^T * X | X^T * y], where the first column of X is all ones. */
+    double mySums[ParamCount][ParamCount + 1U];
+
+    /** The number of added samples. */
+    size_t myCount;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/normal_equations_impl.h"
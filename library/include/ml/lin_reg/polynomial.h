@@ -0,0 +1,115 @@
+/**
+ * @brief Polynomial regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+#include "ml/lin_reg/interface.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Polynomial regression implementation.
+ *
+ *        The model predicts y = c[0] + c[1] * x + ... + c[n] * x^n, e.g. a temperature based on
+ *        the voltage of a thermistor, whose response isn't linear. The polynomial is linear in
+ *        its coefficients, hence it's fitted with least squares like a linear model.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Degree The degree of the polynomial. Must be greater than 0.
+ */
+template <size_t Degree>
+class Polynomial final : public Interface
+{
+    static_assert(Degree > 0U, "Polynomial degree must be greater than 0!");
+
+public:
+    /** Coefficients, ordered by increasing power starting with the constant term. */
+    using Coefficients = container::Array<double, Degree + 1U>;
+
+    /**
+     * @brief Constructor.
+     */
+    Polynomial() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Polynomial() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given batch of inputs.
+     *
+     *        The polynomial is evaluated with Horner's method for each sample. The loop over the
+     *        samples can be vectorized, since the loop over the coefficients is unrolled.
+     *
+     * @param[in] inputs Pointer to the input values.
+     * @param[out] outputs Pointer to array to store the predicted values in. Must not overlap
+     *                     the inputs.
+     * @param[in] count The number of samples to predict.
+     */
+    void predict(const double* inputs, double* outputs, size_t count) const noexcept;
+
+    /**
+     * @brief Fit the model to given training data with least squares.
+     *
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     *
+     * @return True on success, false if the data doesn't determine the polynomial, i.e. if it
+     *         holds fewer than Degree + 1 distinct inputs.
+     */
+    bool fit(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Set the coefficients, e.g. coefficients trained earlier, and mark the model trained.
+     *
+     * @param[in] coefficients The coefficients.
+     */
+    void setCoefficients(const Coefficients& coefficients) noexcept;
+
+    /**
+     * @brief Get the coefficients.
+     *
+     * @return Reference to the coefficients.
+     */
+    const Coefficients& coefficients() const noexcept;
+
+    Polynomial(const Polynomial&)            = delete; // No copy constructor.
+    Polynomial(Polynomial&&)                 = delete; // No move constructor.
+    Polynomial& operator=(const Polynomial&) = delete; // No copy assignment.
+    Polynomial& operator=(Polynomial&&)      = delete; // No move assignment.
+
+private:
+    /** Model coefficients, ordered by increasing power. */
+    Coefficients myCoefficients;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/polynomial_impl.h"
@@ -0,0 +1,160 @@
+/**
+ * @brief Fixed-point linear regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/fixed_point.h"
+#include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Linear regression implementation using fixed-point math.
+ *
+ *        Training and prediction use fixed-point arithmetic only, which avoids software
+ *        floating-point math on MCUs without a floating-point unit. The model is trained like
+ *        lin_reg::Fixed, so both models predict the same values within the fixed-point
+ *        resolution given the same training data and parameters.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Number The fixed-point number type (default = Q16.16, rounded and saturated).
+ */
+template <typename Number = Q16_16>
+class Quantized final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Quantized() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Quantized() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     *
+     *        The input is converted to fixed-point and the prediction back to floating-point.
+     *        Use the fixed-point overload to avoid the conversions.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given fixed-point input.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    Number predict(Number input) const noexcept;
+
+    /**
+     * @brief Train the model.
+     *
+     *        The training data is converted to fixed-point once before training, which
+     *        temporarily allocates memory for the converted data.
+     *
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     *
+     * @return True on success, false on failure.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount,
+               double learningRate = 0.01) noexcept;
+
+    /**
+     * @brief Train the model with fixed-point training data.
+     *
+     * @param[in] trainIn Pointer to the training data input values.
+     * @param[in] trainOut Pointer to the training data output values.
+     * @param[in] setCount The number of training sets.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters.
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     *
+     * @return True on success, false on failure.
+     */
+    bool train(const Number* trainIn, const Number* trainOut, size_t setCount,
+               size_t epochCount, Number learningRate) noexcept;
+
+    /**
+     * @brief Fit the model to given training data with closed-form least squares.
+     *
+     *        The exact least-squares solution is computed in a single pass over the data,
+     *        which replaces training the model epoch by epoch. The fit is computed in
+     *        floating-point, only the resulting parameters are converted to fixed-point.
+     *
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[out] result Pointer to structure to store the fit statistics in (default = none).
+     *
+     * @return True on success, false if the data holds fewer than two distinct inputs.
+     */
+    bool fit(const Matrix1d& trainIn, const Matrix2d& trainOut, Fit* result = nullptr) noexcept;
+
+    /**
+     * @brief Set the model parameters, e.g. parameters trained earlier, and mark the model trained.
+     *
+     * @param[in] weight The weight (k-value).
+     * @param[in] bias The bias (m-value).
+     */
+    void setParameters(Number weight, Number bias) noexcept;
+
+    /**
+     * @brief Get the model weight.
+     *
+     * @return The weight (k-value).
+     */
+    Number weight() const noexcept;
+
+    /**
+     * @brief Get the model bias.
+     *
+     * @return The bias (m-value).
+     */
+    Number bias() const noexcept;
+
+    Quantized(const Quantized&)            = delete; // No copy constructor.
+    Quantized(Quantized&&)                 = delete; // No move constructor.
+    Quantized& operator=(const Quantized&) = delete; // No copy assignment.
+    Quantized& operator=(Quantized&&)      = delete; // No move assignment.
+
+private:
+    void optimize(Number input, Number output, Number learningRate) noexcept;
+
+    /** Model weight (k-value). */
+    Number myWeight;
+
+    /** Model bias (m-value). */
+    Number myBias;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/quantized_impl.h"
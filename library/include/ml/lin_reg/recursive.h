@@ -0,0 +1,131 @@
+/**
+ * @brief Online linear regression implementation using recursive least squares.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/lin_reg/interface.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Online linear regression implementation using recursive least squares.
+ *
+ *        The model learns from one sample at a time in constant time and memory, hence it can
+ *        be recalibrated from live readings without storing a training set. Old samples are
+ *        discounted by a forgetting factor, so the model follows drifting data such as an
+ *        aging sensor. A forgetting factor of 1 weighs all samples equally, which makes the
+ *        model converge to the ordinary least-squares solution.
+ *
+ *        Forgetting is paused while the covariance exceeds its initial value, which keeps the
+ *        covariance from growing without bound when the input doesn't vary (windup).
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Recursive final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] forgettingFactor The weight of older samples relative to newer ones
+     *                             (default = 0.99). Must be greater than 0.0 and less than
+     *                             or equal to 1.0.
+     * @param[in] initialCovariance The initial covariance of the parameters (default = 1000),
+     *                              where greater values make the model adapt faster initially.
+     *                              Must be greater than 0.0.
+     */
+    explicit Recursive(double forgettingFactor = 0.99, double initialCovariance = 1000.0) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Recursive() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained, i.e. whether it has learned from two samples.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Learn from given sample.
+     *
+     * @param[in] input The input value, such as a sensor voltage.
+     * @param[in] output The reference output value, such as a reference temperature.
+     *
+     * @return True if the model was updated, false if the model parameters are invalid.
+     */
+    bool update(double input, double output) noexcept;
+
+    /**
+     * @brief Forget all samples, i.e. restart learning from scratch.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the model weight.
+     *
+     * @return The weight (k-value).
+     */
+    double weight() const noexcept;
+
+    /**
+     * @brief Get the model bias.
+     *
+     * @return The bias (m-value).
+     */
+    double bias() const noexcept;
+
+    /**
+     * @brief Get the number of samples learned from.
+     *
+     * @return The number of samples.
+     */
+    size_t sampleCount() const noexcept;
+
+    Recursive(const Recursive&)            = delete; // No copy constructor.
+    Recursive(Recursive&&)                 = delete; // No move constructor.
+    Recursive& operator=(const Recursive&) = delete; // No copy assignment.
+    Recursive& operator=(Recursive&&)      = delete; // No move assignment.
+
+private:
+    /** The forgetting factor. */
+    const double myForgettingFactor;
+
+    /** The initial covariance. */
+    const double myInitialCovariance;
+
+    /** Model weight (k-value). */
+    double myWeight;
+
+    /** Model bias (m-value). */
+    double myBias;
+
+    /** Covariance of the weight. */
+    double myCovWeight;
+
+    /** Covariance of the weight and the bias. */
+    double myCovCross;
+
+    /** Covariance of the bias. */
+    double myCovBias;
+
+    /** The number of samples learned from. */
+    size_t mySampleCount;
+};
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,103 @@
+/**
+ * @brief Storage of trained linear regression model parameters in EEPROM.
+ *
+ *        Storing the parameters lets the system skip training at startup, since loading a
+ *        record only takes a few EEPROM reads. Each record is laid out as follows:
+ *
+ *            - Version (1 byte): The record format version, see storage::Version.
+ *            - Fingerprint (2 bytes): Fingerprint of the training set the model was trained on.
+ *            - Weight (sizeof(double) bytes): The model weight.
+ *            - Bias (sizeof(double) bytes): The model bias.
+ *            - CRC (2 bytes): CRC-16 checksum of the preceding bytes.
+ *
+ *        Multi-byte fields are stored in little-endian byte order.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/types.h"
+
+namespace driver
+{
+namespace eeprom { class Interface; }
+} // namespace driver
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace storage
+{
+/** The current record format version, increment when the layout changes. */
+constexpr uint8_t Version{1U};
+
+/** The size of a record in bytes. */
+constexpr uint16_t RecordSize{sizeof(uint8_t) + sizeof(uint16_t) + 2U * sizeof(double) 
+                              + sizeof(uint16_t)};
+
+/**
+ * @brief Structure holding the parameters of a linear regression model.
+ */
+struct Parameters
+{
+    double weight; // The model weight (k-value).
+    double bias;   // The model bias (m-value).
+};
+
+/**
+ * @brief Enumeration of load results.
+ */
+enum class Status : uint8_t
+{
+    Valid,       // The record is valid, the parameters were loaded.
+    Corrupt,     // The record checksum doesn't match, e.g. if no record has been stored.
+    Stale,       // The record is intact, but of another version or training set.
+    Unavailable, // The EEPROM couldn't be read, e.g. if it's disabled.
+};
+
+/**
+ * @brief Compute the fingerprint of given training set.
+ *
+ *        The fingerprint changes if any value of the training set changes, in which case
+ *        stored parameters are considered stale and the model should be retrained.
+ *
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values.
+ *
+ * @return The fingerprint.
+ */
+uint16_t fingerprint(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+/**
+ * @brief Save model parameters in EEPROM.
+ *
+ *        Only bytes that differ from the bytes already stored are written, which saves
+ *        EEPROM write cycles when the same parameters are stored at every startup.
+ *
+ * @param[in] eeprom Reference to the EEPROM stream to write to. Must be enabled.
+ * @param[in] address The start address of the record.
+ * @param[in] parameters The parameters to save.
+ * @param[in] fingerprint Fingerprint of the training set the parameters were trained on.
+ *
+ * @return True if the record was saved, false otherwise.
+ */
+bool save(driver::eeprom::Interface& eeprom, uint16_t address, const Parameters& parameters,
+          uint16_t fingerprint) noexcept;
+
+/**
+ * @brief Load model parameters from EEPROM.
+ *
+ * @param[in] eeprom Reference to the EEPROM stream to read from. Must be enabled.
+ * @param[in] address The start address of the record.
+ * @param[in] fingerprint Fingerprint of the training set the model is expected to be trained on.
+ * @param[out] parameters Reference to structure to store the parameters in. Only updated
+ *                        if the record is valid.
+ *
+ * @return Status::Valid if the parameters were loaded, otherwise the reason why not.
+ */
+Status load(const driver::eeprom::Interface& eeprom, uint16_t address, uint16_t fingerprint,
+            Parameters& parameters) noexcept;
+} // namespace storage
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,133 @@
+/**
+ * @brief Quantized fully-connected neural network layer.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ml
+{
+namespace nn
+{
+/**
+ * @brief Enumeration of activation functions.
+ */
+enum class Activation : uint8_t
+{
+    Linear, // Pass the weighted sum through unchanged, typically used by the output layer.
+    Relu,   // Clamp negative weighted sums to 0.
+};
+
+/**
+ * @brief The number of fractional bits of the activations.
+ *
+ *        Activations, i.e. the inputs and outputs of each layer, are signed 16-bit fixed-point
+ *        numbers in Q5.10 format, which covers the range [-32, 32) with a resolution of about
+ *        0.001. The network inputs and outputs are normalized to about [-1, 1] before and
+ *        after inference, see nn::Scaling.
+ */
+constexpr uint8_t ActivationFracBits{10U};
+
+/**
+ * @brief The max magnitude of the biases.
+ *
+ *        Half of the 32-bit range is left for the weighted inputs, so that the weighted sums
+ *        of layers with 8-bit weights can't overflow, see nn::Accumulator.
+ */
+constexpr int32_t BiasLimit{static_cast<int32_t>(1) << 30};
+
+/**
+ * @brief Accumulator type of the weighted sums of a dense layer with given weight type.
+ *
+ *        The products of 8-bit weights and activations take up to 23 bits, hence the sums of
+ *        up to 255 products plus a bias in [-BiasLimit, BiasLimit] fit in 32 bits. The
+ *        products of 16-bit weights take up to 31 bits, hence these are summed in 64 bits.
+ *
+ * @tparam Weight The weight type.
+ */
+template <typename Weight>
+struct Accumulator { using Type = int32_t; };
+
+/**
+ * @brief Accumulator type of the weighted sums of a dense layer with 16-bit weights.
+ */
+template <>
+struct Accumulator<int16_t> { using Type = int64_t; };
+
+/**
+ * @brief Quantized fully-connected (dense) layer.
+ *
+ *        The weights are fixed-point numbers with weightFracBits fractional bits, stored row
+ *        by row with one row per output. Each output is the dot product of its row and the
+ *        inputs plus the bias, accumulated without overflow (see nn::Accumulator), shifted back to the activation format
+ *        and passed through the activation function. The loops have fixed trip counts and no
+ *        data-dependent branches, hence inference takes bounded time on AVR, while the
+ *        compiler can vectorize the dot products of wide layers on the host.
+ *
+ *        The layer is an aggregate, which is typically initialized as a constexpr variable in
+ *        a header generated by the host-side trainer (test/scripts/nn_export.py).
+ *
+ * @tparam Weight The weight type, either int8_t or int16_t.
+ * @tparam InCount The number of inputs. Must be greater than 0, and less than 256 for
+ *                 8-bit weights.
+ * @tparam OutCount The number of outputs. Must be greater than 0.
+ */
+template <typename Weight, size_t InCount, size_t OutCount>
+struct Dense
+{
+    static_assert((sizeof(Weight) == 1U) || (sizeof(Weight) == 2U),
+                  "Dense layer weights must be 8 or 16 bits!");
+    static_assert(static_cast<Weight>(-1) < 0, "Dense layer weights must be signed!");
+    static_assert((InCount > 0U) && (OutCount > 0U), "Dense layer must have inputs and outputs!");
+    static_assert((sizeof(Weight) == 2U) || (InCount < 256U),
+                  "Dense layer with 8-bit weights must have less than 256 inputs!");
+
+    /** The accumulator type of the weighted sums. */
+    using Sum = typename Accumulator<Weight>::Type;
+
+    /** The number of inputs. */
+    static constexpr size_t InputCount{InCount};
+
+    /** The number of outputs. */
+    static constexpr size_t OutputCount{OutCount};
+
+    /**
+     * @brief Calculate the outputs of the layer.
+     *
+     * @param[in] inputs Pointer to the inputs, InputCount activations.
+     * @param[out] outputs Pointer to array to store OutputCount activations in.
+     */
+    void forward(const int16_t* inputs, int16_t* outputs) const noexcept;
+
+    /** Quantized weights, one row per output holding the weights of each input. */
+    Weight weights[OutCount][InCount];
+
+    /** Quantized biases, with ActivationFracBits + weightFracBits fractional bits, in the
+        range [-BiasLimit, BiasLimit]. */
+    int32_t biases[OutCount];
+
+    /** The number of fractional bits of the weights. */
+    uint8_t weightFracBits;
+
+    /** The activation function. */
+    Activation activation;
+};
+
+/**
+ * @brief Convert a weighted sum to an activation.
+ *
+ * @tparam Sum The accumulator type of the weighted sum.
+ *
+ * @param[in] sum The weighted sum, with ActivationFracBits + fracBits fractional bits.
+ * @param[in] fracBits The number of fractional bits of the weights.
+ * @param[in] activation The activation function.
+ *
+ * @return The activation, rounded to nearest and saturated.
+ */
+template <typename Sum>
+constexpr int16_t activate(Sum sum, uint8_t fracBits, Activation activation) noexcept;
+} // namespace nn
+} // namespace ml
+
+#include "impl/dense_impl.h"
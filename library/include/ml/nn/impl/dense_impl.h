@@ -0,0 +1,43 @@
+/**
+ * @brief Implementation details of the quantized dense layer.
+ *
+ * @note Don't include this header, use <dense.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace nn
+{
+// -----------------------------------------------------------------------------
+template <typename Weight, size_t InCount, size_t OutCount>
+void Dense<Weight, InCount, OutCount>::forward(const int16_t* const inputs,
+                                               int16_t* const outputs) const noexcept
+{
+    for (size_t i{}; i < OutCount; ++i)
+    {
+        // Widen the operands to the accumulator type before multiplying, which fits the
+        // weighted sum whatever the inputs.
+        Sum sum{biases[i]};
+        for (size_t j{}; j < InCount; ++j)
+        {
+            sum += static_cast<Sum>(weights[i][j]) * static_cast<Sum>(inputs[j]);
+        }
+        outputs[i] = activate(sum, weightFracBits, activation);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sum>
+constexpr int16_t activate(const Sum sum, const uint8_t fracBits,
+                           const Activation activation) noexcept
+{
+    // Shifting signed values rounds towards negative infinity, add half to round to nearest.
+    // ReLU is applied by raising the lower saturation limit, which avoids branches.
+    const Sum half{0U < fracBits ? static_cast<Sum>(1) << (fracBits - 1U) : 0};
+    const Sum value{(sum + half) >> fracBits};
+    const Sum low{Activation::Relu == activation ? 0 : INT16_MIN};
+    return static_cast<int16_t>(value < low ? low : (INT16_MAX < value ? INT16_MAX : value));
+}
+} // namespace nn
+} // namespace ml
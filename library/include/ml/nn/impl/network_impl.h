@@ -0,0 +1,168 @@
+/**
+ * @brief Implementation details of the neural network inference engine.
+ *
+ * @note Don't include this header, use <network.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace nn
+{
+namespace layers
+{
+// -----------------------------------------------------------------------------
+template <typename First, typename... Rest>
+constexpr size_t inputCount(const First&, const Rest&...) noexcept
+{
+    return First::InputCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Last>
+constexpr size_t outputCount(const Last&) noexcept
+{
+    return Last::OutputCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename First, typename Second, typename... Rest>
+constexpr size_t outputCount(const First&, const Second& second, const Rest&... rest) noexcept
+{
+    return outputCount(second, rest...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename... Layers>
+constexpr size_t maxWidth(const Layers&...) noexcept
+{
+    const size_t counts[]{Layers::InputCount..., Layers::OutputCount...};
+    size_t width{};
+
+    for (const auto count : counts)
+    {
+        if (count > width) { width = count; }
+    }
+    return width;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Last>
+constexpr bool isChained(const Last&) noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+template <typename First, typename Second, typename... Rest>
+constexpr bool isChained(const First&, const Second& second, const Rest&... rest) noexcept
+{
+    return (First::OutputCount == Second::InputCount) && isChained(second, rest...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename... Layers>
+constexpr bool areBiasesValid(const Layers&... layers) noexcept
+{
+    bool valid{true};
+    auto check{[&valid](const auto& layer) noexcept
+    {
+        for (const auto bias : layer.biases)
+        {
+            if ((bias < -BiasLimit) || (BiasLimit < bias)) { valid = false; }
+        }
+    }};
+    (check(layers), ...);
+    return valid;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InCount, size_t OutCount, size_t ScaleInCount, size_t ScaleOutCount>
+constexpr bool isScalingValid(const Scaling<ScaleInCount, ScaleOutCount>&) noexcept
+{
+    return (InCount == ScaleInCount) && (OutCount == ScaleOutCount);
+}
+} // namespace layers
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+Network<Scale, Layers...>::Network() noexcept
+    : myInputs{}
+{}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+bool Network<Scale, Layers...>::isTrained() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+double Network<Scale, Layers...>::predict(const double input) const noexcept
+{
+    int16_t inputs[InputCount]{};
+    int16_t outputs[OutputCount]{};
+
+    for (size_t i{1U}; i < InputCount; ++i) { inputs[i] = myInputs[i]; }
+    inputs[0U] = quantizeInput(0U, input);
+    predictQuantized(inputs, outputs);
+    return restoreOutput(0U, outputs[0U]);
+}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+void Network<Scale, Layers...>::predict(const double (&inputs)[InputCount],
+                                        double (&outputs)[OutputCount]) const noexcept
+{
+    int16_t quantizedInputs[InputCount]{};
+    int16_t quantizedOutputs[OutputCount]{};
+
+    for (size_t i{}; i < InputCount; ++i) { quantizedInputs[i] = quantizeInput(i, inputs[i]); }
+    predictQuantized(quantizedInputs, quantizedOutputs);
+    for (size_t i{}; i < OutputCount; ++i) { outputs[i] = restoreOutput(i, quantizedOutputs[i]); }
+}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+void Network<Scale, Layers...>::predictQuantized(const int16_t (&inputs)[InputCount],
+                                                 int16_t (&outputs)[OutputCount]) noexcept
+{
+    // Run the layers in order, alternating between the scratch buffers.
+    int16_t buffers[2U][BufferSize];
+    size_t current{};
+
+    for (size_t i{}; i < InputCount; ++i) { buffers[0U][i] = inputs[i]; }
+    ((Layers.forward(buffers[current], buffers[current ^ 1U]), current ^= 1U), ...);
+    for (size_t i{}; i < OutputCount; ++i) { outputs[i] = buffers[current][i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+int16_t Network<Scale, Layers...>::quantizeInput(const size_t index, const double value) noexcept
+{
+    if (InputCount <= index) { return 0; }
+
+    // Round in the floating-point domain, then clamp before converting.
+    constexpr double one{static_cast<double>(static_cast<int32_t>(1) << ActivationFracBits)};
+    const double normalized{(value - Scale.inputOffset[index]) * Scale.inputScale[index] * one};
+    const double rounded{normalized < 0.0 ? normalized - 0.5 : normalized + 0.5};
+
+    if (INT16_MAX < rounded) { return INT16_MAX; }
+    if (INT16_MIN > rounded) { return INT16_MIN; }
+    return static_cast<int16_t>(rounded);
+}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+double Network<Scale, Layers...>::restoreOutput(const size_t index, const int16_t value) noexcept
+{
+    if (OutputCount <= index) { return 0.0; }
+    constexpr double one{static_cast<double>(static_cast<int32_t>(1) << ActivationFracBits)};
+    return Scale.outputOffset[index] + value / one * Scale.outputScale[index];
+}
+
+// -----------------------------------------------------------------------------
+template <const auto& Scale, const auto&... Layers>
+bool Network<Scale, Layers...>::setInput(const size_t index, const double value) noexcept
+{
+    if ((0U == index) || (InputCount <= index)) { return false; }
+    myInputs[index] = quantizeInput(index, value);
+    return true;
+}
+} // namespace nn
+} // namespace ml
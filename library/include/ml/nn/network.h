@@ -0,0 +1,226 @@
+/**
+ * @brief Quantized fully-connected neural network inference engine.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+#include "ml/nn/dense.h"
+
+namespace ml
+{
+namespace nn
+{
+/**
+ * @brief Structure holding the scaling of the network inputs and outputs.
+ *
+ *        Each input is normalized as (input - inputOffset) * inputScale before inference, and
+ *        each output is restored as outputOffset + output * outputScale after inference.
+ *
+ * @tparam InCount The number of inputs.
+ * @tparam OutCount The number of outputs.
+ */
+template <size_t InCount, size_t OutCount>
+struct Scaling
+{
+    double inputOffset[InCount];   // Offset subtracted from each input.
+    double inputScale[InCount];    // Scale each input is multiplied with after the offset.
+    double outputOffset[OutCount]; // Offset added to each output.
+    double outputScale[OutCount];  // Scale each output is multiplied with before the offset.
+};
+
+namespace layers
+{
+/**
+ * @brief Get the number of inputs of given layers, i.e. of the first layer.
+ */
+template <typename First, typename... Rest>
+constexpr size_t inputCount(const First& first, const Rest&... rest) noexcept;
+
+/**
+ * @brief Get the number of outputs of given layers, i.e. of the last layer.
+ */
+template <typename Last>
+constexpr size_t outputCount(const Last& last) noexcept;
+
+/**
+ * @brief Get the number of outputs of given layers, i.e. of the last layer.
+ */
+template <typename First, typename Second, typename... Rest>
+constexpr size_t outputCount(const First& first, const Second& second,
+                             const Rest&... rest) noexcept;
+
+/**
+ * @brief Get the width of the widest of given layers, counting inputs and outputs.
+ */
+template <typename... Layers>
+constexpr size_t maxWidth(const Layers&... layers) noexcept;
+
+/**
+ * @brief Check whether the input count of each given layer matches the output count of the
+ *        preceding layer.
+ */
+template <typename Last>
+constexpr bool isChained(const Last& last) noexcept;
+
+/**
+ * @brief Check whether the input count of each given layer matches the output count of the
+ *        preceding layer.
+ */
+template <typename First, typename Second, typename... Rest>
+constexpr bool isChained(const First& first, const Second& second, const Rest&... rest) noexcept;
+
+/**
+ * @brief Check whether the biases of each given layer are in the range [-BiasLimit, BiasLimit].
+ */
+template <typename... Layers>
+constexpr bool areBiasesValid(const Layers&... layers) noexcept;
+
+/**
+ * @brief Check whether given scaling matches given input and output count.
+ */
+template <size_t InCount, size_t OutCount, size_t ScaleInCount, size_t ScaleOutCount>
+constexpr bool isScalingValid(const Scaling<ScaleInCount, ScaleOutCount>& scaling) noexcept;
+} // namespace layers
+
+/**
+ * @brief Fully-connected neural network with quantized weights baked in at compile time.
+ *
+ *        The network holds references to constexpr layers, typically generated by the
+ *        host-side trainer (test/scripts/nn_export.py), and runs them in order. Inference
+ *        uses integer math only, see nn::Dense. The activations are held in two scratch
+ *        buffers on the stack, each as large as the widest layer, so the memory needed is known
+ *        at compile time (see ScratchBytes and ParameterBytes) and no heap memory is used.
+ *
+ *        The network implements lin_reg::Interface, so it can replace a regression model, e.g.
+ *        for nonlinear calibration by tempsensor::Smart. In that case the given input is used
+ *        as the first input and the other inputs are held, which are to be updated with
+ *        setInput() whenever they're measured. The first output is returned.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Scale The input and output scaling, an nn::Scaling matching the layers.
+ * @tparam Layers The layers, nn::Dense layers whose input counts match the output counts of
+ *                the preceding layers.
+ */
+template <const auto& Scale, const auto&... Layers>
+class Network final : public lin_reg::Interface
+{
+    static_assert(sizeof...(Layers) > 0U, "Network must have at least one layer!");
+    static_assert(layers::isChained(Layers...), "Network layer sizes don't match!");
+    static_assert(layers::areBiasesValid(Layers...), "Network layer biases are out of range!");
+
+public:
+    /** The number of layers. */
+    static constexpr size_t LayerCount{sizeof...(Layers)};
+
+    /** The number of inputs. */
+    static constexpr size_t InputCount{layers::inputCount(Layers...)};
+
+    /** The number of outputs. */
+    static constexpr size_t OutputCount{layers::outputCount(Layers...)};
+
+    /** The number of activations of each scratch buffer, i.e. the width of the widest layer. */
+    static constexpr size_t BufferSize{layers::maxWidth(Layers...)};
+
+    /** The number of bytes of the scratch buffers, which are allocated on the stack. */
+    static constexpr size_t ScratchBytes{2U * BufferSize * sizeof(int16_t)};
+
+    /** The number of bytes of the layers, i.e. the quantized weights and biases. */
+    static constexpr size_t ParameterBytes{(sizeof(Layers) + ...)};
+
+    static_assert(layers::isScalingValid<InputCount, OutputCount>(Scale),
+                  "Network scaling doesn't match the layers!");
+
+    /**
+     * @brief Constructor.
+     */
+    Network() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Network() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained, which is always the case.
+     *
+     * @return True.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given first input and the held other inputs.
+     *
+     * @param[in] input The first input.
+     *
+     * @return The first predicted output.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given inputs.
+     *
+     * @param[in] inputs The inputs.
+     * @param[out] outputs Reference to array to store the predicted outputs in.
+     */
+    void predict(const double (&inputs)[InputCount],
+                 double (&outputs)[OutputCount]) const noexcept;
+
+    /**
+     * @brief Predict based on given normalized, quantized inputs.
+     *
+     *        Only integer math is used, which avoids floating-point math on MCUs without a
+     *        floating-point unit when the inputs are read as integers.
+     *
+     * @param[in] inputs The inputs in Q5.10 format, normalized as specified by the scaling.
+     * @param[out] outputs Reference to array to store the normalized outputs in Q5.10 format.
+     */
+    static void predictQuantized(const int16_t (&inputs)[InputCount],
+                                 int16_t (&outputs)[OutputCount]) noexcept;
+
+    /**
+     * @brief Normalize and quantize given input.
+     *
+     * @param[in] index The index of the input. Must be less than InputCount.
+     * @param[in] value The input value.
+     *
+     * @return The input in Q5.10 format, rounded to nearest and saturated.
+     */
+    static int16_t quantizeInput(size_t index, double value) noexcept;
+
+    /**
+     * @brief Restore given normalized, quantized output.
+     *
+     * @param[in] index The index of the output. Must be less than OutputCount.
+     * @param[in] value The output in Q5.10 format.
+     *
+     * @return The output value.
+     */
+    static double restoreOutput(size_t index, int16_t value) noexcept;
+
+    /**
+     * @brief Set held input, used by predict(double) for all inputs but the first.
+     *
+     * @param[in] index The index of the input. Must be greater than 0 and less than InputCount.
+     * @param[in] value The input value.
+     *
+     * @return True on success, false if the index is invalid.
+     */
+    bool setInput(size_t index, double value) noexcept;
+
+    Network(const Network&)            = delete; // No copy constructor.
+    Network(Network&&)                 = delete; // No move constructor.
+    Network& operator=(const Network&) = delete; // No copy assignment.
+    Network& operator=(Network&&)      = delete; // No move assignment.
+
+private:
+    /** Held inputs in Q5.10 format used by predict(double), the first input is unused. */
+    int16_t myInputs[InputCount];
+};
+} // namespace nn
+} // namespace ml
+
+#include "impl/network_impl.h"
@@ -0,0 +1,58 @@
+/**
+ * @brief Deterministic pseudo-random number generation for machine learning.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+/**
+ * @brief Xorshift pseudo-random number generator with 32 bits of state.
+ *
+ *        The generator only uses shifts and exclusive ors, which are cheap on 8-bit MCUs, and
+ *        produces the same sequence on every platform given the same seed. Hence training
+ *        runs are reproducible. The generator isn't suitable for cryptographic purposes.
+ */
+class Random final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] seed The seed (default = 1). A seed of 0 is replaced by 1, since the state
+     *                 must be non-zero.
+     */
+    explicit Random(uint32_t seed = 1U) noexcept;
+
+    /**
+     * @brief Restart the sequence with given seed.
+     *
+     * @param[in] seed The seed. A seed of 0 is replaced by 1, since the state must be non-zero.
+     */
+    void seed(uint32_t seed) noexcept;
+
+    /**
+     * @brief Get the next number in the sequence.
+     *
+     * @return The next number, never 0.
+     */
+    uint32_t next() noexcept;
+
+    /**
+     * @brief Get the next number in the sequence below given bound.
+     *
+     *        The number is reduced with the modulo operator, whose bias is negligible for the
+     *        small bounds used, e.g. when shuffling training sets.
+     *
+     * @param[in] bound The exclusive upper bound. Must be greater than 0.
+     *
+     * @return The next number in the range [0, bound), 0 if the bound is 0.
+     */
+    uint32_t next(uint32_t bound) noexcept;
+
+private:
+    /** The state, i.e. the last generated number. */
+    uint32_t myState;
+};
+} // namespace ml
@@ -0,0 +1,170 @@
+/**
+ * @brief Mini-batch gradient descent training of machine learning models.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container/vector.h"
+#include "ml/random.h"
+#include "ml/types.h"
+
+namespace ml
+{
+/**
+ * @brief Enumeration of learning rate schedules.
+ */
+enum class Schedule : uint8_t
+{
+    Constant,    // Keep the learning rate constant.
+    Step,        // Multiply the learning rate by the decay every stepEpochs epochs.
+    Exponential, // Multiply the learning rate by the decay every epoch.
+    InverseTime, // Use the initial learning rate divided by 1 + decay * epoch.
+};
+
+/**
+ * @brief Structure holding the training configuration.
+ *
+ *        The default configuration trains like lin_reg::Fixed::train(), i.e. one update per
+ *        sample in order with a constant learning rate of 0.01 for 100 epochs. Batches larger
+ *        than the training set hold the entire set.
+ */
+struct TrainConfig
+{
+    size_t epochCount{100U};               // Maximum number of epochs, must be greater than 0.
+    size_t batchSize{1U};                  // Samples per update, must be greater than 0.
+    double learningRate{0.01};             // Initial learning rate, must be in range (0.0, 1.0].
+    Schedule schedule{Schedule::Constant}; // Learning rate schedule.
+    double decay{1.0};                     // Learning rate decay, in range (0.0, 1.0] for step
+                                           // and exponential schedules, else at least 0.0.
+    size_t stepEpochs{1U};                 // Epochs per step of the step schedule, must be > 0.
+    double targetLoss{};                   // Stop when the mean squared error is less than or
+                                           // equal to this loss, 0.0 to train all epochs.
+    bool shuffle{false};                   // Shuffle the training sets before each epoch.
+    uint32_t seed{1U};                     // Seed of the shuffling, same seed yields same order.
+};
+
+/**
+ * @brief Structure holding the result of a training run.
+ */
+struct TrainResult
+{
+    size_t epochCount; // The number of trained epochs.
+    double loss;       // The mean squared error of the trained model on the training data.
+    bool converged;    // Indicate whether the target loss was reached.
+};
+
+/**
+ * @brief Trainable parameters of a model.
+ *
+ *        Specialize this structure for each model to train with ml::Trainer. The trainer
+ *        supports models whose prediction is linear in their parameters, i.e. the sum of the
+ *        parameters times features of the input, such as lin_reg::Fixed (features x and 1) and
+ *        lin_reg::Polynomial (features 1, x, ..., x^n). A specialization shall provide:
+ *
+ *        - static constexpr size_t ParameterCount: The number of parameters.
+ *        - static void features(double input, double (&features)[ParameterCount]): Calculate
+ *          the features of given input, i.e. the gradient of the prediction.
+ *        - static void setParameters(Model& model, const double (&parameters)[ParameterCount]):
+ *          Set the model parameters and mark the model trained.
+ *
+ * @tparam Model The model type.
+ */
+template <typename Model>
+struct Trainable;
+
+/**
+ * @brief Mini-batch gradient descent trainer.
+ *
+ *        The gradients of the squared error are averaged over each batch of samples before the
+ *        parameters are updated, so larger batches allow larger learning rates. The training
+ *        sets can be shuffled before each epoch with a seeded pseudo-random generator, hence
+ *        training runs are reproducible. After each epoch the mean squared error is calculated
+ *        if needed, i.e. to stop training early on a target loss or to report it via callback.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Trainer final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] config The training configuration.
+     * @param[in] epochCallback Callback invoked with the epoch number (starting at 1) and the
+     *                          mean squared error after each epoch (default = none).
+     * @param[in] context Context passed to the callback (default = none).
+     */
+    explicit Trainer(const TrainConfig& config,
+                     void (*epochCallback)(size_t epoch, double loss, void* context) = nullptr,
+                     void* context = nullptr) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Trainer() noexcept = default;
+
+    /**
+     * @brief Get the training configuration.
+     *
+     * @return Reference to the training configuration.
+     */
+    const TrainConfig& config() const noexcept;
+
+    /**
+     * @brief Check whether the training configuration is valid.
+     *
+     * @return True if the configuration is valid, false otherwise.
+     */
+    bool isConfigValid() const noexcept;
+
+    /**
+     * @brief Train given model.
+     *
+     *        The model parameters are cleared before training. The shuffled order of the
+     *        training sets is held by the trainer, which allocates memory for it on the first
+     *        run and whenever the number of training sets grows.
+     *
+     * @tparam Model The model type, see ml::Trainable.
+     *
+     * @param[in] model Reference to the model to train.
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[out] result Pointer to structure to store the training result in (default = none).
+     *
+     * @return True on success, false if the configuration is invalid, there are no training
+     *         sets or memory allocation failed.
+     */
+    template <typename Model>
+    bool train(Model& model, const Matrix1d& trainIn, const Matrix2d& trainOut,
+               TrainResult* result = nullptr) noexcept;
+
+    Trainer(const Trainer&)            = delete; // No copy constructor.
+    Trainer(Trainer&&)                 = delete; // No move constructor.
+    Trainer& operator=(const Trainer&) = delete; // No copy assignment.
+    Trainer& operator=(Trainer&&)      = delete; // No move assignment.
+
+private:
+    bool initOrder(size_t setCount) noexcept;
+    void shuffleOrder() noexcept;
+    double nextLearningRate(double learningRate, size_t epoch) const noexcept;
+
+    /** The training configuration. */
+    const TrainConfig myConfig;
+
+    /** Callback invoked after each epoch. */
+    void (*myEpochCallback)(size_t epoch, double loss, void* context);
+
+    /** Context passed to the callback. */
+    void* myContext;
+
+    /** Generator used to shuffle the training sets. */
+    Random myRandom;
+
+    /** Order in which the training sets are visited. */
+    container::Vector<size_t> myOrder;
+};
+} // namespace ml
+
+#include "impl/trainer_impl.h"
@@ -1,16 +1,34 @@
 /**
  * @brief Machine learning types.
+ *
+ *        Define ML_STATIC_MATRIX_CAPACITY to the maximum number of elements per matrix to use
+ *        vectors with static capacity, i.e. to avoid heap memory for training sets.
  */
 #pragma once
 
+#ifdef ML_STATIC_MATRIX_CAPACITY
+#include "container/static_vector.h"
+#else
 #include "container/vector.h"
+#endif
 
 namespace ml
 {
+#ifdef ML_STATIC_MATRIX_CAPACITY
+
+/** One-dimensional vector. */
+using Matrix1d = container::StaticVector<double, ML_STATIC_MATRIX_CAPACITY>;
+
+/** Two-dimensional vector. */
+using Matrix2d = container::StaticVector<double, ML_STATIC_MATRIX_CAPACITY>;
+
+#else
+
 /** One-dimensional vector. */
 using Matrix1d = container::Vector<double>;
 
 /** Two-dimensional vector. */
 using Matrix2d = container::Vector<double>;
 
-} // namespace ml
\ No newline at end of file
+#endif /** ML_STATIC_MATRIX_CAPACITY */
+} // namespace ml
@@ -0,0 +1,130 @@
+/**
+ * @brief Cooperative task scheduler.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "scheduler/task.h"
+
+namespace driver
+{
+/** System clock interface. */
+namespace clock { class Interface; }
+
+/** Watchdog timer interface. */
+namespace watchdog { class Interface; }
+
+} // namespace driver
+
+namespace scheduler
+{
+/**
+ * @brief Cooperative task scheduler.
+ * 
+ *        Tasks are run from the main loop by calling run() repeatedly. Each call runs the due
+ *        task with the highest priority, if any, so that the main loop can handle other work,
+ *        such as events, between the tasks. Tasks with the same priority are run in the 
+ *        order they were added. The system clock is used for scheduling and for measuring 
+ *        the run time of the tasks, which makes it possible to test the scheduler with a 
+ *        simulated clock.
+ * 
+ *        Each task checks in when a run finishes. The watchdog timer is only reset when every
+ *        enabled task has checked in within its period plus its deadline, i.e. a starved or
+ *        stuck task lets the watchdog reset the system.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Scheduler final
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] clock Reference to the system clock used for scheduling.
+     * @param[in] watchdog Reference to the watchdog timer to reset.
+     */
+    explicit Scheduler(driver::clock::Interface& clock, 
+                       driver::watchdog::Interface& watchdog) noexcept;
+
+    /**
+     * @brief Destructor. Removes all tasks.
+     */
+    ~Scheduler() noexcept;
+
+    /**
+     * @brief Add task to the scheduler and start it.
+     * 
+     * @param[in] task Reference to the task to add.
+     * 
+     * @return True if the task was added, false if the task is invalid, e.g. its period or
+     *         deadline exceeds Task::MaxPeriod_ms, or already added.
+     */
+    bool add(Task& task) noexcept;
+
+    /**
+     * @brief Remove task from the scheduler.
+     * 
+     * @param[in] task Reference to the task to remove.
+     */
+    void remove(Task& task) noexcept;
+
+    /**
+     * @brief Start or restart task, i.e. schedule it one period from now.
+     * 
+     * @param[in] task Reference to the task to restart. Must be added to the scheduler.
+     */
+    void restart(Task& task) noexcept;
+
+    /**
+     * @brief Stop task. A stopped task doesn't need to check in.
+     * 
+     * @param[in] task Reference to the task to stop.
+     */
+    void stop(Task& task) noexcept;
+
+    /**
+     * @brief Get the number of tasks added to the scheduler.
+     * 
+     * @return The number of tasks.
+     */
+    uint8_t taskCount() const noexcept;
+
+    /**
+     * @brief Run the due task with the highest priority, if any. Reset the watchdog timer
+     *        if every enabled task has checked in.
+     * 
+     * @return True if a task was run, false otherwise.
+     */
+    bool run() noexcept;
+
+    /**
+     * @brief Check whether every enabled task has checked in within its period plus 
+     *        its deadline.
+     * 
+     * @return True if every enabled task has checked in, false otherwise.
+     */
+    bool allTasksCheckedIn() const noexcept;
+
+    Scheduler()                            = delete; // No default constructor.
+    Scheduler(const Scheduler&)            = delete; // No copy constructor.
+    Scheduler(Scheduler&&)                 = delete; // No move constructor.
+    Scheduler& operator=(const Scheduler&) = delete; // No copy assignment.
+    Scheduler& operator=(Scheduler&&)      = delete; // No move assignment.
+
+private:
+    void runTask(Task& task) noexcept;
+
+    /** System clock used for scheduling. */
+    driver::clock::Interface& myClock;
+
+    /** Watchdog timer to reset. */
+    driver::watchdog::Interface& myWatchdog;
+
+    /** First task, the tasks are ordered by priority. */
+    Task* myTasks;
+
+    /** The number of tasks. */
+    uint8_t myTaskCount;
+};
+} // namespace scheduler
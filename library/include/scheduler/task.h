@@ -0,0 +1,178 @@
+/**
+ * @brief Task descriptor for the cooperative scheduler.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace scheduler
+{
+class Scheduler;
+
+/**
+ * @brief Task descriptor for the cooperative scheduler.
+ * 
+ *        A task consists of a function to run, either periodically or once after a delay.
+ *        The run time of each run is measured by the scheduler, which also counts the runs 
+ *        finished later than the deadline of the task. 
+ * 
+ *        Periods and deadlines are limited to MaxPeriod_ms, since the scheduler compares 
+ *        times as signed 32-bit microsecond differences. Tasks exceeding the limit are
+ *        rejected by the scheduler.
+ * 
+ *        Tasks are owned by the caller and linked into the scheduler, so no memory is 
+ *        allocated. A task must therefore outlive the scheduler or be removed before
+ *        being destroyed.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Task final
+{
+public:
+    /**
+     * @brief Enumeration of task modes.
+     */
+    enum class Mode : uint8_t
+    {
+        Periodic, // Run the task every period.
+        OneShot,  // Run the task once when the period has elapsed.
+    };
+
+    /** The max period and deadline in milliseconds (about 35 minutes). */
+    static constexpr uint32_t MaxPeriod_ms{INT32_MAX / 1000};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] function Function to run, invoked with the given context.
+     * @param[in] context Context passed to the function (default = none).
+     * @param[in] period_ms The task period, or the delay for one-shot tasks, in milliseconds.
+     *                      Must not exceed MaxPeriod_ms.
+     * @param[in] priority The task priority, 0 is the highest priority (default = 0).
+     * @param[in] mode The task mode (default = periodic).
+     * @param[in] deadline_ms Max time from the task is due until it has finished in 
+     *                        milliseconds. The period is used if 0 (default = 0). Must not
+     *                        exceed MaxPeriod_ms.
+     */
+    explicit Task(void (*function)(void*), void* context = nullptr, uint32_t period_ms = 0U,
+                  uint8_t priority = 0U, Mode mode = Mode::Periodic, 
+                  uint32_t deadline_ms = 0U) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Task() noexcept = default;
+
+    /**
+     * @brief Check whether the task is enabled, i.e. scheduled to run.
+     * 
+     * @return True if the task is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept;
+
+    /**
+     * @brief Get the task period.
+     * 
+     * @return The task period in milliseconds.
+     */
+    uint32_t period_ms() const noexcept;
+
+    /**
+     * @brief Get the task priority.
+     * 
+     * @return The task priority, 0 is the highest priority.
+     */
+    uint8_t priority() const noexcept;
+
+    /**
+     * @brief Get the task mode.
+     * 
+     * @return The task mode.
+     */
+    Mode mode() const noexcept;
+
+    /**
+     * @brief Get the number of finished runs.
+     * 
+     * @return The number of finished runs.
+     */
+    uint32_t runCount() const noexcept;
+
+    /**
+     * @brief Get the longest run time.
+     * 
+     * @return The longest run time in microseconds.
+     */
+    uint32_t maxRunTime_us() const noexcept;
+
+    /**
+     * @brief Get the average run time.
+     * 
+     * @return The average run time in microseconds, or 0 if the task hasn't run yet.
+     */
+    uint32_t averageRunTime_us() const noexcept;
+
+    /**
+     * @brief Get the number of runs finished later than the deadline.
+     * 
+     * @return The number of deadline misses.
+     */
+    uint32_t deadlineMissCount() const noexcept;
+
+    /**
+     * @brief Reset the run time and deadline statistics.
+     */
+    void resetStats() noexcept;
+
+    Task()                       = delete; // No default constructor.
+    Task(const Task&)            = delete; // No copy constructor.
+    Task(Task&&)                 = delete; // No move constructor.
+    Task& operator=(const Task&) = delete; // No copy assignment.
+    Task& operator=(Task&&)      = delete; // No move assignment.
+
+private:
+    friend class Scheduler;
+
+    /** Function to run. */
+    void (*myFunction)(void*);
+
+    /** Context passed to the function. */
+    void* myContext;
+
+    /** Next task in the scheduler, ordered by priority. */
+    Task* myNext;
+
+    /** The task period in microseconds. */
+    uint32_t myPeriod_us;
+
+    /** Max time from the task is due until it has finished in microseconds. */
+    uint32_t myDeadline_us;
+
+    /** The time at which the task is due in microseconds. */
+    uint32_t myDue_us;
+
+    /** The number of finished runs. */
+    uint32_t myRunCount;
+
+    /** The longest run time in microseconds. */
+    uint32_t myMaxRunTime_us;
+
+    /** The accumulated run time in microseconds. */
+    uint64_t myTotalRunTime_us;
+
+    /** The number of runs finished later than the deadline. */
+    uint32_t myDeadlineMissCount;
+
+    /** The task priority. */
+    uint8_t myPriority;
+
+    /** The task mode. */
+    Mode myMode;
+
+    /** Indicate whether the task is enabled. */
+    bool myEnabled;
+
+    /** Indicate whether the task is added to a scheduler. */
+    bool myAdded;
+};
+} // namespace scheduler
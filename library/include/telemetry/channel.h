@@ -0,0 +1,137 @@
+/**
+ * @brief Binary telemetry channel on top of a serial device.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "telemetry/cobs.h"
+#include "telemetry/record.h"
+
+namespace driver 
+{
+namespace serial { class Interface; }
+} // namespace driver
+
+namespace telemetry
+{
+/**
+ * @brief Binary telemetry channel on top of a serial device.
+ * 
+ *        Each record is sent in a frame consisting of the record type, a sequence number,
+ *        the payload (little endian) and a CRC-16 checksum (big endian) of the preceding bytes.
+ *        The frame is COBS encoded and terminated by a zero byte:
+ * 
+ *        | Type (1 byte) | Sequence (1 byte) | Payload (1-4 bytes) | CRC-16 (2 bytes) |
+ * 
+ *        A temperature record thereby takes up 8 bytes on the wire, compared to about 25 bytes
+ *        for a corresponding text printout.
+ */
+class Channel final
+{
+public:
+    /** Max payload size in bytes. */
+    static constexpr uint8_t MaxPayloadSize{4U};
+
+    /** Max frame size in bytes before encoding. */
+    static constexpr uint8_t MaxFrameSize{2U + MaxPayloadSize + 2U};
+
+    /** Max frame size in bytes on the wire, including the delimiter. */
+    static constexpr uint8_t MaxEncodedFrameSize{cobs::maxEncodedSize(MaxFrameSize) + 1U};
+
+    /**
+     * @brief Create new telemetry channel.
+     * 
+     * @param[in] serial Reference to the serial device to use.
+     */
+    explicit Channel(driver::serial::Interface& serial) noexcept;
+
+    /**
+     * @brief Delete the telemetry channel.
+     */
+    ~Channel() noexcept = default;
+
+    /**
+     * @brief Send temperature record.
+     * 
+     * @param[in] temperature_c The temperature in degrees Celsius.
+     * 
+     * @return True if the record was sent, false otherwise.
+     */
+    bool sendTemperature(int16_t temperature_c) noexcept;
+
+    /**
+     * @brief Send timestamp record.
+     * 
+     * @param[in] timestamp_ms The timestamp in milliseconds.
+     * 
+     * @return True if the record was sent, false otherwise.
+     */
+    bool sendTimestamp(uint32_t timestamp_ms) noexcept;
+
+    /**
+     * @brief Send event record.
+     * 
+     * @param[in] event The event code.
+     * 
+     * @return True if the record was sent, false otherwise.
+     */
+    bool sendEvent(EventCode event) noexcept;
+
+    /**
+     * @brief Receive the next record without blocking.
+     * 
+     *        Invalid frames, such as frames with checksum errors, are skipped and counted.
+     * 
+     * @param[out] record Reference to the record to store the received record in.
+     * 
+     * @return True if a record was received, false if no complete frame is available.
+     */
+    bool receive(Record& record) noexcept;
+
+    /**
+     * @brief Get the number of discarded invalid frames.
+     * 
+     * @return The number of discarded frames.
+     */
+    uint32_t rxErrorCount() const noexcept;
+
+    Channel()                          = delete; // No default constructor.
+    Channel(const Channel&)            = delete; // No copy constructor.
+    Channel(Channel&&)                 = delete; // No move constructor.
+    Channel& operator=(const Channel&) = delete; // No copy assignment.
+    Channel& operator=(Channel&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Send record.
+     * 
+     * @param[in] type The record type.
+     * @param[in] payload The payload value.
+     * @param[in] payloadSize The payload size in bytes.
+     * 
+     * @return True if the record was sent, false otherwise.
+     */
+    bool send(RecordType type, uint32_t payload, uint8_t payloadSize) noexcept;
+
+    /**
+     * @brief Decode and verify the given frame.
+     * 
+     * @param[in] encoded Pointer to the encoded frame, excluding the delimiter.
+     * @param[in] size The size of the encoded frame in bytes.
+     * @param[out] record Reference to the record to store the decoded record in.
+     * 
+     * @return True if the frame is valid, false otherwise.
+     */
+    bool decodeFrame(const uint8_t* encoded, uint16_t size, Record& record) const noexcept;
+
+    /** Serial device used for sending and receiving frames. */
+    driver::serial::Interface& mySerial;
+
+    /** Number of discarded invalid frames. */
+    uint32_t myRxErrorCount;
+
+    /** Sequence number of the next sent frame. */
+    uint8_t myTxSequence;
+};
+} // namespace telemetry
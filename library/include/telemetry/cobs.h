@@ -0,0 +1,59 @@
+/**
+ * @brief Consistent Overhead Byte Stuffing (COBS) used for framing telemetry data.
+ * 
+ *        COBS removes all zero bytes from the data at a cost of max one byte per 254 bytes, 
+ *        so that a zero byte can be used to delimit frames. A receiver can thereby always 
+ *        resynchronize at the next zero byte after lost or corrupt data.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace telemetry
+{
+namespace cobs
+{
+/** Frame delimiter, which never occurs in encoded data. */
+constexpr uint8_t Delimiter{0x00U};
+
+/**
+ * @brief Get the max size of encoded data.
+ * 
+ * @param[in] size The size of the data to encode in bytes.
+ * 
+ * @return The max size of the encoded data in bytes, excluding the delimiter.
+ */
+constexpr uint16_t maxEncodedSize(const uint16_t size) noexcept
+{
+    return static_cast<uint16_t>(size + size / 254U + 1U);
+}
+
+/**
+ * @brief Encode the given data.
+ * 
+ *        The encoded data contains no zero bytes. The delimiter isn't appended.
+ * 
+ * @param[in] input Pointer to the data to encode.
+ * @param[in] size The size of the data to encode in bytes.
+ * @param[out] output Buffer to store the encoded data in.
+ * @param[in] outputSize The size of the output buffer in bytes.
+ * 
+ * @return The size of the encoded data in bytes, or 0 if the output buffer is too small.
+ */
+uint16_t encode(const uint8_t* input, uint16_t size, uint8_t* output, uint16_t outputSize) noexcept;
+
+/**
+ * @brief Decode the given data.
+ * 
+ * @param[in] input Pointer to the data to decode, excluding the delimiter.
+ * @param[in] size The size of the data to decode in bytes.
+ * @param[out] output Buffer to store the decoded data in.
+ * @param[in] outputSize The size of the output buffer in bytes.
+ * 
+ * @return The size of the decoded data in bytes, or 0 if the data is invalid or if the output 
+ *         buffer is too small.
+ */
+uint16_t decode(const uint8_t* input, uint16_t size, uint8_t* output, uint16_t outputSize) noexcept;
+
+} // namespace cobs
+} // namespace telemetry
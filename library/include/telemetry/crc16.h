@@ -0,0 +1,30 @@
+/**
+ * @brief CRC-16 checksum used for detecting corrupt telemetry frames.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace telemetry
+{
+namespace crc16
+{
+/** Initial CRC value. */
+constexpr uint16_t InitValue{0xFFFFU};
+
+/**
+ * @brief Compute the CRC-16/CCITT-FALSE checksum (polynomial 0x1021) of the given data.
+ * 
+ *        Data can be checksummed in several parts by passing the checksum of the previous 
+ *        part as the initial value of the next.
+ * 
+ * @param[in] data Pointer to the data to checksum.
+ * @param[in] size The size of the data in bytes.
+ * @param[in] crc The initial CRC value (default = 0xFFFF).
+ * 
+ * @return The computed checksum.
+ */
+uint16_t compute(const uint8_t* data, uint16_t size, uint16_t crc = InitValue) noexcept;
+
+} // namespace crc16
+} // namespace telemetry
@@ -0,0 +1,45 @@
+/**
+ * @brief Typed telemetry records.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace telemetry
+{
+/**
+ * @brief Enumeration of record types.
+ */
+enum class RecordType : uint8_t
+{
+    Temperature = 0x01U, // Temperature in degrees Celsius.
+    Timestamp   = 0x02U, // Timestamp in milliseconds.
+    Event       = 0x03U, // Event code.
+};
+
+/**
+ * @brief Enumeration of event codes.
+ */
+enum class EventCode : uint8_t
+{
+    SystemStarted       = 0x01U, // The system is running.
+    InitFailed          = 0x02U, // The system failed to initialize.
+    ToggleTimerEnabled  = 0x03U, // The toggle timer was enabled.
+    ToggleTimerDisabled = 0x04U, // The toggle timer was disabled.
+    WatchdogReset       = 0x05U, // The system was reset by the watchdog timer.
+};
+
+/**
+ * @brief Structure holding a telemetry record.
+ * 
+ *        Only the value corresponding to the record type is used, the other values are 0.
+ */
+struct Record
+{
+    RecordType type;       // The record type.
+    uint8_t sequence;      // Sequence number, used for detecting lost frames.
+    int16_t temperature_c; // Temperature in degrees Celsius.
+    uint32_t timestamp_ms; // Timestamp in milliseconds.
+    EventCode event;       // Event code.
+};
+} // namespace telemetry
@@ -0,0 +1,43 @@
+/**
+ * @brief Type-safe formatting of strings without dynamic memory or intermediate buffers.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace utils
+{
+/**
+ * @brief Format the given arguments and stream the result to the given sink.
+ *
+ *        The format string uses printf-style specifiers, but the conversion of each argument
+ *        is selected at compile time from its type rather than from the specifier, hence
+ *        arguments can't be mismatched against the format string. Supported specifiers:
+ *
+ *        - %d, %i, %u: Integers of any width, printed in decimal form.
+ *        - %x, %X:     Integers printed in hexadecimal form (lower- or uppercase).
+ *        - %c:         Characters, integers are printed as the corresponding character.
+ *        - %s:         Null-terminated strings.
+ *        - %f:         Floating-point numbers printed in fixed-point notation.
+ *        - %p:         Pointers, printed as hexadecimal addresses.
+ *        - %%:         The percent character.
+ *
+ *        Flag 0 (zero padding), minimum field width and precision (number of decimals for
+ *        floating-point numbers, max number of characters for strings) are supported,
+ *        for instance %04X or %.2f. Length modifiers such as l and h are accepted but ignored,
+ *        since the argument type is already known. Specifiers without corresponding
+ *        arguments are printed as is.
+ *
+ * @tparam Sink Sink type, callable as sink(const char* data, uint16_t length).
+ * @tparam Args Parameter pack containing an arbitrary number of arguments.
+ *
+ * @param[in] sink Reference to the sink to stream the formatted characters to.
+ * @param[in] format The format string.
+ * @param[in] args Parameter pack containing the arguments to format.
+ */
+template <typename Sink, typename... Args>
+void format(Sink& sink, const char* format, const Args&... args) noexcept;
+
+} // namespace utils
+
+#include "impl/format_impl.h"
@@ -0,0 +1,393 @@
+/**
+ * @brief Implementation details of type-safe string formatting.
+ *
+ * @note Don't include this header, use <format.h> instead!
+ */
+#pragma once
+
+namespace utils
+{
+namespace detail
+{
+/** Default number of decimals of formatted floating-point numbers. */
+constexpr uint8_t DefaultPrecision{6U};
+
+/** Max number of decimals of formatted floating-point numbers. */
+constexpr uint8_t MaxPrecision{9U};
+
+/** Largest floating-point number that can be formatted (integral part must fit in 32 bits). */
+constexpr double MaxFormattedFloat{4294967295.0};
+
+/**
+ * @brief Structure holding a parsed format specifier.
+ */
+struct FormatSpec
+{
+    char conversion;  // Conversion character, such as 'd' or 'x'.
+    uint8_t width;    // Minimum field width.
+    int8_t precision; // Precision, or -1 if not specified.
+    bool zeroPad;     // Indicate whether to pad numbers with zeros instead of spaces.
+};
+
+/**
+ * @brief Structure used for getting the unsigned counterpart of integral types.
+ *
+ * @tparam T The integral type.
+ */
+template <typename T> struct UnsignedOf { typedef T type; };
+template <> struct UnsignedOf<char> { typedef unsigned char type; };
+template <> struct UnsignedOf<signed char> { typedef unsigned char type; };
+template <> struct UnsignedOf<short> { typedef unsigned short type; };
+template <> struct UnsignedOf<int> { typedef unsigned int type; };
+template <> struct UnsignedOf<long> { typedef unsigned long type; };
+template <> struct UnsignedOf<long long> { typedef unsigned long long type; };
+
+// -----------------------------------------------------------------------------
+constexpr bool isHexConversion(const char conversion) noexcept
+{
+    return ('x' == conversion) || ('X' == conversion) || ('p' == conversion);
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool isNumericConversion(const char conversion) noexcept
+{
+    return ('d' == conversion) || ('i' == conversion) || ('u' == conversion) ||
+        isHexConversion(conversion);
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool isDigit(const char character) noexcept
+{
+    return ('0' <= character) && ('9' >= character);
+}
+
+// -----------------------------------------------------------------------------
+inline const char* parseSpec(const char* it, FormatSpec& spec) noexcept
+{
+    spec = FormatSpec{'\0', 0U, -1, false};
+
+    if ('0' == *it)
+    {
+        spec.zeroPad = true;
+        ++it;
+    }
+
+    // Parse field width and precision, both limited to two digits.
+    for (; isDigit(*it); ++it)
+    {
+        if (10U > spec.width) { spec.width = spec.width * 10U + static_cast<uint8_t>(*it - '0'); }
+    }
+
+    if ('.' == *it)
+    {
+        spec.precision = 0;
+
+        for (++it; isDigit(*it); ++it)
+        {
+            if (10 > spec.precision)
+            {
+                spec.precision = static_cast<int8_t>(spec.precision * 10 + (*it - '0'));
+            }
+        }
+    }
+
+    // Skip length modifiers, the argument type is already known.
+    while (('h' == *it) || ('l' == *it) || ('z' == *it)) { ++it; }
+
+    spec.conversion = *it;
+    return *it ? it + 1U : it;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeRepeated(Sink& sink, const char character, uint8_t count) noexcept
+{
+    for (; 0U < count; --count) { sink(&character, 1U); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+const char* writeLiteral(Sink& sink, const char* format) noexcept
+{
+    const char* start{format};
+
+    // Write the text up to next format specifier in one go, merge %% into a single %.
+    while (*format)
+    {
+        if ('%' == *format)
+        {
+            if ('%' != format[1U]) { break; }
+            sink(start, static_cast<uint16_t>(format - start + 1U));
+            format += 2U;
+            start = format;
+        }
+        else { ++format; }
+    }
+
+    if (format != start) { sink(start, static_cast<uint16_t>(format - start)); }
+    return format;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink, typename U>
+void writeDigits(Sink& sink, U magnitude, const bool negative, const FormatSpec& spec) noexcept
+{
+    const char* digitChars{'X' == spec.conversion ? "0123456789ABCDEF" : "0123456789abcdef"};
+    const U base{static_cast<U>(isHexConversion(spec.conversion) ? 16U : 10U)};
+
+    // Generate the digits backwards, the buffer fits the decimal digits of any integral type.
+    char digits[sizeof(U) * 3U];
+    char* const end{digits + sizeof(digits)};
+    char* first{end};
+
+    do
+    {
+        *--first = digitChars[magnitude % base];
+        magnitude = static_cast<U>(magnitude / base);
+    } while (0U < magnitude);
+
+    const uint8_t length{static_cast<uint8_t>((end - first) + (negative ? 1U : 0U))};
+    const uint8_t padding{static_cast<uint8_t>(spec.width > length ? spec.width - length : 0U)};
+
+    if (!spec.zeroPad) { writeRepeated(sink, ' ', padding); }
+    if (negative) { sink("-", 1U); }
+    if (spec.zeroPad) { writeRepeated(sink, '0', padding); }
+    sink(first, static_cast<uint16_t>(end - first));
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink, typename T>
+void writeInteger(Sink& sink, const T value, const FormatSpec& spec) noexcept
+{
+    typedef typename UnsignedOf<T>::type Unsigned;
+
+    if ('c' == spec.conversion)
+    {
+        const char character{static_cast<char>(value)};
+        sink(&character, 1U);
+        return;
+    }
+
+    // Print negative numbers in two's complement form in hexadecimal form, just like printf.
+    const bool negative{!isHexConversion(spec.conversion) && (static_cast<T>(0) > value)};
+    const Unsigned magnitude{negative ? static_cast<Unsigned>(0U - static_cast<Unsigned>(value))
+                                      : static_cast<Unsigned>(value)};
+    writeDigits(sink, magnitude, negative, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeString(Sink& sink, const char* str, const FormatSpec& spec) noexcept
+{
+    if (nullptr == str) { str = "(null)"; }
+    uint16_t length{0U};
+
+    // The precision is the max number of characters to print, if specified.
+    while (str[length] && ((0 > spec.precision) || (length < static_cast<uint16_t>(spec.precision))))
+    {
+        ++length;
+    }
+
+    if (spec.width > length) { writeRepeated(sink, ' ', static_cast<uint8_t>(spec.width - length)); }
+    sink(str, length);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeFloat(Sink& sink, double value, const FormatSpec& spec) noexcept
+{
+    // Check for NaN, which is the only value not equal to itself.
+    if (value != value)
+    {
+        writeString(sink, "nan", FormatSpec{'s', spec.width, -1, false});
+        return;
+    }
+
+    const bool negative{0.0 > value};
+    const uint8_t precision{0 > spec.precision ? DefaultPrecision :
+        (MaxPrecision < spec.precision ? MaxPrecision : static_cast<uint8_t>(spec.precision))};
+    uint32_t scale{1U};
+
+    for (uint8_t i{}; i < precision; ++i) { scale *= 10U; }
+
+    // Round half away from zero by adding half of the last decimal before truncation.
+    if (negative) { value = -value; }
+    value += 0.5 / scale;
+
+    if (MaxFormattedFloat < value)
+    {
+        writeString(sink, negative ? "-ovf" : "ovf", FormatSpec{'s', spec.width, -1, false});
+        return;
+    }
+
+    const uint32_t integral{static_cast<uint32_t>(value)};
+    uint32_t fraction{static_cast<uint32_t>((value - integral) * scale)};
+    if (scale <= fraction) { fraction = scale - 1U; }
+
+    // Let the integral part take up the width not used by the decimals.
+    const uint8_t decimalsLength{static_cast<uint8_t>(0U < precision ? precision + 1U : 0U)};
+    const uint8_t integralWidth{
+        static_cast<uint8_t>(spec.width > decimalsLength ? spec.width - decimalsLength : 0U)};
+
+    writeDigits(sink, integral, negative, FormatSpec{'u', integralWidth, -1, spec.zeroPad});
+
+    if (0U < precision)
+    {
+        sink(".", 1U);
+        writeDigits(sink, fraction, false, FormatSpec{'u', precision, -1, true});
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const char value, const FormatSpec& spec) noexcept
+{
+    // Print characters as numbers only if a numeric conversion is requested.
+    if (isNumericConversion(spec.conversion)) { writeInteger(sink, value, spec); }
+    else { sink(&value, 1U); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const bool value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, static_cast<unsigned char>(value), spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const signed char value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const unsigned char value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const short value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const unsigned short value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const int value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const unsigned int value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const long value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const unsigned long value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const long long value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const unsigned long long value, const FormatSpec& spec) noexcept
+{
+    writeInteger(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const double value, const FormatSpec& spec) noexcept
+{
+    writeFloat(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const float value, const FormatSpec& spec) noexcept
+{
+    writeFloat(sink, static_cast<double>(value), spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void writeArg(Sink& sink, const char* value, const FormatSpec& spec) noexcept
+{
+    writeString(sink, value, spec);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink, typename T>
+void writeArg(Sink& sink, const T* value, const FormatSpec& spec) noexcept
+{
+    sink("0x", 2U);
+    writeDigits(sink, reinterpret_cast<uintptr_t>(value), false,
+                FormatSpec{'x', spec.width, -1, spec.zeroPad});
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink>
+void formatArgs(Sink& sink, const char* format) noexcept
+{
+    // No arguments left, print remaining specifiers as is.
+    while (*format)
+    {
+        format = writeLiteral(sink, format);
+        if (*format) { sink(format++, 1U); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Sink, typename T, typename... Args>
+void formatArgs(Sink& sink, const char* format, const T& arg, const Args&... args) noexcept
+{
+    format = writeLiteral(sink, format);
+
+    // Ignore superfluous arguments.
+    if (!*format) { return; }
+
+    FormatSpec spec{};
+    format = parseSpec(format + 1U, spec);
+    writeArg(sink, arg, spec);
+    formatArgs(sink, format, args...);
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename Sink, typename... Args>
+void format(Sink& sink, const char* format, const Args&... args) noexcept
+{
+    if (nullptr == format) { return; }
+    detail::formatArgs(sink, format, args...);
+}
+
+} // namespace utils
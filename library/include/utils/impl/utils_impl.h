@@ -5,6 +5,17 @@
  */
 #pragma once
 
+#ifdef __AVR__
+// -----------------------------------------------------------------------------
+inline void* operator new(size_t, void* address) noexcept { return address; }
+#else
+#include <new>
+#endif
+
+#ifdef MEMORY_STATS
+#include "memory/stats.h"
+#endif
+
 namespace utils
 {
 // -----------------------------------------------------------------------------
@@ -120,43 +131,66 @@ constexpr bool inRange(const T number, const T min, const T max) noexcept
     return ((min <= number) && (max >= number));
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args) noexcept
+{
+    return new (address) T(forward<Args>(args)...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void destroy(T* object) noexcept
+{
+    object->~T();
+}
+
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
 inline T* newObject(Args&&... args) noexcept
 {
     auto block{newMemory<T>()};
-    if (block) { *block = T{forward<Args>(args)...}; }
-    return block;
+    return block ? construct(block, forward<Args>(args)...) : nullptr;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline T* newMemory(const size_t size) noexcept
 {
+#ifdef MEMORY_STATS
+    return static_cast<T*>(memory::stats::allocate(sizeof(T) * size));
+#else
     return static_cast<T*>(malloc(sizeof(T) * size));
+#endif
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline T* reallocMemory(T* block, const size_t newSize) noexcept
 {
+#ifdef MEMORY_STATS
+    return static_cast<T*>(memory::stats::reallocate(block, sizeof(T) * newSize));
+#else
     return static_cast<T*>(realloc(block, sizeof(T) * newSize));
+#endif
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline void deleteMemory(T* &block) noexcept
 {
+#ifdef MEMORY_STATS
+    memory::stats::release(block);
+#else
     free(block);
+#endif
     block = nullptr;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline T move(T&& source) noexcept
+constexpr typename RemoveReference<T>::type&& move(T&& object) noexcept
 {
-    T copy{source};
-    source = {};
-    return copy;
+    return static_cast<typename RemoveReference<T>::type&&>(object);
 }
 } // namespace utils
\ No newline at end of file
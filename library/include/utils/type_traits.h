@@ -242,4 +242,16 @@ struct is_reference<T&>
 {
     static const bool value{true};
 };
+
+/**
+ * @brief Check if given type is trivially copyable, i.e. whether it can be copied and relocated
+ *        via raw memory operations such as memcpy and realloc.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_copyable
+{
+    static const bool value{__is_trivially_copyable(T)};
+};
 } // namespace type_traits
@@ -45,6 +45,28 @@ struct RemoveReference
     typedef T type;
 };
 
+/**
+ * @brief Specialization for lvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&>
+{
+    typedef T type;
+};
+
+/**
+ * @brief Specialization for rvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&&>
+{
+    typedef T type;
+};
+
 /**
  * @brief Maintain the value category of given object.
  *
@@ -75,6 +97,15 @@ void globalInterruptEnable() noexcept;
  */
 void globalInterruptDisable() noexcept;
 
+/**
+ * @brief Enable interrupts globally and enter idle sleep mode until the next interrupt.
+ * 
+ *        Interrupts are enabled right before sleeping, which means that an interrupt pending 
+ *        when calling this function wakes up the CPU immediately. Hence, call this function with
+ *        interrupts disabled after checking that there's no work left to avoid missed wakeups.
+ */
+void idleSleep() noexcept;
+
 /**
  * @brief Set a bit of the given register.
  *
@@ -217,6 +248,32 @@ constexpr T1 round(T2 value) noexcept;
 template <typename T>
 constexpr bool inRange(T number, T min, T max) noexcept;
 
+/**
+ * @brief Construct an object in place at given address via placement new.
+ *
+ * @tparam T The object type.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] address Pointer to uninitialized memory to construct the object at.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return A pointer to the constructed object.
+ */
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args) noexcept;
+
+/**
+ * @brief Destroy the object at given address by calling its destructor. 
+ * 
+ *        The memory of the object isn't released.
+ *
+ * @tparam T The object type.
+ * 
+ * @param[in] object Pointer to the object to destroy.
+ */
+template <typename T>
+inline void destroy(T* object) noexcept;
+
 /**
  * @brief Allocate a new object on the heap.
  *
@@ -273,18 +330,19 @@ template <typename T>
 inline void deleteMemory(T* &block) noexcept;
 
 /**
- * @brief Move memory from given source to a copy. 
+ * @brief Cast given object to an rvalue reference, enabling its resources to be moved.
  * 
- * The copy will gain ownership of memory and the source instance will be emptied.
+ *        The object itself is left untouched, it's the move constructor or move assignment 
+ *        operator receiving the rvalue reference that overtakes the resources.
  *
- * @tparam T The type of source and the copy.
+ * @tparam T The type of the object.
  * 
- * @param[in] source Reference to the source whose memory is moved.
+ * @param[in] object Reference to the object whose resources are to be moved.
  *
- * @return The copy of source.
+ * @return The object as an rvalue reference.
  */
 template <typename T>
-inline T move(T&& source) noexcept;
+constexpr typename RemoveReference<T>::type&& move(T&& object) noexcept;
 
 } // namespace utils
 
@@ -31,6 +31,8 @@ void executeAssemblyCmd(const std::string& cmd) noexcept
     else if ("CLI" == cmd) { CLR(SREG, I_FLAG); }
     // No-op: watchdog counter reset not needed in unit tests.
     else if ("WDR" == cmd) {}
+    // No-op: sleeping isn't needed in unit tests, interrupts are simulated by the tests.
+    else if ("SLEEP" == cmd) {}
 }
 
 // -----------------------------------------------------------------------------
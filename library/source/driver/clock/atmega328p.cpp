@@ -0,0 +1,145 @@
+/**
+ * @brief System clock driver implementation details for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/clock/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+namespace driver 
+{
+namespace clock
+{
+namespace 
+{
+/** Whole milliseconds between each timer overflow. */
+constexpr uint32_t OverflowMillis{Atmega328p::OverflowInterval_us / 1000UL};
+
+/** Remaining microseconds between each timer overflow. */
+constexpr uint16_t OverflowFraction_us{Atmega328p::OverflowInterval_us % 1000UL};
+
+/** Counter values below this value indicate that the counter has overflowed recently. */
+constexpr uint16_t HalfCounterRange{0x8000U};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Interface& Atmega328p::getInstance() noexcept
+{
+    // Create and initialize the singleton system clock instance (once only).
+    static Atmega328p myInstance{};
+
+    // Return a reference to the singleton clock instance, cast to the corresponding interface.
+    return myInstance; 
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setEnabled(const bool enable) noexcept
+{
+    if (enable == myEnabled) { return true; }
+
+    if (enable)
+    {
+        // Reserve Timer 1, return false if it's used by a timer.
+        if (!timer::Atmega328p::reserveTimer1(true)) { return false; }
+
+        // Let Timer 1 run freely from where it was stopped, enable the overflow interrupt.
+        TCCR1A = 0U;
+        TCNT1  = myPausedCounter;
+        TCCR1B = (1U << CS11);
+        utils::set(TIMSK1, TOIE1);
+        utils::globalInterruptEnable();
+    }
+    else
+    {
+        // Stop Timer 1 and save the counter value, then release Timer 1.
+        TCCR1B          = 0U;
+        utils::clear(TIMSK1, TOIE1);
+        myPausedCounter = TCNT1;
+        timer::Atmega328p::reserveTimer1(false);
+    }
+    myEnabled = enable;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::micros() const noexcept
+{
+    const Snapshot time{snapshot()};
+    return time.overflowCount * OverflowInterval_us + time.counter / CountsPerUs;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::millis() const noexcept
+{
+    const Snapshot time{snapshot()};
+    return time.ms + (time.fraction_us + time.counter / CountsPerUs) / 1000U;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::handleOverflow() noexcept
+{
+    Snapshot time{myOverflowCount, myMillis, myFraction_us, 0U};
+    addOverflow(time);
+    myOverflowCount = time.overflowCount;
+    myMillis        = time.ms;
+    myFraction_us   = time.fraction_us;
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p() noexcept
+    : myOverflowCount{0U}
+    , myMillis{0U}
+    , myFraction_us{0U}
+    , myPausedCounter{0U}
+    , myEnabled{false}
+{
+    setEnabled(true);
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Snapshot Atmega328p::snapshot() const noexcept
+{
+    // Disable interrupts to read the overflow count and the counter value consistently.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    Snapshot time{myOverflowCount, myMillis, myFraction_us, 
+                  myEnabled ? static_cast<uint16_t>(TCNT1) : myPausedCounter};
+
+    // Account for an overflow that occurred after interrupts were disabled. Such a pending
+    // overflow is only counted if the counter has wrapped around before it was read.
+    const bool overflowPending{myEnabled && utils::read(TIFR1, TOV1)};
+    SREG = sreg;
+
+    if (overflowPending && (HalfCounterRange > time.counter)) { addOverflow(time); }
+    return time;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::addOverflow(Snapshot& time) noexcept
+{
+    // Add the overflow interval, carry whole milliseconds.
+    time.overflowCount++;
+    time.ms          += OverflowMillis;
+    time.fraction_us += OverflowFraction_us;
+
+    if (1000U <= time.fraction_us) 
+    {
+        time.fraction_us -= 1000U;
+        time.ms++;
+    }
+}
+
+// -----------------------------------------------------------------------------
+ISR (TIMER1_OVF_vect) 
+{ 
+    static_cast<Atmega328p&>(Atmega328p::getInstance()).handleOverflow(); 
+}
+
+} // namespace clock
+} // namespace driver
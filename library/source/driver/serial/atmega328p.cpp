@@ -11,15 +11,77 @@ namespace serial
 {
 namespace
 {
-/** Baud rate in bps. */
-constexpr uint32_t BaudRate_bps{9600U};
-
 /** New line character. */
 constexpr char NewLine{'\n'};
 
 /** Carriage return character. */
 constexpr char CarriageReturn{'\r'};
 
+/** Mask used to wrap transmit buffer indexes. */
+constexpr uint8_t TxIndexMask{Atmega328p::TxBufferSize - 1U};
+
+// Generate a compiler error if the transmit buffer size can't be indexed with free-running
+// 8-bit indexes.
+static_assert((0U < Atmega328p::TxBufferSize) && (128U >= Atmega328p::TxBufferSize) &&
+              (0U == (Atmega328p::TxBufferSize & TxIndexMask)),
+              "Transmit buffer size must be a power of two in the range [1, 128]!");
+
+/** Characters queued for transmission. */
+uint8_t myTxBuffer[Atmega328p::TxBufferSize]{};
+
+/** Index of the next free position in the transmit buffer, only written by the caller. */
+volatile uint8_t myTxHead{};
+
+/** Index of the next character to transmit, only written when the interrupt can't fire. */
+volatile uint8_t myTxTail{};
+
+/** The number of characters discarded due to transmit buffer overflow. */
+volatile uint32_t myTxDropCount{};
+
+/** Indicate whether a character has been written since the transmitter was last idle. */
+volatile bool myTxActive{};
+
+/** Mask used to wrap receive buffer indexes. */
+constexpr uint8_t RxIndexMask{Atmega328p::RxBufferSize - 1U};
+
+// Generate a compiler error if the receive buffer size can't be indexed with free-running
+// 8-bit indexes.
+static_assert((0U < Atmega328p::RxBufferSize) && (128U >= Atmega328p::RxBufferSize) &&
+              (0U == (Atmega328p::RxBufferSize & RxIndexMask)),
+              "Receive buffer size must be a power of two in the range [1, 128]!");
+
+/** Received bytes waiting to be read. */
+uint8_t myRxBuffer[Atmega328p::RxBufferSize]{};
+
+/** Index of the next free position in the receive buffer, only written by the interrupt handler. */
+volatile uint8_t myRxHead{};
+
+/** Index of the next byte to read, only written by the reader. */
+volatile uint8_t myRxTail{};
+
+/** The number of received bytes discarded due to receive buffer overflow. */
+volatile uint32_t myRxDropCount{};
+
+// -----------------------------------------------------------------------------
+void writeDataReg(const char character) noexcept
+{
+    // Clear the transmit complete flag (by writing a one) before writing the character, so
+    // that the flag is set once this character has been shifted out.
+    utils::set(UCSR0A, TXC0);
+    UDR0       = character;
+    myTxActive = true;
+}
+
+// -----------------------------------------------------------------------------
+void waitForTxComplete() noexcept
+{
+    // The transmit complete flag is only set once a character has been shifted out, hence
+    // there's nothing to wait for if no character has been written since.
+    if (!myTxActive) { return; }
+    while (!utils::read(UCSR0A, TXC0));
+    myTxActive = false;
+}
+
 // -----------------------------------------------------------------------------
 void transmitChar(const char character) noexcept
 {
@@ -27,7 +89,151 @@ void transmitChar(const char character) noexcept
     while (!utils::read(UCSR0A, UDRE0));
 
     // Put the new character in the transmission register.
-    UDR0 = character;
+    writeDataReg(character);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t txQueuedCount() noexcept 
+{ 
+    // The indexes are free-running, so the difference is the number of queued characters.
+    return static_cast<uint8_t>(myTxHead - myTxTail); 
+}
+
+// -----------------------------------------------------------------------------
+bool isTxBufferFull() noexcept { return Atmega328p::TxBufferSize <= txQueuedCount(); }
+
+// -----------------------------------------------------------------------------
+void transmitQueuedChar() noexcept
+{
+    // Disable the data register empty interrupt once all queued characters have been sent.
+    if (0U == txQueuedCount()) 
+    { 
+        utils::clear(UCSR0B, UDRIE0); 
+        return;
+    }
+    // Put the oldest queued character in the transmission register.
+    writeDataReg(static_cast<char>(myTxBuffer[myTxTail & TxIndexMask]));
+    myTxTail = myTxTail + 1U;
+}
+
+// -----------------------------------------------------------------------------
+void waitForTxProgress() noexcept
+{
+    // The interrupt can't drain the buffer when interrupts are masked, for instance when 
+    // printing from another interrupt handler. Feed the data register manually in that case.
+    if (!utils::read(SREG, SREG_I) && utils::read(UCSR0A, UDRE0)) { transmitQueuedChar(); }
+}
+
+// -----------------------------------------------------------------------------
+void discardOldestChar() noexcept
+{
+    // Disable interrupts while moving the tail, since it's owned by the interrupt handler.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    // Check again, the interrupt handler may have made room before interrupts were disabled.
+    if (isTxBufferFull()) 
+    { 
+        myTxTail      = myTxTail + 1U; 
+        myTxDropCount = myTxDropCount + 1U;
+    }
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void queueChar(const char character, const Atmega328p::OverflowPolicy policy) noexcept
+{
+    using OverflowPolicy = Atmega328p::OverflowPolicy;
+
+    // Handle a full buffer according to the given overflow policy.
+    if (isTxBufferFull())
+    {
+        switch (policy)
+        {
+            case OverflowPolicy::Drop:
+                myTxDropCount = myTxDropCount + 1U;
+                return;
+            case OverflowPolicy::Block:
+                while (isTxBufferFull()) { waitForTxProgress(); }
+                break;
+            case OverflowPolicy::OverwriteOldest:
+                discardOldestChar();
+                break;
+            default:
+                return;
+        }
+    }
+    // Queue the character, then enable the interrupt to start transmission (if not running).
+    myTxBuffer[myTxHead & TxIndexMask] = static_cast<uint8_t>(character);
+    myTxHead = myTxHead + 1U;
+    utils::set(UCSR0B, UDRIE0);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t rxQueuedCount() noexcept 
+{ 
+    // The indexes are free-running, so the difference is the number of received bytes.
+    return static_cast<uint8_t>(myRxHead - myRxTail); 
+}
+
+// -----------------------------------------------------------------------------
+void receiveChar() noexcept
+{
+    // Always read the data register to clear the receive complete flag.
+    const uint8_t data{UDR0};
+
+    // Discard the received byte if the receive buffer is full.
+    if (Atmega328p::RxBufferSize <= rxQueuedCount())
+    {
+        myRxDropCount = myRxDropCount + 1U;
+        return;
+    }
+    myRxBuffer[myRxHead & RxIndexMask] = data;
+    myRxHead = myRxHead + 1U;
+}
+
+// -----------------------------------------------------------------------------
+void waitForRxProgress() noexcept
+{
+    // The interrupt can't fill the buffer when interrupts are masked, for instance when 
+    // reading from another interrupt handler. Poll the data register manually in that case.
+    if (!utils::read(SREG, SREG_I) && utils::read(UCSR0A, RXC0)) { receiveChar(); }
+}
+
+// -----------------------------------------------------------------------------
+uint16_t readReceived(uint8_t* buffer, const uint16_t size) noexcept
+{
+    // Read as many received bytes as fit in the given buffer.
+    const uint16_t queuedCount{rxQueuedCount()};
+    const uint16_t bytesToRead{size < queuedCount ? size : queuedCount};
+
+    for (uint16_t i{}; i < bytesToRead; ++i)
+    {
+        buffer[i] = myRxBuffer[myRxTail & RxIndexMask];
+        myRxTail  = myRxTail + 1U;
+    }
+    return bytesToRead;
+}
+
+// -----------------------------------------------------------------------------
+void sendChar(const char character, const bool buffered, 
+              const Atmega328p::OverflowPolicy policy) noexcept
+{
+    if (buffered) { queueChar(character, policy); }
+    else { transmitChar(character); }
+}
+
+// -----------------------------------------------------------------------------
+void sendText(const char character, const bool buffered, 
+              const Atmega328p::OverflowPolicy policy) noexcept
+{
+    // Always combine new lines with carriage returns.
+    if ((NewLine == character) || (CarriageReturn == character)) 
+    { 
+        sendChar(NewLine, buffered, policy); 
+        sendChar(CarriageReturn, buffered, policy); 
+    }
+    else { sendChar(character, buffered, policy); }
 }
 } // namespace 
 
@@ -42,7 +248,20 @@ Interface& Atmega328p::getInstance() noexcept
 }
 
 // -----------------------------------------------------------------------------
-uint32_t Atmega328p::baudRate_bps() const noexcept { return BaudRate_bps; }
+uint32_t Atmega328p::baudRate_bps() const noexcept { return myBaudRate_bps; }
+
+// -----------------------------------------------------------------------------
+int32_t Atmega328p::baudRateError_ppm() const noexcept { return myBaudRateError_ppm; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setBaudRate(const uint32_t baudRate_bps, const uint32_t maxError_ppm) noexcept
+{
+    // Leave the baud rate unchanged if it can't be generated accurately enough.
+    const BaudRateConfig config{baudRateConfig(baudRate_bps, maxError_ppm)};
+    if (!config.isValid) { return false; }
+    applyBaudRate(config);
+    return true;
+}
 
 // -----------------------------------------------------------------------------
 bool Atmega328p::isInitialized() const noexcept { return true; }
@@ -67,9 +286,8 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
         // Read indefinitely until the buffer is full if no timeout has been specified.
         while (bytesRead < size)
         {
-            // Wait until a byte has been received.
-            while (!utils::read(UCSR0A, RXC0));
-            buffer[bytesRead++] = UDR0;
+            waitForRxProgress();
+            bytesRead += readReceived(buffer + bytesRead, size - bytesRead);
         }
     }
     else
@@ -78,10 +296,8 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
         for (uint16_t i{}; i < timeout_ms; ++i)
         {
             // Read all available bytes.
-            while ((size > bytesRead) && utils::read(UCSR0A, RXC0))
-            {
-                buffer[bytesRead++] = UDR0;
-            }
+            waitForRxProgress();
+            bytesRead += readReceived(buffer + bytesRead, size - bytesRead);
 
             // Stop reading if the read buffer is full.
             if (size == bytesRead) { break; }
@@ -95,23 +311,147 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
 }
 
 // -----------------------------------------------------------------------------
-Atmega328p::Atmega328p() noexcept 
-    : myEnabled{true}
+uint16_t Atmega328p::available() const noexcept { return rxQueuedCount(); }
+
+// -----------------------------------------------------------------------------
+int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size) const noexcept
+{
+    // Check the input parameters, return -1 if invalid.
+    if ((nullptr == buffer) || (size == 0U)) { return -1; }
+
+    // Read the bytes received so far, don't wait for more.
+    return static_cast<int16_t>(readReceived(buffer, size));
+}
+
+// -----------------------------------------------------------------------------
+int16_t Atmega328p::readUntil(uint8_t* buffer, const uint16_t size, 
+                              const uint8_t delimiter) const noexcept
+{
+    // Check the input parameters, return -1 if invalid.
+    if ((nullptr == buffer) || (size == 0U)) { return -1; }
+
+    // Search the received bytes for the delimiter.
+    const uint8_t queuedCount{rxQueuedCount()};
+    const uint8_t tail{myRxTail};
+    uint16_t length{};
+
+    for (uint8_t i{}; i < queuedCount; ++i)
+    {
+        if (delimiter == myRxBuffer[(tail + i) & RxIndexMask])
+        {
+            length = i + 1U;
+            break;
+        }
+    }
+
+    // Wait for the delimiter unless the read buffer or the receive buffer is full.
+    if (0U == length)
+    {
+        if ((size > queuedCount) && (RxBufferSize > queuedCount)) { return 0; }
+        length = queuedCount;
+    }
+    return static_cast<int16_t>(readReceived(buffer, size < length ? size : length));
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::rxDropCount() const noexcept { return myRxDropCount; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::handleRxInterrupt() noexcept { receiveChar(); }
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::txFreeSpace() const noexcept
+{
+    // No characters are queued in blocking mode.
+    return TxMode::Buffered == myTxMode ? TxBufferSize - txQueuedCount() : 0U;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Atmega328p::write(const uint8_t* buffer, const uint16_t size) const noexcept
+{
+    if ((nullptr == buffer) || (0U == size) || (INT16_MAX < size)) { return -1; }
+    if (!myEnabled) { return 0; }
+
+    // Queue the bytes in buffered mode, otherwise transmit them one by one.
+    const bool buffered{TxMode::Buffered == myTxMode};
+
+    for (uint16_t i{}; i < size; ++i)
+    {
+        sendChar(static_cast<char>(buffer[i]), buffered, myOverflowPolicy);
+    }
+    return static_cast<int16_t>(size);
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::TxMode Atmega328p::txMode() const noexcept { return myTxMode; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setTxMode(const TxMode mode) noexcept
+{
+    // Transmit queued characters before switching to blocking mode to preserve the order.
+    if (TxMode::Blocking == mode) { flush(); }
+    else { utils::globalInterruptEnable(); }
+    myTxMode = mode;
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::OverflowPolicy Atmega328p::overflowPolicy() const noexcept { return myOverflowPolicy; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setOverflowPolicy(const OverflowPolicy policy) noexcept 
 { 
-    // Baud rate value corresponding to 9600 kbps.
-    constexpr uint16_t baudRateValue{103U};
+    myOverflowPolicy = policy; 
+}
 
-    // Enable UART transmission.
-    utils::set(UCSR0B, TXEN0, RXEN0);
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::txDropCount() const noexcept { return myTxDropCount; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::flush() noexcept
+{
+    while (0U < txQueuedCount()) { waitForTxProgress(); }
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::handleTxInterrupt() noexcept { transmitQueuedChar(); }
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p() noexcept 
+    : myBaudRate_bps{0U}
+    , myBaudRateError_ppm{0}
+    , myEnabled{true}
+    , myTxMode{TxMode::Blocking}
+    , myOverflowPolicy{OverflowPolicy::Block}
+{ 
+    // Enable UART transmission and reception, buffer received bytes via interrupts.
+    utils::set(UCSR0B, TXEN0, RXEN0, RXCIE0);
+    utils::globalInterruptEnable();
 
     // Set the data size to eight bits per byte.
     utils::set(UCSR0C, UCSZ00, UCSZ01);
 
-    // Set the baud rate to 9600 kbps.
-    UBRR0 = baudRateValue;
+    // Set the default baud rate, the settings are computed at compile time.
+    setBaudRate<DefaultBaudRate_bps>();
 
     // Send carriage return to align the first message left.
-    UDR0 = CarriageReturn;
+    writeDataReg(CarriageReturn);
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::applyBaudRate(const BaudRateConfig& config) noexcept
+{
+    // Transmit queued characters with the current baud rate first. The last character may
+    // still be in the data or shift register once the queue is empty, and would be garbled
+    // if the baud rate changed before it has been shifted out.
+    flush();
+    waitForTxComplete();
+
+    if (config.doubleSpeed) { utils::set(UCSR0A, U2X0); }
+    else { utils::clear(UCSR0A, U2X0); }
+
+    UBRR0               = config.ubrr;
+    myBaudRate_bps      = config.baudRate_bps;
+    myBaudRateError_ppm = config.error_ppm;
 }
 
 // -----------------------------------------------------------------------------
@@ -120,17 +460,28 @@ void Atmega328p::print(const char* message) const noexcept
     // Terminate the function if serial transmission isn't enabled.
     if (!myEnabled) { return; }
 
-    // Transmit each character of the string one by one.
-    for (const char* it{message}; *it; ++it)
-    {   
-        // Always combine new lines with carriage returns.
-        if ((NewLine == *it) || (CarriageReturn == *it)) 
-        { 
-            transmitChar(NewLine); 
-            transmitChar(CarriageReturn); 
-        }
-        else { transmitChar(*it); }
-    }
+    // Queue the characters in buffered mode, otherwise transmit them one by one.
+    const bool buffered{TxMode::Buffered == myTxMode};
+
+    for (const char* it{message}; *it; ++it) { sendText(*it, buffered, myOverflowPolicy); }
 }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::print(const char* data, const uint16_t length) const noexcept
+{
+    // Terminate the function if serial transmission isn't enabled.
+    if ((!myEnabled) || (nullptr == data)) { return; }
+
+    // Queue the characters in buffered mode, otherwise transmit them one by one.
+    const bool buffered{TxMode::Buffered == myTxMode};
+
+    for (uint16_t i{}; i < length; ++i) { sendText(data[i], buffered, myOverflowPolicy); }
+}
+
+// -----------------------------------------------------------------------------
+ISR (USART_RX_vect) { receiveChar(); }
+
+// -----------------------------------------------------------------------------
+ISR (USART_UDRE_vect) { transmitQueuedChar(); }
 } // namespace serial
 } // namespace driver
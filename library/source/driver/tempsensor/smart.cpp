@@ -8,7 +8,7 @@ namespace tempsensor
 
 Smart::Smart(uint8_t channel,
              adc::Interface& adc,
-             const ml::lin_reg::Fixed& model) noexcept
+             const ml::lin_reg::Interface& model) noexcept
     : m_channel(channel)
     , m_adc(adc)
     , m_model(model)
@@ -66,6 +66,9 @@ Atmega328p* myTimers[CircuitCount]{};
 /** Array holding pointers to callbacks. */
 CallbackArray<CircuitCount> myCallbacks{};
 
+/** Indicate whether Timer 1 is reserved for use outside the timer driver. */
+bool myTimer1Reserved{false};
+
 // -----------------------------------------------------------------------------
 constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
 {
@@ -178,6 +181,15 @@ void Atmega328p::handleCallback() noexcept
 	}
 }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::reserveTimer1(const bool reserve) noexcept
+{
+	// Timer 1 can't be reserved while used by a timer.
+	if (reserve && !myTimer1Reserved && (nullptr != myTimers[Index::Timer1])) { return false; }
+	myTimer1Reserved = reserve;
+	return true;
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::addCallback(void (*callback)()) const noexcept
 { 
@@ -204,6 +216,7 @@ Atmega328p::Hardware* Atmega328p::Hardware::reserve() noexcept
 	// Reserve a timer circuit if any is available, otherwise return a nullptr.
     for (uint8_t i{}; i < CircuitCount; ++i)
 	{
+        if ((Index::Timer1 == i) && myTimer1Reserved) { continue; }
         if (nullptr == myTimers[i]) { return init(i); }
 	}
 	return nullptr;
@@ -0,0 +1,138 @@
+/**
+ * @brief Implementation details of software timer.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+#include "utils/utils.h"
+
+namespace driver 
+{
+namespace timer
+{
+// -----------------------------------------------------------------------------
+Software::Software(Wheel& wheel, const uint32_t timeout_ms, void (*callback)(), 
+                   const bool startTimer, const Mode mode) noexcept
+    : myWheel{wheel}
+    , myCallback{callback}
+    , myNext{nullptr}
+    , myPrevNext{nullptr}
+    , myExpiry{0U}
+    , myTimeoutTicks{toTicks(timeout_ms)}
+    , myMode{mode}
+    , myEnabled{false}
+    , myTimedOut{false}
+{
+    if (startTimer) { start(); }
+}
+
+// -----------------------------------------------------------------------------
+Software::~Software() noexcept { stop(); }
+
+// -----------------------------------------------------------------------------
+bool Software::isInitialized() const noexcept { return 0U < myTimeoutTicks; }
+
+// -----------------------------------------------------------------------------
+bool Software::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+bool Software::hasTimedOut() const noexcept { return myTimedOut; }
+
+// -----------------------------------------------------------------------------
+uint32_t Software::timeout_ms() const noexcept
+{
+    const uint64_t timeout_us{static_cast<uint64_t>(myTimeoutTicks) * myWheel.tickInterval_us()};
+    return static_cast<uint32_t>((timeout_us + 500U) / 1000U);
+}
+
+// -----------------------------------------------------------------------------
+void Software::setTimeout_ms(const uint32_t timeout_ms) noexcept
+{
+    // Ignore the user if he/she attempts to set the timeout to 0.
+    if (0U == timeout_ms) { return; }
+    myTimeoutTicks = toTicks(timeout_ms);
+}
+
+// -----------------------------------------------------------------------------
+void Software::start() noexcept
+{
+    if (0U == myTimeoutTicks) { return; }
+
+    // Prevent the wheel from being updated by the timer interrupt meanwhile.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    if (nullptr == myPrevNext) { myWheel.schedule(*this, myWheel.tickCount() + myTimeoutTicks); }
+    myEnabled  = true;
+    myTimedOut = false;
+    SREG       = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void Software::stop() noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    if (nullptr != myPrevNext) { myWheel.cancel(*this); }
+    myEnabled  = false;
+    myTimedOut = false;
+    SREG       = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void Software::toggle() noexcept
+{
+    if (myEnabled) { stop(); }
+    else { start(); }
+}
+
+// -----------------------------------------------------------------------------
+void Software::restart() noexcept
+{
+    if (0U == myTimeoutTicks) { return; }
+
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    if (nullptr != myPrevNext) { myWheel.cancel(*this); }
+    myWheel.schedule(*this, myWheel.tickCount() + myTimeoutTicks);
+    myEnabled  = true;
+    myTimedOut = false;
+    SREG       = sreg;
+}
+
+// -----------------------------------------------------------------------------
+Software::Mode Software::mode() const noexcept { return myMode; }
+
+// -----------------------------------------------------------------------------
+void Software::setMode(const Mode mode) noexcept { myMode = mode; }
+
+// -----------------------------------------------------------------------------
+void Software::handleTimeout() noexcept
+{
+    // Schedule the next timeout relative to this one to prevent drift.
+    if (Mode::Periodic == myMode) { myWheel.schedule(*this, myExpiry + myTimeoutTicks); }
+    else { myEnabled = false; }
+
+    // Invoke the callback on timeout, then clear the timeout flag.
+    myTimedOut = true;
+
+    if (nullptr != myCallback) 
+    { 
+        myCallback(); 
+        myTimedOut = false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Software::toTicks(const uint32_t timeout_ms) const noexcept
+{
+    if (0U == timeout_ms) { return 0U; }
+    const uint32_t tickInterval_us{myWheel.tickInterval_us()};
+    const uint64_t ticks{(static_cast<uint64_t>(timeout_ms) * 1000U + tickInterval_us / 2U) / 
+                         tickInterval_us};
+    return 0U < ticks ? static_cast<uint32_t>(ticks) : 1U;
+}
+} // namespace timer
+} // namespace driver
@@ -0,0 +1,153 @@
+/**
+ * @brief Implementation details of hierarchical timing wheel.
+ */
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+
+namespace driver 
+{
+namespace timer
+{
+namespace
+{
+/** Mask used for getting slot indexes. */
+constexpr uint8_t SlotMask{Wheel::SlotCount - 1U};
+
+/** Max number of ticks ahead a timer can expire without being cascaded from the top level. */
+constexpr uint32_t MaxDelta{(1UL << (Wheel::SlotBits * Wheel::LevelCount)) - 1UL};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t slotIndex(const uint32_t tick, const uint8_t level) noexcept
+{
+    return static_cast<uint8_t>((tick >> (Wheel::SlotBits * level)) & SlotMask);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Wheel::Wheel(const uint32_t tickInterval_us) noexcept
+    : mySlots{}
+    , myTickInterval_us{0U < tickInterval_us ? tickInterval_us : 1U}
+    , myTickCount{0U}
+    , myActiveTimerCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+Wheel::~Wheel() noexcept
+{
+    // Stop all timers, since they can't run without the wheel.
+    for (auto& level : mySlots)
+    {
+        for (auto& slot : level)
+        {
+            while (nullptr != slot) 
+            { 
+                Software* timer{slot};
+                cancel(*timer);
+                timer->myEnabled = false;
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Wheel::tickInterval_us() const noexcept { return myTickInterval_us; }
+
+// -----------------------------------------------------------------------------
+uint32_t Wheel::tickCount() const noexcept { return myTickCount; }
+
+// -----------------------------------------------------------------------------
+uint16_t Wheel::activeTimerCount() const noexcept { return myActiveTimerCount; }
+
+// -----------------------------------------------------------------------------
+void Wheel::tick() noexcept
+{
+    const uint32_t now{myTickCount + 1U};
+    myTickCount = now;
+
+    // Cascade each level whose lower levels have wrapped around, highest level first.
+    for (uint8_t level{LevelCount - 1U}; 0U < level; --level)
+    {
+        if (0U == (now & ((1UL << (SlotBits * level)) - 1UL))) { cascade(level); }
+    }
+
+    // Handle the timers expiring now. Detach them first, so that the callbacks can safely
+    // start and stop any timer.
+    Software* expired{nullptr};
+    detach(mySlots[0U][slotIndex(now, 0U)], expired);
+
+    while (nullptr != expired)
+    {
+        Software* timer{expired};
+        cancel(*timer);
+        timer->handleTimeout();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::schedule(Software& timer, const uint32_t expiry) noexcept
+{
+    timer.myExpiry = expiry;
+    insert(timer);
+    ++myActiveTimerCount;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::cancel(Software& timer) noexcept
+{
+    // Let the preceding pointer point at the next timer, which then points back at it.
+    *timer.myPrevNext = timer.myNext;
+    if (nullptr != timer.myNext) { timer.myNext->myPrevNext = timer.myPrevNext; }
+    timer.myNext     = nullptr;
+    timer.myPrevNext = nullptr;
+    --myActiveTimerCount;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::insert(Software& timer) noexcept
+{
+    // Put timers expiring too far ahead in the top level slot cascaded last before the expiry,
+    // they're then inserted again with the remaining time.
+    const uint32_t delta{timer.myExpiry - myTickCount};
+    const uint32_t target{MaxDelta < delta ? myTickCount + MaxDelta : timer.myExpiry};
+    const uint32_t targetDelta{target - myTickCount};
+
+    // Select the lowest level that spans the time until the expiry.
+    uint8_t level{0U};
+    while ((LevelCount > level + 1U) && (0U != (targetDelta >> (SlotBits * (level + 1U)))))
+    {
+        ++level;
+    }
+
+    // Push the timer to the front of the slot.
+    Software*& slot{mySlots[level][slotIndex(target, level)]};
+    timer.myNext     = slot;
+    timer.myPrevNext = &slot;
+    if (nullptr != slot) { slot->myPrevNext = &timer.myNext; }
+    slot = &timer;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::detach(Software*& slot, Software*& list) noexcept
+{
+    list = slot;
+    slot = nullptr;
+    if (nullptr != list) { list->myPrevNext = &list; }
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::cascade(const uint8_t level) noexcept
+{
+    Software* list{nullptr};
+    detach(mySlots[level][slotIndex(myTickCount, level)], list);
+
+    // Insert the timers again, which puts them in a lower level.
+    while (nullptr != list)
+    {
+        Software* timer{list};
+        list = timer->myNext;
+        if (nullptr != list) { list->myPrevNext = &list; }
+        insert(*timer);
+    }
+}
+} // namespace timer
+} // namespace driver
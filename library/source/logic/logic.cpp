@@ -11,6 +11,9 @@
 #include "driver/timer/interface.h"
 #include "driver/watchdog/interface.h"
 #include "logic/logic.h"
+#include "memory/stats.h"
+#include "scheduler/scheduler.h"
+#include "utils/utils.h"
 
 namespace logic
 {
@@ -35,6 +38,11 @@ Logic::Logic(driver::gpio::Interface& led,
     , myWatchdog{watchdog}
     , myEeprom{eeprom}
     , myTempSensor{tempSensor}
+    , myEvents{}
+    , myDroppedEventCount{0U}
+    , myScheduler{nullptr}
+    , myToggleTask{runToggleTask, this, toggleTimer.timeout_ms(), ToggleTaskPriority}
+    , myTempTask{runTempTask, this, tempTimer.timeout_ms(), TempTaskPriority}
 {
     // Enable system if all hardware drivers were initialized correctly.
     if (isInitialized())
@@ -54,6 +62,13 @@ Logic::Logic(driver::gpio::Interface& led,
 // -----------------------------------------------------------------------------
 Logic::~Logic() noexcept
 {
+    // Remove the tasks from the scheduler, if any.
+    if (nullptr != myScheduler) 
+    { 
+        myScheduler->remove(myToggleTask);
+        myScheduler->remove(myTempTask);
+    }
+
     // Disable system.
     myLed.write(false);
     myToggleButton.enableInterrupt(false);
@@ -99,9 +114,48 @@ void Logic::run(const bool& stop) noexcept
 
     while (!stop) 
     { 
-        // Regularly reset the watchdog to avoid system reset.
-        myWatchdog.reset(); 
+        // Regularly reset the watchdog to avoid system reset. The scheduler resets the
+        // watchdog if used, once all tasks have checked in.
+        bool taskRun{false};
+        if (nullptr != myScheduler) { taskRun = myScheduler->run(); }
+        else { myWatchdog.reset(); }
+        handleEvents();
+        handleSerialCommands();
+
+        // Sleep until the next interrupt unless an event was posted meanwhile. The check is 
+        // done with interrupts disabled, otherwise an event posted right before sleeping 
+        // wouldn't be handled until the next interrupt. Check for due tasks before sleeping 
+        // if a task was run, since lower priority tasks may be due as well.
+        utils::globalInterruptDisable();
+        if (myEvents.empty() && !taskRun) { utils::idleSleep(); }
+        else { utils::globalInterruptEnable(); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::postEvent(const Event event) noexcept
+{
+    if (myEvents.push(event)) { return true; }
+    myDroppedEventCount = myDroppedEventCount + 1U;
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Logic::droppedEventCount() const noexcept { return myDroppedEventCount; }
+
+// -----------------------------------------------------------------------------
+bool Logic::registerTasks(scheduler::Scheduler& scheduler) noexcept
+{
+    if (nullptr != myScheduler) { return false; }
+    if (!scheduler.add(myToggleTask)) { return false; }
+
+    if (!scheduler.add(myTempTask))
+    {
+        scheduler.remove(myToggleTask);
+        return false;
     }
+    myScheduler = &scheduler;
+    return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -132,12 +186,7 @@ void Logic::handleButtonEvent() noexcept
 void Logic::handleDebounceTimerTimeout() noexcept
 {
     // Re-enable interrupts on the ports after debounce timer timeout.
-    if (myDebounceTimer.hasTimedOut())
-    {
-        myDebounceTimer.stop();
-        myToggleButton.enableInterruptOnPort(true);
-        myTempButton.enableInterruptOnPort(true);
-    }
+    if (myDebounceTimer.hasTimedOut()) { endDebounce(); }
 }
 
 // -----------------------------------------------------------------------------
@@ -199,6 +248,7 @@ void Logic::handleTempButtonPressed() noexcept
     // Restart the temperature timer.
     printTemperature();
     myTempTimer.restart();
+    if (nullptr != myScheduler) { myScheduler->restart(myTempTask); }
 }
 
 // -----------------------------------------------------------------------------
@@ -211,4 +261,68 @@ void Logic::restoreToggleStateFromEeprom() noexcept
         mySerial.printf("Toggle timer enabled!\n");
     }
 }
+
+// -----------------------------------------------------------------------------
+void Logic::handleEvents() noexcept
+{
+    // Handle all posted events in the order they were posted.
+    Event event{};
+    while (myEvents.pop(event)) { handleEvent(event); }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::handleSerialCommands() noexcept
+{
+    // Handle received commands one byte at a time, unknown commands are ignored.
+    uint8_t command{};
+    while (mySerial.read(&command, 1U) > 0)
+    {
+        if (MemoryStatsCommand == command) { memory::stats::print(mySerial); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::handleEvent(const Event event) noexcept
+{
+    // The timeout flags are cleared once the timer callbacks return, so the state of the 
+    // timers is checked instead. Events posted before a timer was stopped are thereby ignored.
+    switch (event)
+    {
+        case Event::ButtonPressed:
+            handleButtonEvent();
+            break;
+        case Event::DebounceTimerTimeout:
+            if (myDebounceTimer.isEnabled()) { endDebounce(); }
+            break;
+        case Event::ToggleTimerTimeout:
+            if (myToggleTimer.isEnabled()) { myLed.toggle(); }
+            break;
+        case Event::TempTimerTimeout:
+            if (myTempTimer.isEnabled()) { printTemperature(); }
+            break;
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::runToggleTask(void* context) noexcept
+{
+    static_cast<Logic*>(context)->handleEvent(Event::ToggleTimerTimeout);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::runTempTask(void* context) noexcept
+{
+    static_cast<Logic*>(context)->handleEvent(Event::TempTimerTimeout);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::endDebounce() noexcept
+{
+    // Re-enable interrupts on the ports after the debounce period.
+    myDebounceTimer.stop();
+    myToggleButton.enableInterruptOnPort(true);
+    myTempButton.enableInterruptOnPort(true);
+}
 } // namespace logic
\ No newline at end of file
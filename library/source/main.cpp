@@ -7,23 +7,34 @@
  *            - A blink timer to toggle an LED when enabled.
  *            - A temperature timer to print the temperature on timeout.
  *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
- *            - A serial device to print serial data via UART.
+ *            - A tick timer driving a timing wheel, on which the blink, temperature and debounce
+ *              timers run as software timers. This way only one hardware timer is used.
+ *            - A cooperative scheduler running the LED toggling and the temperature printouts
+ *              as tasks, timed by the system clock. The blink and temperature timers only
+ *              indicate whether the corresponding task is active.
+ *            - A serial device to print serial data via UART. Send 'm' to print the heap
+ *              and stack usage.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
- *            - A temperature sensor to read the surrounding temperature.
+ *            - A temperature sensor to read the surrounding temperature, using a linear
+ *              regression model trained at compile time.
  */
 #include "driver/adc/atmega328p.h"
+#include "driver/clock/atmega328p.h"
 #include "driver/eeprom/atmega328p.h"
 #include "driver/gpio/atmega328p.h"
 #include "driver/serial/atmega328p.h"
 #include "driver/tempsensor/smart.h"
 #include "driver/tempsensor/tmp36.h"
 #include "driver/timer/atmega328p.h"
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
 #include "driver/watchdog/atmega328p.h"
 #include "logic/logic.h"
-#include "ml/lin_reg/fixed.h"
-#include "ml/types.h"
+#include "memory/stats.h"
+#include "ml/lin_reg/constant.h"
+#include "scheduler/scheduler.h"
 
 using namespace driver;
 
@@ -32,62 +43,47 @@ namespace
 /** Pointer to the logic implementation. */
 logic::Interface* myLogic{nullptr};
 
+/** Pointer to the timing wheel driving the software timers. */
+timer::Wheel* myWheel{nullptr};
+
 namespace callback
 {
 /**
  * @brief Callback for the buttons.
  * 
- *        This callback is invoked when a button event occurs.
+ *        This callback is invoked when a button event occurs. The event is handled by the
+ *        run loop of the logic implementation.
  */
-void button() noexcept { myLogic->handleButtonEvent(); }
+void button() noexcept { myLogic->postEvent(logic::Event::ButtonPressed); }
 
 /**
  * @brief Callback for the debounce timer.
  * 
  *        This callback is invoked when the debounce timer times out.
  */
-void debounceTimer() noexcept { myLogic->handleDebounceTimerTimeout(); }
-
-/**
- * @brief Callback for the toggle timer.
- * 
- *        This callback is invoked when the toggle timer times out.
- */
-void toggleTimer() noexcept { myLogic->handleToggleTimerTimeout(); }
+void debounceTimer() noexcept { myLogic->postEvent(logic::Event::DebounceTimerTimeout); }
 
 /**
- * @brief Callback for the temperature timer.
+ * @brief Callback for the tick timer.
  * 
- *        This callback is invoked when the temperature timer times out.
+ *        This callback is invoked when the tick timer times out.
  */
-void tempTimer() noexcept { myLogic->handleTempTimerTimeout(); }
+void tickTimer() noexcept { myWheel->tick(); }
 
 } // namespace callback
 
-/**
- * @brief Train fixed linear regression model to predict temperature based on the input voltage.
- * 
- * @param[in] model The model to train.
- * 
- * @return True on success, false on failure.
- */
-bool trainModel(ml::lin_reg::Fixed& model) noexcept
-{
-    // Training parameters.
-    constexpr size_t epochCount{100U};
-    constexpr double learningRate{0.01};
-
-    // Training data to teach the model to predict T = 100 * Uin - 50.
-    const ml::Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 
-                               0.5, 0.6, 0.7, 0.8, 0.9, 
-                               1.0, 1.1, 1.2, 1.3, 1.4};
-    const ml::Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 
-                                0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 
-                                60.0, 70.0, 80.0, 90.0, 100.0};
-
-    // Train the model, return the result.
-    return model.train(trainIn, trainOut, epochCount, learningRate);
-}
+/** Training data input values, the input voltage. */
+constexpr double TrainIn[]{0.0, 0.1, 0.2, 0.3, 0.4, 
+                           0.5, 0.6, 0.7, 0.8, 0.9, 
+                           1.0, 1.1, 1.2, 1.3, 1.4};
+
+/** Training data output values, the temperature T = 100 * Uin - 50. */
+constexpr double TrainOut[]{-50.0, -40.0, -30.0, -20.0, -10.0, 
+                            0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 
+                            60.0, 70.0, 80.0, 90.0, 100.0};
+
+/** Coefficients of the temperature model, fitted by the compiler. */
+constexpr ml::lin_reg::Line TempLine{ml::lin_reg::fitLine(TrainIn, TrainOut)};
 } // namespace
 
 /**
@@ -97,13 +93,18 @@ bool trainModel(ml::lin_reg::Fixed& model) noexcept
  */
 int main()
 {
+    // Paint the unused stack memory, so that the max stack usage can be queried via serial.
+    memory::stats::paintStack();
+
     // Set pin numbers.
     constexpr uint8_t tempSensorPin{2U};
     constexpr uint8_t ledPin{5U};
     constexpr uint8_t toggleButtonPin{4U};
     constexpr uint8_t tempButtonPin{7U};
 
-    // Set timeouts.
+    // Set timeouts, the tick timer times out every 8 interrupts, i.e. every 1.024 ms.
+    constexpr uint32_t tickTimerTimeout{1U};
+    constexpr uint32_t tickInterval_us{1024U};
     constexpr uint32_t debounceTimerTimeout{300U};
     constexpr uint32_t toggleTimerTimeout{100U};
     constexpr uint32_t tempTimerTimeout{60000U};
@@ -116,17 +117,30 @@ int main()
     gpio::Atmega328p toggleButton{toggleButtonPin, input, callback::button};
     gpio::Atmega328p tempButton{tempButtonPin, input, callback::button};
 
-    // Initialize the timers.
-    timer::Atmega328p debounceTimer{debounceTimerTimeout, callback::debounceTimer};
-    timer::Atmega328p toggleTimer{toggleTimerTimeout, callback::toggleTimer};
-    timer::Atmega328p tempTimer{tempTimerTimeout, callback::tempTimer};
+    // Initialize the timing wheel and the tick timer driving it.
+    timer::Wheel wheel{tickInterval_us};
+    myWheel = &wheel;
+    timer::Atmega328p tickTimer{tickTimerTimeout, callback::tickTimer, true};
+
+    // Initialize the software timers.
+    timer::Software debounceTimer{wheel, debounceTimerTimeout, callback::debounceTimer};
+    timer::Software toggleTimer{wheel, toggleTimerTimeout};
+    timer::Software tempTimer{wheel, tempTimerTimeout};
 
     // Obtain a reference to the singleton serial device instance.
-    auto& serial{serial::Atmega328p::getInstance()};
+    // Queue transmitted characters so that printing doesn't stall the system.
+    auto& serial{static_cast<serial::Atmega328p&>(serial::Atmega328p::getInstance())};
+    serial.setTxMode(serial::Atmega328p::TxMode::Buffered);
 
     // Obtain a reference to the singleton watchdog timer instance.
     auto& watchdog{watchdog::Atmega328p::getInstance()};
 
+    // Obtain a reference to the singleton system clock instance.
+    auto& clock{clock::Atmega328p::getInstance()};
+
+    // Initialize the scheduler, timed by the system clock.
+    scheduler::Scheduler scheduler{clock, watchdog};
+
     // Obtain a reference to the singleton EEPROM instance.
     auto& eeprom{eeprom::Atmega328p::getInstance()};
 
@@ -134,16 +148,8 @@ int main()
     auto& adc{adc::Atmega328p::getInstance()};
 
     // Create linear regression model that predicts temperature based on input voltage.
-    // Train the model and print the result. 
-    ml::lin_reg::Fixed model {};
-    if (trainModel(model))
-    {
-        serial.printf("Model trained successfully!\n");
-    }
-    else
-    {
-        serial.printf("Failed to train model!\n");
-    }
+    // The model is trained at compile time, hence no training is needed at startup.
+    const ml::lin_reg::Constant<TempLine> model{};
 
     // Initialize the smart temperature sensor.
     tempsensor::Smart tempSensor{tempSensorPin, adc, model};
@@ -161,6 +167,9 @@ int main()
                        tempSensor};
     myLogic = &logic;
 
+    // Run the periodic handlers as tasks of the scheduler, which also resets the watchdog.
+    logic.registerTasks(scheduler);
+
     // Run the application on the target MCU.
     const bool stop{false};
     myLogic->run(stop);
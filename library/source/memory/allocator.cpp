@@ -0,0 +1,19 @@
+/**
+ * @brief Implementation details of the allocator interface.
+ */
+#include <string.h>
+
+#include "memory/allocator.h"
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+void* Allocator::reallocate(void* block, const size_t size, const size_t newSize) noexcept
+{
+    auto copy{allocate(newSize)};
+    if ((nullptr == copy) || (nullptr == block)) { return copy; }
+    memcpy(copy, block, size < newSize ? size : newSize);
+    deallocate(block);
+    return copy;
+}
+} // namespace memory
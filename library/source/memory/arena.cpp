@@ -0,0 +1,98 @@
+/**
+ * @brief Implementation details of monotonic arena allocators.
+ */
+#include "memory/arena.h"
+
+namespace memory
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr size_t alignUp(const size_t value) noexcept
+{
+    return (value + alignof(max_align_t) - 1U) / alignof(max_align_t) * alignof(max_align_t);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Arena::Arena(void* buffer, const size_t bufferSize) noexcept
+    : myBuffer{nullptr}
+    , myCapacity{}
+    , myOffset{}
+    , myLastOffset{}
+    , myAllocationCount{}
+    , myFailureCount{}
+{
+    if (nullptr == buffer) { return; }
+
+    // Skip the bytes before the first aligned address of the buffer.
+    const auto address{reinterpret_cast<uintptr_t>(buffer)};
+    const auto offset{static_cast<size_t>(alignUp(address) - address)};
+    if (bufferSize <= offset) { return; }
+
+    myBuffer   = static_cast<uint8_t*>(buffer) + offset;
+    myCapacity = bufferSize - offset;
+}
+
+// -----------------------------------------------------------------------------
+void* Arena::allocate(const size_t size) noexcept
+{
+    const auto offset{alignUp(myOffset)};
+
+    if ((offset > myCapacity) || (size > myCapacity - offset))
+    {
+        ++myFailureCount;
+        return nullptr;
+    }
+    myLastOffset = offset;
+    myOffset     = offset + size;
+    ++myAllocationCount;
+    return myBuffer + offset;
+}
+
+// -----------------------------------------------------------------------------
+void Arena::deallocate(void*) noexcept {}
+
+// -----------------------------------------------------------------------------
+void* Arena::reallocate(void* block, const size_t size, const size_t newSize) noexcept
+{
+    if (nullptr == block) { return allocate(newSize); }
+
+    // Resize the most recent allocation in place, since nothing has been allocated after it.
+    if ((0U < myAllocationCount) && (myBuffer + myLastOffset == block))
+    {
+        if (newSize > myCapacity - myLastOffset)
+        {
+            ++myFailureCount;
+            return nullptr;
+        }
+        myOffset = myLastOffset + newSize;
+        return block;
+    }
+    return Allocator::reallocate(block, size, newSize);
+}
+
+// -----------------------------------------------------------------------------
+void Arena::reset() noexcept
+{
+    myOffset          = 0U;
+    myLastOffset      = 0U;
+    myAllocationCount = 0U;
+    myFailureCount    = 0U;
+}
+
+// -----------------------------------------------------------------------------
+size_t Arena::used() const noexcept { return myOffset; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::available() const noexcept { return myCapacity - myOffset; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::capacity() const noexcept { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::allocationCount() const noexcept { return myAllocationCount; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::failureCount() const noexcept { return myFailureCount; }
+} // namespace memory
@@ -0,0 +1,27 @@
+/**
+ * @brief Implementation details of the heap allocator.
+ */
+#include "memory/heap_allocator.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+void* HeapAllocator::allocate(const size_t size) noexcept
+{
+    return utils::newMemory<uint8_t>(size);
+}
+
+// -----------------------------------------------------------------------------
+void HeapAllocator::deallocate(void* block) noexcept
+{
+    auto bytes{static_cast<uint8_t*>(block)};
+    utils::deleteMemory(bytes);
+}
+
+// -----------------------------------------------------------------------------
+void* HeapAllocator::reallocate(void* block, const size_t, const size_t newSize) noexcept
+{
+    return utils::reallocMemory(static_cast<uint8_t*>(block), newSize);
+}
+} // namespace memory
@@ -0,0 +1,127 @@
+/**
+ * @brief Implementation details of fixed-block memory pools.
+ */
+#include "memory/pool.h"
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+Pool::Pool(void* buffer, const size_t bufferSize, const size_t blockSize) noexcept
+    : myBuffer{nullptr}
+    , myUsedFlags{nullptr}
+    , myFreeList{nullptr}
+    , myBlockSize{alignedBlockSize(blockSize)}
+    , myBlockCount{}
+    , myTouchedCount{}
+    , myUsedCount{}
+    , myPeakUsedCount{}
+{
+    if ((nullptr == buffer) || (0U == blockSize)) { return; }
+
+    // Skip the bytes before the first aligned address of the buffer.
+    const auto address{reinterpret_cast<uintptr_t>(buffer)};
+    const auto offset{static_cast<size_t>((alignof(max_align_t) - address % alignof(max_align_t))
+                                          % alignof(max_align_t))};
+    if (bufferSize <= offset) { return; }
+
+    // Reserve one bit per block after the blocks to track which blocks are in use.
+    const size_t size{bufferSize - offset};
+    myBlockCount = size / myBlockSize;
+    while (myBlockCount * myBlockSize + flagsSize(myBlockCount) > size) { --myBlockCount; }
+    myBuffer    = static_cast<uint8_t*>(buffer) + offset;
+    myUsedFlags = myBuffer + myBlockCount * myBlockSize;
+}
+
+// -----------------------------------------------------------------------------
+void* Pool::allocate(const size_t size) noexcept
+{
+    if (size > myBlockSize) { return nullptr; }
+    void* block{nullptr};
+
+    // Reuse released blocks first, then hand out blocks never used before.
+    if (nullptr != myFreeList)
+    {
+        block      = myFreeList;
+        myFreeList = myFreeList->next;
+        setUsed(blockIndex(block), true);
+    }
+    else if (myTouchedCount < myBlockCount)
+    {
+        // The flags are initialized as blocks are touched, so the buffer doesn't have to be.
+        if (0U == myTouchedCount % 8U) { myUsedFlags[myTouchedCount / 8U] = 0U; }
+        block = myBuffer + myTouchedCount * myBlockSize;
+        setUsed(myTouchedCount++, true);
+    }
+    else { return nullptr; }
+
+    if (++myUsedCount > myPeakUsedCount) { myPeakUsedCount = myUsedCount; }
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+void Pool::deallocate(void* block) noexcept
+{
+    // Only accept the start of blocks in use, pushing other memory to the free list would
+    // corrupt the pool. This includes blocks never handed out and double frees.
+    if (!owns(block)) { return; }
+    const auto offset{static_cast<size_t>(static_cast<uint8_t*>(block) - myBuffer)};
+    const size_t index{offset / myBlockSize};
+    if ((0U != offset % myBlockSize) || (myTouchedCount <= index) || !isUsed(index)) { return; }
+
+    setUsed(index, false);
+    auto freeBlock{static_cast<FreeBlock*>(block)};
+    freeBlock->next = myFreeList;
+    myFreeList      = freeBlock;
+    --myUsedCount;
+}
+
+// -----------------------------------------------------------------------------
+void* Pool::reallocate(void* block, const size_t, const size_t newSize) noexcept
+{
+    if (newSize > myBlockSize) { return nullptr; }
+    return nullptr != block ? block : allocate(newSize);
+}
+
+// -----------------------------------------------------------------------------
+bool Pool::owns(const void* block) const noexcept
+{
+    const auto address{static_cast<const uint8_t*>(block)};
+    return (nullptr != address) && (myBuffer <= address)
+        && (address < myBuffer + myBlockCount * myBlockSize);
+}
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockSize() const noexcept { return myBlockSize; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockCount() const noexcept { return myBlockCount; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::usedCount() const noexcept { return myUsedCount; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::peakUsedCount() const noexcept { return myPeakUsedCount; }
+
+// -----------------------------------------------------------------------------
+bool Pool::full() const noexcept { return myUsedCount == myBlockCount; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockIndex(const void* block) const noexcept
+{
+    return static_cast<size_t>(static_cast<const uint8_t*>(block) - myBuffer) / myBlockSize;
+}
+
+// -----------------------------------------------------------------------------
+bool Pool::isUsed(const size_t index) const noexcept
+{
+    return 0U != (myUsedFlags[index / 8U] & (1U << (index % 8U)));
+}
+
+// -----------------------------------------------------------------------------
+void Pool::setUsed(const size_t index, const bool used) noexcept
+{
+    const auto mask{static_cast<uint8_t>(1U << (index % 8U))};
+    if (used) { myUsedFlags[index / 8U] |= mask; }
+    else { myUsedFlags[index / 8U] &= static_cast<uint8_t>(~mask); }
+}
+} // namespace memory
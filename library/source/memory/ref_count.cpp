@@ -0,0 +1,85 @@
+/**
+ * @brief Implementation details of interrupt-guarded reference counts.
+ */
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+#include "memory/ref_count.h"
+
+namespace memory
+{
+namespace refcount
+{
+namespace
+{
+/**
+ * @brief Guard disabling interrupts during its lifetime.
+ *
+ *        The status register is restored on deletion, which keeps interrupts disabled if
+ *        they were disabled when the guard was created, e.g. in an interrupt service routine.
+ */
+class InterruptGuard final
+{
+public:
+    // -----------------------------------------------------------------------------
+    InterruptGuard() noexcept
+        : myStatus{SREG}
+    {
+        asm("CLI");
+    }
+
+    // -----------------------------------------------------------------------------
+    ~InterruptGuard() noexcept { SREG = myStatus; }
+
+    InterruptGuard(const InterruptGuard&)            = delete; // No copy constructor.
+    InterruptGuard(InterruptGuard&&)                 = delete; // No move constructor.
+    InterruptGuard& operator=(const InterruptGuard&) = delete; // No copy assignment.
+    InterruptGuard& operator=(InterruptGuard&&)      = delete; // No move assignment.
+
+private:
+    /** The status register when the guard was created. */
+    const uint8_t myStatus;
+};
+
+// -----------------------------------------------------------------------------
+inline volatile size_t& access(size_t& count) noexcept
+{
+    // Access the count as volatile, so it isn't moved outside the guarded section.
+    return *static_cast<volatile size_t*>(&count);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+void Guarded::increment(size_t& count) noexcept
+{
+    InterruptGuard guard{};
+    access(count) = access(count) + 1U;
+}
+
+// -----------------------------------------------------------------------------
+bool Guarded::incrementIfNonZero(size_t& count) noexcept
+{
+    InterruptGuard guard{};
+    const size_t value{access(count)};
+    if (value == 0U) { return false; }
+    access(count) = value + 1U;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+size_t Guarded::decrement(size_t& count) noexcept
+{
+    InterruptGuard guard{};
+    const size_t value{access(count) - 1U};
+    access(count) = value;
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+size_t Guarded::load(const size_t& count) noexcept
+{
+    InterruptGuard guard{};
+    return *static_cast<const volatile size_t*>(&count);
+}
+} // namespace refcount
+} // namespace memory
@@ -0,0 +1,178 @@
+/**
+ * @brief Implementation details of the heap and stack instrumentation.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/serial/interface.h"
+#include "memory/stats.h"
+
+#ifndef TESTSUITE
+extern "C"
+{
+/** Start of the heap, provided by the linker. */
+extern uint8_t __heap_start;
+
+/** Current end of the heap, provided by malloc (null until the first allocation). */
+extern void* __brkval;
+}
+#endif /** TESTSUITE */
+
+namespace memory
+{
+namespace stats
+{
+namespace
+{
+/**
+ * @brief Header prefixing each tracked block, holding the block size.
+ *
+ *        The header is aligned for any type, so the memory following it is aligned as well.
+ *        On AVR the header takes up the size field only, i.e. 2 bytes.
+ */
+struct alignas(max_align_t) Header
+{
+    /** The size of the block in bytes, excluding the header. */
+    size_t size;
+};
+
+/** Heap usage statistics. */
+Heap myHeap{};
+
+#ifndef TESTSUITE
+/** Start of the painted stack region, null until the stack has been painted. */
+const uint8_t* myStackBegin{nullptr};
+#endif /** TESTSUITE */
+
+// -----------------------------------------------------------------------------
+void addLiveBytes(const size_t size) noexcept
+{
+    myHeap.liveBytes += size;
+    if (myHeap.liveBytes > myHeap.peakBytes) { myHeap.peakBytes = myHeap.liveBytes; }
+}
+
+// -----------------------------------------------------------------------------
+inline Header* headerOf(void* block) noexcept { return static_cast<Header*>(block) - 1; }
+
+// -----------------------------------------------------------------------------
+inline bool fitsHeader(const size_t size) noexcept { return size <= SIZE_MAX - sizeof(Header); }
+} // namespace
+
+// -----------------------------------------------------------------------------
+Heap heap() noexcept { return myHeap; }
+
+// -----------------------------------------------------------------------------
+void resetHeap() noexcept
+{
+    myHeap.peakBytes       = myHeap.liveBytes;
+    myHeap.allocationCount = 0U;
+    myHeap.failureCount    = 0U;
+}
+
+// -----------------------------------------------------------------------------
+void* allocate(const size_t size) noexcept
+{
+    auto header{fitsHeader(size) ? static_cast<Header*>(malloc(sizeof(Header) + size)) : nullptr};
+
+    if (header == nullptr)
+    {
+        ++myHeap.failureCount;
+        return nullptr;
+    }
+    header->size = size;
+    ++myHeap.allocationCount;
+    addLiveBytes(size);
+    return header + 1;
+}
+
+// -----------------------------------------------------------------------------
+void* reallocate(void* block, const size_t newSize) noexcept
+{
+    if (block == nullptr) { return allocate(newSize); }
+
+    // Release the memory if the new size is 0, like realloc.
+    if (newSize == 0U)
+    {
+        release(block);
+        return nullptr;
+    }
+    const size_t size{headerOf(block)->size};
+    auto header{fitsHeader(newSize)
+        ? static_cast<Header*>(realloc(headerOf(block), sizeof(Header) + newSize)) : nullptr};
+
+    if (header == nullptr)
+    {
+        ++myHeap.failureCount;
+        return nullptr;
+    }
+    header->size     = newSize;
+    myHeap.liveBytes -= size;
+    ++myHeap.allocationCount;
+    addLiveBytes(newSize);
+    return header + 1;
+}
+
+// -----------------------------------------------------------------------------
+void release(void* block) noexcept
+{
+    if (block == nullptr) { return; }
+    auto header{headerOf(block)};
+    myHeap.liveBytes -= header->size;
+    free(header);
+}
+
+// -----------------------------------------------------------------------------
+void paintStack(uint8_t* begin, uint8_t* end) noexcept
+{
+    memset(begin, StackPaint, static_cast<size_t>(end - begin));
+}
+
+// -----------------------------------------------------------------------------
+size_t stackHighWaterMark(const uint8_t* begin, const uint8_t* end,
+                          const uint8_t* heapEnd) noexcept
+{
+    // Search upwards from the end of the heap, the stack grows downwards from the end of the
+    // region. Heap memory isn't painted anymore, hence it mustn't be searched.
+    auto byte{(begin < heapEnd) && (heapEnd <= end) ? heapEnd : begin};
+    while ((byte < end) && (*byte == StackPaint)) { ++byte; }
+    return static_cast<size_t>(end - byte);
+}
+
+// -----------------------------------------------------------------------------
+void paintStack() noexcept
+{
+#ifndef TESTSUITE
+    // Paint from the end of the heap to somewhat below the stack pointer. The loop is done
+    // in place, since calling a function would push its frame onto the memory being painted.
+    constexpr uint8_t margin{16U};
+    auto begin{__brkval ? static_cast<uint8_t*>(__brkval) : &__heap_start};
+    auto end{reinterpret_cast<uint8_t*>(SP) - margin};
+
+    for (volatile uint8_t* byte{begin}; byte < end; ++byte) { *byte = StackPaint; }
+    myStackBegin = begin;
+#endif /** TESTSUITE */
+}
+
+// -----------------------------------------------------------------------------
+size_t stackHighWaterMark() noexcept
+{
+#ifndef TESTSUITE
+    if (myStackBegin == nullptr) { return 0U; }
+    return stackHighWaterMark(myStackBegin, reinterpret_cast<const uint8_t*>(RAMEND) + 1U,
+                              static_cast<const uint8_t*>(__brkval));
+#else
+    return 0U;
+#endif /** TESTSUITE */
+}
+
+// -----------------------------------------------------------------------------
+bool print(const driver::serial::Interface& serial) noexcept
+{
+    return serial.printf("Heap: %u bytes live, %u bytes peak, %u allocations, %u failures\n"
+                         "Stack: %u bytes peak\n",
+                         myHeap.liveBytes, myHeap.peakBytes, myHeap.allocationCount,
+                         myHeap.failureCount, stackHighWaterMark());
+}
+} // namespace stats
+} // namespace memory
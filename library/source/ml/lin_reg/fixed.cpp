@@ -54,7 +54,7 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
     // Train the model the specified number of epochs.
     for (size_t epoch{}; epoch < epochCount; ++epoch)
     {
-        // Iterate through all training sets, skip randomization for simplicity.
+        // Iterate through all training sets in order, use ml::Trainer to shuffle them.
         for (size_t i{}; i < setCount; ++i)
         {
             optimize(trainIn[i], trainOut[i], learningRate);
@@ -65,6 +65,33 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
     return myTrained;
 }
 
+// -----------------------------------------------------------------------------
+bool Fixed::fit(const Matrix1d& trainIn, const Matrix2d& trainOut, Fit* result) noexcept
+{
+    Fit fit{};
+    if (!leastSquares(trainIn, trainOut, fit)) { return false; }
+
+    myWeight  = fit.weight;
+    myBias    = fit.bias;
+    myTrained = true;
+    if (result) { *result = fit; }
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+void Fixed::setParameters(const double weight, const double bias) noexcept
+{
+    myWeight  = weight;
+    myBias    = bias;
+    myTrained = true;
+}
+
+// -----------------------------------------------------------------------------
+double Fixed::weight() const noexcept { return myWeight; }
+
+// -----------------------------------------------------------------------------
+double Fixed::bias() const noexcept { return myBias; }
+
 // -----------------------------------------------------------------------------
 void Fixed::optimize(const double input, const double output, const double learningRate) noexcept
 {
@@ -0,0 +1,73 @@
+/**
+ * @brief Closed-form least-squares fitting implementation details.
+ */
+#include <math.h>
+
+#include "ml/lin_reg/least_squares.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+LeastSquares::LeastSquares() noexcept
+    : myCount{0U}
+    , myMeanIn{}
+    , myMeanOut{}
+    , mySumInIn{}
+    , mySumInOut{}
+    , mySumOutOut{}
+{}
+
+// -----------------------------------------------------------------------------
+void LeastSquares::add(const double input, const double output) noexcept
+{
+    // Update the means, then the centered sums with the deviations from the old and new means.
+    ++myCount;
+    const double deltaIn{input - myMeanIn};
+    const double deltaOut{output - myMeanOut};
+    myMeanIn  += deltaIn / myCount;
+    myMeanOut += deltaOut / myCount;
+
+    mySumInIn   += deltaIn * (input - myMeanIn);
+    mySumInOut  += deltaIn * (output - myMeanOut);
+    mySumOutOut += deltaOut * (output - myMeanOut);
+}
+
+// -----------------------------------------------------------------------------
+void LeastSquares::reset() noexcept { *this = LeastSquares{}; }
+
+// -----------------------------------------------------------------------------
+size_t LeastSquares::count() const noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+bool LeastSquares::solve(Fit& fit) const noexcept
+{
+    // The line is undefined unless there are at least two distinct inputs.
+    if ((2U > myCount) || (0.0 >= mySumInIn)) { return false; }
+
+    fit.weight = mySumInOut / mySumInIn;
+    fit.bias   = myMeanOut - fit.weight * myMeanIn;
+    fit.count  = myCount;
+
+    // The residual sum of squares follows from the centered sums, no second pass is needed.
+    // Clamp it at 0, since rounding errors may make it slightly negative for perfect fits.
+    const double residualSum{mySumOutOut - fit.weight * mySumInOut};
+    const double clampedSum{0.0 < residualSum ? residualSum : 0.0};
+
+    fit.rSquared         = 0.0 < mySumOutOut ? 1.0 - clampedSum / mySumOutOut : 1.0;
+    fit.residualMse      = clampedSum / myCount;
+    fit.residualStdError = 2U < myCount ? sqrt(clampedSum / (myCount - 2U)) : 0.0;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool leastSquares(const Matrix1d& trainIn, const Matrix2d& trainOut, Fit& fit) noexcept
+{
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    LeastSquares accumulator{};
+    for (size_t i{}; i < setCount; ++i) { accumulator.add(trainIn[i], trainOut[i]); }
+    return accumulator.solve(fit);
+}
+} // namespace lin_reg
+} // namespace ml
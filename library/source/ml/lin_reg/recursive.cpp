@@ -0,0 +1,89 @@
+/**
+ * @brief Online linear regression implementation details.
+ */
+#include "ml/lin_reg/recursive.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr bool isForgettingFactorValid(const double forgettingFactor) noexcept
+{
+    return (0.0 < forgettingFactor) && (1.0 >= forgettingFactor);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Recursive::Recursive(const double forgettingFactor, const double initialCovariance) noexcept
+    : myForgettingFactor{forgettingFactor}
+    , myInitialCovariance{initialCovariance}
+    , myWeight{}
+    , myBias{}
+    , myCovWeight{initialCovariance}
+    , myCovCross{}
+    , myCovBias{initialCovariance}
+    , mySampleCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+bool Recursive::isTrained() const noexcept { return 2U <= mySampleCount; }
+
+// -----------------------------------------------------------------------------
+double Recursive::predict(const double input) const noexcept { return myWeight * input + myBias; }
+
+// -----------------------------------------------------------------------------
+bool Recursive::update(const double input, const double output) noexcept
+{
+    if (!isForgettingFactorValid(myForgettingFactor) || (0.0 >= myInitialCovariance))
+    {
+        return false;
+    }
+    // Multiply the covariance with the regressor [input, 1].
+    const double gainWeight{myCovWeight * input + myCovCross};
+    const double gainBias{myCovCross * input + myCovBias};
+
+    // Scale the gain by the prediction variance, then correct the parameters by the error.
+    const double scale{1.0 / (myForgettingFactor + gainWeight * input + gainBias)};
+    const double error{output - predict(input)};
+    myWeight += gainWeight * scale * error;
+    myBias   += gainBias * scale * error;
+
+    // Update the covariance, skip forgetting if the covariance has grown too large.
+    myCovWeight -= gainWeight * gainWeight * scale;
+    myCovCross  -= gainWeight * gainBias * scale;
+    myCovBias   -= gainBias * gainBias * scale;
+
+    if (myCovWeight + myCovBias < 2.0 * myInitialCovariance)
+    {
+        myCovWeight /= myForgettingFactor;
+        myCovCross  /= myForgettingFactor;
+        myCovBias   /= myForgettingFactor;
+    }
+    ++mySampleCount;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Recursive::reset() noexcept
+{
+    myWeight      = 0.0;
+    myBias        = 0.0;
+    myCovWeight   = myInitialCovariance;
+    myCovCross    = 0.0;
+    myCovBias     = myInitialCovariance;
+    mySampleCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+double Recursive::weight() const noexcept { return myWeight; }
+
+// -----------------------------------------------------------------------------
+double Recursive::bias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+size_t Recursive::sampleCount() const noexcept { return mySampleCount; }
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,118 @@
+/**
+ * @brief Implementation details of the storage of linear regression model parameters.
+ */
+#include <string.h>
+
+#include "driver/eeprom/interface.h"
+#include "ml/lin_reg/storage.h"
+#include "telemetry/crc16.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace storage
+{
+namespace
+{
+/** Offset of the version field. */
+constexpr uint16_t VersionOffset{0U};
+
+/** Offset of the fingerprint field. */
+constexpr uint16_t FingerprintOffset{VersionOffset + sizeof(uint8_t)};
+
+/** Offset of the weight field. */
+constexpr uint16_t WeightOffset{FingerprintOffset + sizeof(uint16_t)};
+
+/** Offset of the bias field. */
+constexpr uint16_t BiasOffset{WeightOffset + sizeof(double)};
+
+/** Offset of the CRC field, i.e. the number of checksummed bytes. */
+constexpr uint16_t CrcOffset{BiasOffset + sizeof(double)};
+
+static_assert(CrcOffset + sizeof(uint16_t) == RecordSize, "Invalid record layout!");
+
+// -----------------------------------------------------------------------------
+void put16(uint8_t* record, const uint16_t offset, const uint16_t value) noexcept
+{
+    record[offset]      = static_cast<uint8_t>(value);
+    record[offset + 1U] = static_cast<uint8_t>(value >> 8U);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t get16(const uint8_t* record, const uint16_t offset) noexcept
+{
+    return static_cast<uint16_t>(record[offset] | (record[offset + 1U] << 8U));
+}
+
+// -----------------------------------------------------------------------------
+uint16_t checksum(const Matrix1d& data, uint16_t crc) noexcept
+{
+    for (const auto& value : data)
+    {
+        crc = telemetry::crc16::compute(reinterpret_cast<const uint8_t*>(&value), 
+                                        sizeof(value), crc);
+    }
+    return crc;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint16_t fingerprint(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Checksum the set sizes as well, so that moving a value from one set to the other counts.
+    const uint16_t sizes[]{static_cast<uint16_t>(trainIn.size()), 
+                           static_cast<uint16_t>(trainOut.size())};
+    const auto crc{telemetry::crc16::compute(reinterpret_cast<const uint8_t*>(sizes), 
+                                             sizeof(sizes))};
+    return checksum(trainOut, checksum(trainIn, crc));
+}
+
+// -----------------------------------------------------------------------------
+bool save(driver::eeprom::Interface& eeprom, const uint16_t address, 
+          const Parameters& parameters, const uint16_t fingerprint) noexcept
+{
+    // Serialize the record, doubles are stored as is since they're read back by the same MCU.
+    uint8_t record[RecordSize]{};
+    record[VersionOffset] = Version;
+    put16(record, FingerprintOffset, fingerprint);
+    memcpy(record + WeightOffset, &parameters.weight, sizeof(double));
+    memcpy(record + BiasOffset, &parameters.bias, sizeof(double));
+    put16(record, CrcOffset, telemetry::crc16::compute(record, CrcOffset));
+
+    // Write the bytes that differ, return false if any byte couldn't be accessed.
+    for (uint16_t i{}; i < RecordSize; ++i)
+    {
+        uint8_t stored{};
+        if (!eeprom.read(address + i, stored)) { return false; }
+        if ((stored != record[i]) && !eeprom.write(address + i, record[i])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+Status load(const driver::eeprom::Interface& eeprom, const uint16_t address, 
+            const uint16_t fingerprint, Parameters& parameters) noexcept
+{
+    uint8_t record[RecordSize]{};
+
+    for (uint16_t i{}; i < RecordSize; ++i)
+    {
+        if (!eeprom.read(address + i, record[i])) { return Status::Unavailable; }
+    }
+    // Check the checksum first, since the other fields can't be trusted otherwise.
+    if (telemetry::crc16::compute(record, CrcOffset) != get16(record, CrcOffset))
+    {
+        return Status::Corrupt;
+    }
+    if ((Version != record[VersionOffset]) || (fingerprint != get16(record, FingerprintOffset)))
+    {
+        return Status::Stale;
+    }
+    memcpy(&parameters.weight, record + WeightOffset, sizeof(double));
+    memcpy(&parameters.bias, record + BiasOffset, sizeof(double));
+    return Status::Valid;
+}
+} // namespace storage
+} // namespace lin_reg
+} // namespace ml
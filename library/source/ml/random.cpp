@@ -0,0 +1,33 @@
+/**
+ * @brief Pseudo-random number generator implementation details.
+ */
+#include "ml/random.h"
+
+namespace ml
+{
+// -----------------------------------------------------------------------------
+Random::Random(const uint32_t seed) noexcept
+    : myState{}
+{
+    this->seed(seed);
+}
+
+// -----------------------------------------------------------------------------
+void Random::seed(const uint32_t seed) noexcept { myState = 0U != seed ? seed : 1U; }
+
+// -----------------------------------------------------------------------------
+uint32_t Random::next() noexcept
+{
+    // Use Marsaglia's 13-17-5 triple, which yields the full period of 2^32 - 1.
+    myState ^= myState << 13U;
+    myState ^= myState >> 17U;
+    myState ^= myState << 5U;
+    return myState;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Random::next(const uint32_t bound) noexcept
+{
+    return 0U != bound ? next() % bound : 0U;
+}
+} // namespace ml
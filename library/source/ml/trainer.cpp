@@ -0,0 +1,86 @@
+/**
+ * @brief Mini-batch gradient descent trainer implementation details.
+ */
+#include "ml/trainer.h"
+
+namespace ml
+{
+// -----------------------------------------------------------------------------
+Trainer::Trainer(const TrainConfig& config,
+                 void (*epochCallback)(size_t epoch, double loss, void* context),
+                 void* context) noexcept
+    : myConfig{config}
+    , myEpochCallback{epochCallback}
+    , myContext{context}
+    , myRandom{config.seed}
+    , myOrder{}
+{}
+
+// -----------------------------------------------------------------------------
+const TrainConfig& Trainer::config() const noexcept { return myConfig; }
+
+// -----------------------------------------------------------------------------
+bool Trainer::isConfigValid() const noexcept
+{
+    if ((0U == myConfig.epochCount) || (0U == myConfig.batchSize)) { return false; }
+    if ((0.0 >= myConfig.learningRate) || (1.0 < myConfig.learningRate)) { return false; }
+    if (0.0 > myConfig.targetLoss) { return false; }
+
+    switch (myConfig.schedule)
+    {
+        case Schedule::Constant:
+            return true;
+        case Schedule::Step:
+            return (0U < myConfig.stepEpochs) && (0.0 < myConfig.decay) && (1.0 >= myConfig.decay);
+        case Schedule::Exponential:
+            return (0.0 < myConfig.decay) && (1.0 >= myConfig.decay);
+        case Schedule::InverseTime:
+            return 0.0 <= myConfig.decay;
+        default:
+            return false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool Trainer::initOrder(const size_t setCount) noexcept
+{
+    // Start each run in order with a reseeded generator, so that runs are reproducible.
+    if (!myOrder.resize(setCount)) { return false; }
+    for (size_t i{}; i < setCount; ++i) { myOrder[i] = i; }
+    myRandom.seed(myConfig.seed);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Trainer::shuffleOrder() noexcept
+{
+    // Shuffle the order with the Fisher-Yates algorithm.
+    for (size_t i{myOrder.size()}; i > 1U; --i)
+    {
+        const size_t j{myRandom.next(static_cast<uint32_t>(i))};
+        const size_t index{myOrder[i - 1U]};
+        myOrder[i - 1U] = myOrder[j];
+        myOrder[j]      = index;
+    }
+}
+
+// -----------------------------------------------------------------------------
+double Trainer::nextLearningRate(const double learningRate, const size_t epoch) const noexcept
+{
+    // Update the learning rate incrementally, which avoids calculating powers.
+    const size_t nextEpoch{epoch + 1U};
+
+    switch (myConfig.schedule)
+    {
+        case Schedule::Step:
+            return 0U == nextEpoch % myConfig.stepEpochs ? learningRate * myConfig.decay
+                                                         : learningRate;
+        case Schedule::Exponential:
+            return learningRate * myConfig.decay;
+        case Schedule::InverseTime:
+            return myConfig.learningRate / (1.0 + myConfig.decay * nextEpoch);
+        default:
+            return learningRate;
+    }
+}
+} // namespace ml
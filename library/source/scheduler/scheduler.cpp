@@ -0,0 +1,164 @@
+/**
+ * @brief Implementation details of cooperative task scheduler.
+ */
+#include "driver/clock/interface.h"
+#include "driver/watchdog/interface.h"
+#include "scheduler/scheduler.h"
+
+namespace scheduler
+{
+namespace
+{
+/** The max period and deadline in microseconds. */
+constexpr uint32_t MaxPeriod_us{Task::MaxPeriod_ms * 1000U};
+
+// -----------------------------------------------------------------------------
+constexpr int32_t elapsed_us(const uint32_t now_us, const uint32_t time_us) noexcept
+{
+    // Compute the difference as a signed value to handle the wrap-around of the clock.
+    return static_cast<int32_t>(now_us - time_us);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Scheduler::Scheduler(driver::clock::Interface& clock, 
+                     driver::watchdog::Interface& watchdog) noexcept
+    : myClock{clock}
+    , myWatchdog{watchdog}
+    , myTasks{nullptr}
+    , myTaskCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+Scheduler::~Scheduler() noexcept
+{
+    while (nullptr != myTasks) { remove(*myTasks); }
+}
+
+// -----------------------------------------------------------------------------
+bool Scheduler::add(Task& task) noexcept
+{
+    if (task.myAdded || (nullptr == task.myFunction) || (0U == task.myPeriod_us) ||
+        (MaxPeriod_us < task.myPeriod_us) || (MaxPeriod_us < task.myDeadline_us))
+    { 
+        return false; 
+    }
+
+    // Insert the task after all tasks with the same or higher priority.
+    Task** position{&myTasks};
+    while ((nullptr != *position) && ((*position)->myPriority <= task.myPriority))
+    {
+        position = &(*position)->myNext;
+    }
+    task.myNext  = *position;
+    *position    = &task;
+    task.myAdded = true;
+    myTaskCount++;
+    restart(task);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::remove(Task& task) noexcept
+{
+    for (Task** position{&myTasks}; nullptr != *position; position = &(*position)->myNext)
+    {
+        if (&task == *position)
+        {
+            *position      = task.myNext;
+            task.myNext    = nullptr;
+            task.myAdded   = false;
+            task.myEnabled = false;
+            myTaskCount--;
+            return;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::restart(Task& task) noexcept
+{
+    if (!task.myAdded) { return; }
+    task.myDue_us  = myClock.micros() + task.myPeriod_us;
+    task.myEnabled = true;
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::stop(Task& task) noexcept { task.myEnabled = false; }
+
+// -----------------------------------------------------------------------------
+uint8_t Scheduler::taskCount() const noexcept { return myTaskCount; }
+
+// -----------------------------------------------------------------------------
+bool Scheduler::run() noexcept
+{
+    // Run the first due task, which is the one with the highest priority.
+    const uint32_t now_us{myClock.micros()};
+    bool taskRun{false};
+
+    for (Task* task{myTasks}; nullptr != task; task = task->myNext)
+    {
+        if (task->myEnabled && (0 <= elapsed_us(now_us, task->myDue_us)))
+        {
+            runTask(*task);
+            taskRun = true;
+            break;
+        }
+    }
+
+    // Only reset the watchdog if no task has been starved or is stuck.
+    if (allTasksCheckedIn()) { myWatchdog.reset(); }
+    return taskRun;
+}
+
+// -----------------------------------------------------------------------------
+bool Scheduler::allTasksCheckedIn() const noexcept
+{
+    // A task has checked in unless it's overdue by more than its deadline.
+    const uint32_t now_us{myClock.micros()};
+
+    for (const Task* task{myTasks}; nullptr != task; task = task->myNext)
+    {
+        if (task->myEnabled && 
+            (static_cast<int32_t>(task->myDeadline_us) < elapsed_us(now_us, task->myDue_us)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::runTask(Task& task) noexcept
+{
+    const uint32_t start_us{myClock.micros()};
+    task.myFunction(task.myContext);
+    const uint32_t end_us{myClock.micros()};
+
+    // Update the run time statistics, count a deadline miss if the task finished too late.
+    const uint32_t runTime_us{end_us - start_us};
+    task.myRunCount++;
+    task.myTotalRunTime_us += runTime_us;
+    if (task.myMaxRunTime_us < runTime_us) { task.myMaxRunTime_us = runTime_us; }
+    if (static_cast<int32_t>(task.myDeadline_us) < elapsed_us(end_us, task.myDue_us)) 
+    { 
+        task.myDeadlineMissCount++; 
+    }
+
+    // The task may have been stopped or restarted by its own function.
+    if (!task.myEnabled || (0 < elapsed_us(task.myDue_us, start_us))) { return; }
+
+    if (Task::Mode::OneShot == task.myMode) 
+    { 
+        task.myEnabled = false; 
+        return;
+    }
+
+    // Schedule the next run one period after the previous one to prevent drift. Skip the 
+    // periods that have already elapsed instead of running the task repeatedly to catch up.
+    const int32_t lag_us{elapsed_us(end_us, task.myDue_us)};
+    const uint32_t periodCount{0 <= lag_us ? static_cast<uint32_t>(lag_us) / task.myPeriod_us + 1U
+                                           : 1U};
+    task.myDue_us += periodCount * task.myPeriod_us;
+}
+} // namespace scheduler
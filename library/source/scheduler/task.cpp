@@ -0,0 +1,75 @@
+/**
+ * @brief Implementation details of task descriptor.
+ */
+#include "scheduler/task.h"
+
+namespace scheduler
+{
+namespace
+{
+/** The number of microseconds per millisecond. */
+constexpr uint32_t UsPerMs{1000U};
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t toMicros(const uint32_t time_ms) noexcept
+{
+    // Saturate times above the limit instead of wrapping, so the scheduler can reject the task.
+    return Task::MaxPeriod_ms >= time_ms ? time_ms * UsPerMs : UINT32_MAX;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Task::Task(void (*function)(void*), void* context, const uint32_t period_ms, 
+           const uint8_t priority, const Mode mode, const uint32_t deadline_ms) noexcept
+    : myFunction{function}
+    , myContext{context}
+    , myNext{nullptr}
+    , myPeriod_us{toMicros(period_ms)}
+    , myDeadline_us{toMicros(0U < deadline_ms ? deadline_ms : period_ms)}
+    , myDue_us{0U}
+    , myRunCount{0U}
+    , myMaxRunTime_us{0U}
+    , myTotalRunTime_us{0U}
+    , myDeadlineMissCount{0U}
+    , myPriority{priority}
+    , myMode{mode}
+    , myEnabled{false}
+    , myAdded{false}
+{}
+
+// -----------------------------------------------------------------------------
+bool Task::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+uint32_t Task::period_ms() const noexcept { return myPeriod_us / UsPerMs; }
+
+// -----------------------------------------------------------------------------
+uint8_t Task::priority() const noexcept { return myPriority; }
+
+// -----------------------------------------------------------------------------
+Task::Mode Task::mode() const noexcept { return myMode; }
+
+// -----------------------------------------------------------------------------
+uint32_t Task::runCount() const noexcept { return myRunCount; }
+
+// -----------------------------------------------------------------------------
+uint32_t Task::maxRunTime_us() const noexcept { return myMaxRunTime_us; }
+
+// -----------------------------------------------------------------------------
+uint32_t Task::averageRunTime_us() const noexcept
+{
+    return 0U < myRunCount ? static_cast<uint32_t>(myTotalRunTime_us / myRunCount) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Task::deadlineMissCount() const noexcept { return myDeadlineMissCount; }
+
+// -----------------------------------------------------------------------------
+void Task::resetStats() noexcept
+{
+    myRunCount          = 0U;
+    myMaxRunTime_us     = 0U;
+    myTotalRunTime_us   = 0U;
+    myDeadlineMissCount = 0U;
+}
+} // namespace scheduler
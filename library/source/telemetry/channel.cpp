@@ -0,0 +1,158 @@
+/**
+ * @brief Implementation details of the binary telemetry channel.
+ */
+#include "driver/serial/interface.h"
+#include "telemetry/channel.h"
+#include "telemetry/crc16.h"
+
+namespace telemetry
+{
+namespace
+{
+/** Size of the frame header (record type and sequence number) in bytes. */
+constexpr uint8_t HeaderSize{2U};
+
+/** Size of the checksum in bytes. */
+constexpr uint8_t CrcSize{2U};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t payloadSize(const RecordType type) noexcept
+{
+    switch (type)
+    {
+        case RecordType::Temperature:
+            return sizeof(int16_t);
+        case RecordType::Timestamp:
+            return sizeof(uint32_t);
+        case RecordType::Event:
+            return sizeof(EventCode);
+        default:
+            return 0U;
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Channel::Channel(driver::serial::Interface& serial) noexcept
+    : mySerial{serial}
+    , myRxErrorCount{0U}
+    , myTxSequence{0U}
+{}
+
+// -----------------------------------------------------------------------------
+bool Channel::sendTemperature(const int16_t temperature_c) noexcept
+{
+    return send(RecordType::Temperature, static_cast<uint16_t>(temperature_c), 
+                payloadSize(RecordType::Temperature));
+}
+
+// -----------------------------------------------------------------------------
+bool Channel::sendTimestamp(const uint32_t timestamp_ms) noexcept
+{
+    return send(RecordType::Timestamp, timestamp_ms, payloadSize(RecordType::Timestamp));
+}
+
+// -----------------------------------------------------------------------------
+bool Channel::sendEvent(const EventCode event) noexcept
+{
+    return send(RecordType::Event, static_cast<uint8_t>(event), payloadSize(RecordType::Event));
+}
+
+// -----------------------------------------------------------------------------
+bool Channel::receive(Record& record) noexcept
+{
+    uint8_t buffer[MaxEncodedFrameSize]{};
+    int16_t size{};
+
+    while (0 < (size = mySerial.readUntil(buffer, sizeof(buffer), cobs::Delimiter)))
+    {
+        // Ignore empty frames, which can be used for synchronization.
+        if ((1 == size) && (cobs::Delimiter == buffer[0U])) { continue; }
+
+        // Discard frames that are too long (missing delimiter) or invalid.
+        if ((cobs::Delimiter == buffer[size - 1]) && 
+            decodeFrame(buffer, static_cast<uint16_t>(size - 1), record))
+        {
+            return true;
+        }
+        ++myRxErrorCount;
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Channel::rxErrorCount() const noexcept { return myRxErrorCount; }
+
+// -----------------------------------------------------------------------------
+bool Channel::send(const RecordType type, const uint32_t payload, 
+                   const uint8_t payloadSize) noexcept
+{
+    uint8_t frame[MaxFrameSize]{};
+    uint8_t frameSize{0U};
+
+    // Increment the sequence number even if the transmission fails to reveal the lost frame.
+    frame[frameSize++] = static_cast<uint8_t>(type);
+    frame[frameSize++] = myTxSequence++;
+
+    for (uint8_t i{}; i < payloadSize; ++i)
+    {
+        frame[frameSize++] = static_cast<uint8_t>(payload >> (8U * i));
+    }
+
+    const uint16_t crc{crc16::compute(frame, frameSize)};
+    frame[frameSize++] = static_cast<uint8_t>(crc >> 8U);
+    frame[frameSize++] = static_cast<uint8_t>(crc);
+
+    // Encode the frame and append the delimiter, then send the entire frame in one go.
+    uint8_t encoded[MaxEncodedFrameSize]{};
+    const uint16_t encodedSize{cobs::encode(frame, frameSize, encoded, sizeof(encoded) - 1U)};
+    encoded[encodedSize] = cobs::Delimiter;
+
+    const uint16_t wireSize{static_cast<uint16_t>(encodedSize + 1U)};
+    return static_cast<int16_t>(wireSize) == mySerial.write(encoded, wireSize);
+}
+
+// -----------------------------------------------------------------------------
+bool Channel::decodeFrame(const uint8_t* encoded, const uint16_t size, 
+                          Record& record) const noexcept
+{
+    uint8_t frame[MaxFrameSize]{};
+    const uint16_t frameSize{cobs::decode(encoded, size, frame, sizeof(frame))};
+    if (HeaderSize + CrcSize >= frameSize) { return false; }
+
+    // Verify the checksum, then verify that the payload size matches the record type.
+    const uint16_t dataSize{static_cast<uint16_t>(frameSize - CrcSize)};
+    const uint16_t crc{static_cast<uint16_t>((frame[dataSize] << 8U) | frame[dataSize + 1U])};
+    if (crc16::compute(frame, dataSize) != crc) { return false; }
+
+    const auto type{static_cast<RecordType>(frame[0U])};
+    const uint8_t expectedPayloadSize{payloadSize(type)};
+    if ((0U == expectedPayloadSize) || (HeaderSize + expectedPayloadSize != dataSize)) 
+    { 
+        return false; 
+    }
+
+    uint32_t payload{0U};
+
+    for (uint8_t i{}; i < expectedPayloadSize; ++i)
+    {
+        payload |= static_cast<uint32_t>(frame[HeaderSize + i]) << (8U * i);
+    }
+
+    record = Record{type, frame[1U], 0, 0U, static_cast<EventCode>(0U)};
+
+    switch (type)
+    {
+        case RecordType::Temperature:
+            record.temperature_c = static_cast<int16_t>(payload);
+            break;
+        case RecordType::Timestamp:
+            record.timestamp_ms = payload;
+            break;
+        default:
+            record.event = static_cast<EventCode>(payload);
+            break;
+    }
+    return true;
+}
+} // namespace telemetry
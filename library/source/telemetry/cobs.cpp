@@ -0,0 +1,87 @@
+/**
+ * @brief Implementation details of Consistent Overhead Byte Stuffing (COBS).
+ */
+#include "telemetry/cobs.h"
+
+namespace telemetry
+{
+namespace cobs
+{
+namespace
+{
+/** Max code value, indicating 254 non-zero bytes not followed by a zero byte. */
+constexpr uint8_t MaxCode{0xFFU};
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint16_t encode(const uint8_t* input, const uint16_t size, 
+                uint8_t* output, const uint16_t outputSize) noexcept
+{
+    if (((nullptr == input) && (0U < size)) || (nullptr == output) || (0U == outputSize)) 
+    { 
+        return 0U; 
+    }
+
+    // Each code byte holds the distance to the next zero byte, which is replaced by the next code.
+    uint16_t codeIndex{0U};
+    uint16_t outputIndex{1U};
+    uint8_t code{1U};
+
+    for (uint16_t i{}; i < size; ++i)
+    {
+        if (Delimiter != input[i])
+        {
+            if (outputSize <= outputIndex) { return 0U; }
+            output[outputIndex++] = input[i];
+            ++code;
+        }
+
+        // Start a new block at zero bytes and after 254 non-zero bytes.
+        if ((Delimiter == input[i]) || (MaxCode == code))
+        {
+            if (outputSize <= outputIndex) { return 0U; }
+            output[codeIndex] = code;
+            codeIndex         = outputIndex++;
+            code              = 1U;
+        }
+    }
+
+    output[codeIndex] = code;
+    return outputIndex;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t decode(const uint8_t* input, const uint16_t size, 
+                uint8_t* output, const uint16_t outputSize) noexcept
+{
+    if ((nullptr == input) || (nullptr == output)) { return 0U; }
+    uint16_t inputIndex{0U};
+    uint16_t outputIndex{0U};
+
+    while (inputIndex < size)
+    {
+        const uint8_t code{input[inputIndex++]};
+        if (Delimiter == code) { return 0U; }
+
+        // Copy the non-zero bytes of the block.
+        for (uint8_t i{1U}; i < code; ++i)
+        {
+            if ((size <= inputIndex) || (Delimiter == input[inputIndex]) || 
+                (outputSize <= outputIndex)) 
+            { 
+                return 0U; 
+            }
+            output[outputIndex++] = input[inputIndex++];
+        }
+
+        // Restore the zero byte ending the block, unless the block is the last one.
+        if ((MaxCode != code) && (inputIndex < size))
+        {
+            if (outputSize <= outputIndex) { return 0U; }
+            output[outputIndex++] = Delimiter;
+        }
+    }
+    return outputIndex;
+}
+} // namespace cobs
+} // namespace telemetry
@@ -0,0 +1,38 @@
+/**
+ * @brief Implementation details of the CRC-16 checksum.
+ */
+#include "telemetry/crc16.h"
+
+namespace telemetry
+{
+namespace crc16
+{
+namespace
+{
+/** Generator polynomial (x^16 + x^12 + x^5 + 1). */
+constexpr uint16_t Polynomial{0x1021U};
+
+/** Mask for the most significant bit of the CRC. */
+constexpr uint16_t MsbMask{0x8000U};
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint16_t compute(const uint8_t* data, const uint16_t size, uint16_t crc) noexcept
+{
+    if (nullptr == data) { return crc; }
+
+    // Compute the checksum bit by bit, which requires no lookup table in flash.
+    for (uint16_t i{}; i < size; ++i)
+    {
+        crc ^= static_cast<uint16_t>(data[i] << 8U);
+
+        for (uint8_t bit{}; bit < 8U; ++bit)
+        {
+            crc = (crc & MsbMask) ? static_cast<uint16_t>((crc << 1U) ^ Polynomial) 
+                                  : static_cast<uint16_t>(crc << 1U);
+        }
+    }
+    return crc;
+}
+} // namespace crc16
+} // namespace telemetry
@@ -39,6 +39,17 @@ void globalInterruptEnable() noexcept { asm("SEI"); }
 // -----------------------------------------------------------------------------
 void globalInterruptDisable() noexcept { asm("CLI"); }
 
+// -----------------------------------------------------------------------------
+void idleSleep() noexcept
+{
+    // Select idle sleep mode and enable sleep, the instruction following SEI is always
+    // executed before any pending interrupt is serviced.
+    SMCR = (1U << SE);
+    asm("SEI");
+    asm("SLEEP");
+    SMCR = 0U;
+}
+
 } // namespace utils
 
 /**
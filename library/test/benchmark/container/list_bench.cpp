@@ -0,0 +1,114 @@
+/**
+ * @brief Benchmarks comparing list nodes allocated on the heap with nodes allocated from a pool.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <malloc.h>
+
+#include <benchmark/benchmark.h>
+
+#include "container/list.h"
+#include "memory/pool.h"
+
+namespace container
+{
+namespace
+{
+/** The max number of values held by the lists, i.e. the number of pool blocks. */
+constexpr std::size_t MaxSize{1024U};
+
+/** Pool with static storage sized for the largest list benchmarked. */
+using NodePool = memory::StaticPool<List<std::uint32_t>::nodeSize(), MaxSize>;
+
+// -----------------------------------------------------------------------------
+std::size_t heapUsage() { return mallinfo2().uordblks; }
+
+// -----------------------------------------------------------------------------
+template <typename ListType>
+void fill(ListType& list, const std::size_t size)
+{
+    for (std::size_t i{}; i < size; ++i) { list.pushBack(static_cast<std::uint32_t>(i)); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename ListType>
+void fillClear(benchmark::State& state, ListType& list)
+{
+    const auto size{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        // Insert values at the back, then remove all values.
+        fill(list, size);
+        benchmark::DoNotOptimize(list.rbegin());
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+template <typename ListType>
+void insertRemove(benchmark::State& state, ListType& list)
+{
+    const auto size{static_cast<std::size_t>(state.range(0))};
+    fill(list, size);
+    std::uint32_t value{};
+
+    for (auto _ : state)
+    {
+        // Use the list as a queue of constant size, each value passes through once.
+        list.popFront();
+        list.pushBack(value++);
+        benchmark::DoNotOptimize(list.rbegin());
+    }
+    list.clear();
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+void FillClear_Heap(benchmark::State& state)
+{
+    List<std::uint32_t> list{};
+    fillClear(state, list);
+
+    // Record the heap usage of a full list, including the block headers of malloc.
+    const auto startUsage{heapUsage()};
+    fill(list, static_cast<std::size_t>(state.range(0)));
+    state.counters["peak_bytes"] = static_cast<double>(heapUsage() - startUsage);
+}
+
+// -----------------------------------------------------------------------------
+void FillClear_Pool(benchmark::State& state)
+{
+    NodePool pool{};
+    List<std::uint32_t, memory::Pool> list{pool};
+    fillClear(state, list);
+
+    // The pool storage is reserved up front, the peak usage is the used part of it.
+    state.counters["peak_bytes"] = static_cast<double>(pool.peakUsedCount() * pool.blockSize());
+    state.counters["reserved_bytes"] = static_cast<double>(NodePool::storageSize());
+}
+
+// -----------------------------------------------------------------------------
+void InsertRemove_Heap(benchmark::State& state)
+{
+    List<std::uint32_t> list{};
+    insertRemove(state, list);
+}
+
+// -----------------------------------------------------------------------------
+void InsertRemove_Pool(benchmark::State& state)
+{
+    NodePool pool{};
+    List<std::uint32_t, memory::Pool> list{pool};
+    insertRemove(state, list);
+}
+
+BENCHMARK(FillClear_Heap)->RangeMultiplier(8)->Range(16, MaxSize);
+BENCHMARK(FillClear_Pool)->RangeMultiplier(8)->Range(16, MaxSize);
+BENCHMARK(InsertRemove_Heap)->RangeMultiplier(8)->Range(16, MaxSize);
+BENCHMARK(InsertRemove_Pool)->RangeMultiplier(8)->Range(16, MaxSize);
+
+} // namespace
+} // namespace container
@@ -0,0 +1,188 @@
+/**
+ * @brief Benchmarks of copies and allocations eliminated by move semantics and emplacement.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+
+#include "container/list.h"
+#include "container/vector.h"
+#include "utils/utils.h"
+
+namespace container
+{
+namespace
+{
+/** The size of the heap block owned by each heavy element in bytes. */
+constexpr std::size_t BufferSize{64U};
+
+/** The number of elements added per iteration. */
+constexpr std::size_t ElementCount{64U};
+
+/**
+ * @brief Heavy element type owning a heap block, counting its allocations and copies.
+ */
+class Buffer
+{
+public:
+    /** The number of heap allocations made by buffers. */
+    static std::size_t allocationCount;
+
+    /** The number of buffer copies made. */
+    static std::size_t copyCount;
+
+    // -----------------------------------------------------------------------------
+    Buffer() noexcept = default;
+
+    // -----------------------------------------------------------------------------
+    explicit Buffer(const std::uint8_t value) noexcept
+        : myData{allocate()}
+    {
+        if (myData) { std::memset(myData, value, BufferSize); }
+    }
+
+    // -----------------------------------------------------------------------------
+    Buffer(const Buffer& other) noexcept
+        : myData{other.myData ? allocate() : nullptr}
+    {
+        if (myData) { std::memcpy(myData, other.myData, BufferSize); }
+        ++copyCount;
+    }
+
+    // -----------------------------------------------------------------------------
+    Buffer(Buffer&& other) noexcept
+        : myData{other.myData} { other.myData = nullptr; }
+
+    // -----------------------------------------------------------------------------
+    Buffer& operator=(Buffer&& other) noexcept
+    {
+        std::free(myData);
+        myData       = other.myData;
+        other.myData = nullptr;
+        return *this;
+    }
+
+    Buffer& operator=(const Buffer&) = delete;
+
+    // -----------------------------------------------------------------------------
+    ~Buffer() noexcept { std::free(myData); }
+
+    // -----------------------------------------------------------------------------
+    const std::uint8_t* data() const noexcept { return myData; }
+
+private:
+    // -----------------------------------------------------------------------------
+    static std::uint8_t* allocate() noexcept
+    {
+        ++allocationCount;
+        return static_cast<std::uint8_t*>(std::malloc(BufferSize));
+    }
+
+    std::uint8_t* myData{nullptr};
+};
+
+std::size_t Buffer::allocationCount{};
+std::size_t Buffer::copyCount{};
+
+// -----------------------------------------------------------------------------
+Buffer legacyMove(Buffer& source) noexcept
+{
+    // The former utils::move(), copying the source and then emptying it.
+    Buffer copy{source};
+    source = Buffer{};
+    return copy;
+}
+
+// -----------------------------------------------------------------------------
+void setCounters(benchmark::State& state) noexcept
+{
+    const auto elementCount{static_cast<double>(state.iterations() * ElementCount)};
+    state.counters["allocs/elem"] = Buffer::allocationCount / elementCount;
+    state.counters["copies/elem"] = Buffer::copyCount / elementCount;
+    Buffer::allocationCount = 0U;
+    Buffer::copyCount       = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Container, typename Insert>
+void addElements(benchmark::State& state, Insert&& insert)
+{
+    Buffer::allocationCount = 0U;
+    Buffer::copyCount       = 0U;
+
+    for (auto _ : state)
+    {
+        Container container{};
+        for (std::size_t i{}; i < ElementCount; ++i)
+        {
+            insert(container, static_cast<std::uint8_t>(i));
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+    setCounters(state);
+}
+
+// -----------------------------------------------------------------------------
+void Vector_PushCopy(benchmark::State& state)
+{
+    addElements<Vector<Buffer>>(state, [](Vector<Buffer>& vector, const std::uint8_t value) {
+        const Buffer buffer{value};
+        vector.pushBack(buffer);
+    });
+}
+
+// -----------------------------------------------------------------------------
+void Vector_PushLegacyMove(benchmark::State& state)
+{
+    addElements<Vector<Buffer>>(state, [](Vector<Buffer>& vector, const std::uint8_t value) {
+        Buffer buffer{value};
+        vector.pushBack(legacyMove(buffer));
+    });
+}
+
+// -----------------------------------------------------------------------------
+void Vector_PushMove(benchmark::State& state)
+{
+    addElements<Vector<Buffer>>(state, [](Vector<Buffer>& vector, const std::uint8_t value) {
+        Buffer buffer{value};
+        vector.pushBack(utils::move(buffer));
+    });
+}
+
+// -----------------------------------------------------------------------------
+void Vector_Emplace(benchmark::State& state)
+{
+    addElements<Vector<Buffer>>(state, [](Vector<Buffer>& vector, const std::uint8_t value) {
+        vector.emplaceBack(value);
+    });
+}
+
+// -----------------------------------------------------------------------------
+void List_PushCopy(benchmark::State& state)
+{
+    addElements<List<Buffer>>(state, [](List<Buffer>& list, const std::uint8_t value) {
+        const Buffer buffer{value};
+        list.pushBack(buffer);
+    });
+}
+
+// -----------------------------------------------------------------------------
+void List_Emplace(benchmark::State& state)
+{
+    addElements<List<Buffer>>(state, [](List<Buffer>& list, const std::uint8_t value) {
+        list.emplaceBack(value);
+    });
+}
+
+BENCHMARK(Vector_PushCopy);
+BENCHMARK(Vector_PushLegacyMove);
+BENCHMARK(Vector_PushMove);
+BENCHMARK(Vector_Emplace);
+BENCHMARK(List_PushCopy);
+BENCHMARK(List_Emplace);
+
+} // namespace
+} // namespace container
@@ -0,0 +1,157 @@
+/**
+ * @brief Benchmarks of the ring buffer throughput, single values and bulk transfers.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "container/ring_buffer.h"
+
+namespace container
+{
+namespace
+{
+/** The number of values transferred between threads per iteration. */
+constexpr std::uint32_t TransferCount{100000U};
+
+/** The buffer size used, i.e. the max capacity of the ring buffer. */
+constexpr std::size_t BufferSize{128U};
+
+/**
+ * @brief Queue protected by a mutex, used as locking baseline.
+ */
+class LockedQueue
+{
+public:
+    // -----------------------------------------------------------------------------
+    bool push(const std::uint32_t value)
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        if (myQueue.size() >= BufferSize) { return false; }
+        myQueue.push_back(value);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+    bool pop(std::uint32_t& value)
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        if (myQueue.empty()) { return false; }
+        value = myQueue.front();
+        myQueue.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex myMutex{};
+    std::deque<std::uint32_t> myQueue{};
+};
+
+// -----------------------------------------------------------------------------
+template <typename Queue>
+void transferSingle(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        // Transfer values one by one from a producer thread to this thread.
+        Queue queue{};
+        std::thread producer{[&queue]()
+        {
+            for (std::uint32_t i{}; i < TransferCount;)
+            {
+                if (queue.push(i)) { ++i; }
+                else { std::this_thread::yield(); }
+            }
+        }};
+
+        std::uint32_t value{}, sum{};
+        for (std::uint32_t i{}; i < TransferCount;)
+        {
+            if (queue.pop(value))
+            {
+                sum += value;
+                ++i;
+            }
+            else { std::this_thread::yield(); }
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * TransferCount);
+}
+
+// -----------------------------------------------------------------------------
+void Transfer_LockedQueue(benchmark::State& state) { transferSingle<LockedQueue>(state); }
+
+// -----------------------------------------------------------------------------
+void Transfer_RingBuffer(benchmark::State& state)
+{
+    transferSingle<RingBuffer<std::uint32_t, BufferSize>>(state);
+}
+
+// -----------------------------------------------------------------------------
+void Transfer_RingBufferBulk(benchmark::State& state)
+{
+    const auto chunkSize{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        // Transfer values in chunks from a producer thread to this thread.
+        RingBuffer<std::uint32_t, BufferSize> buffer{};
+        std::thread producer{[&buffer, chunkSize]()
+        {
+            std::uint32_t chunk[BufferSize]{};
+            for (std::uint32_t next{}; next < TransferCount;)
+            {
+                std::size_t count{};
+                for (; (count < chunkSize) && (next + count < TransferCount); ++count)
+                {
+                    chunk[count] = next + static_cast<std::uint32_t>(count);
+                }
+                const auto pushCount{buffer.push(chunk, count)};
+                if (pushCount == 0U) { std::this_thread::yield(); }
+                next += static_cast<std::uint32_t>(pushCount);
+            }
+        }};
+
+        std::uint32_t chunk[BufferSize]{}, sum{};
+        for (std::uint32_t received{}; received < TransferCount;)
+        {
+            const auto count{buffer.pop(chunk, chunkSize)};
+            if (count == 0U) { std::this_thread::yield(); }
+            for (std::size_t i{}; i < count; ++i) { sum += chunk[i]; }
+            received += static_cast<std::uint32_t>(count);
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * TransferCount);
+}
+
+// -----------------------------------------------------------------------------
+void PushPop_RingBuffer(benchmark::State& state)
+{
+    RingBuffer<std::uint32_t, BufferSize> buffer{};
+    std::uint32_t value{};
+
+    for (auto _ : state)
+    {
+        // Push and pop from the same thread, the cost paid by an interrupt handler.
+        buffer.push(value);
+        buffer.pop(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Transfer_LockedQueue)->UseRealTime();
+BENCHMARK(Transfer_RingBuffer)->UseRealTime();
+BENCHMARK(Transfer_RingBufferBulk)->Arg(8)->Arg(32)->UseRealTime();
+BENCHMARK(PushPop_RingBuffer);
+
+} // namespace
+} // namespace container
@@ -0,0 +1,105 @@
+/**
+ * @brief Benchmarks comparing vectors with static capacity with dynamic vectors.
+ */
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "container/static_vector.h"
+#include "container/vector.h"
+
+namespace container
+{
+namespace
+{
+/** The capacity of the static vectors, i.e. the largest training set benchmarked. */
+constexpr std::size_t Capacity{256U};
+
+/** The number of epochs to train per iteration. */
+constexpr std::size_t EpochCount{10U};
+
+/** The learning rate used for training. */
+constexpr double LearningRate{0.01};
+
+// -----------------------------------------------------------------------------
+template <typename VectorType>
+void buildTrainingSet(VectorType& trainIn, VectorType& trainOut, const std::size_t setCount)
+{
+    // Build the training sets of the relation T = 100 * Uin - 50 one by one.
+    for (std::size_t i{}; i < setCount; ++i)
+    {
+        const double input{i * 0.01};
+        trainIn.pushBack(input);
+        trainOut.pushBack(100.0 * input - 50.0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename VectorType>
+void build(benchmark::State& state)
+{
+    const auto setCount{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        VectorType trainIn{}, trainOut{};
+        buildTrainingSet(trainIn, trainOut, setCount);
+        benchmark::DoNotOptimize(trainIn.data());
+        benchmark::DoNotOptimize(trainOut.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+template <typename VectorType>
+void train(benchmark::State& state)
+{
+    const auto setCount{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        // Build the training set and train a linear regression model, like at startup.
+        VectorType trainIn{}, trainOut{};
+        buildTrainingSet(trainIn, trainOut, setCount);
+        double weight{}, bias{};
+
+        for (std::size_t epoch{}; epoch < EpochCount; ++epoch)
+        {
+            for (std::size_t i{}; i < trainIn.size(); ++i)
+            {
+                const double error{trainOut[i] - (weight * trainIn[i] + bias)};
+                bias   += error * LearningRate;
+                weight += error * LearningRate * trainIn[i];
+            }
+        }
+        benchmark::DoNotOptimize(weight);
+        benchmark::DoNotOptimize(bias);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+void Build_Vector(benchmark::State& state) { build<Vector<double>>(state); }
+
+// -----------------------------------------------------------------------------
+void Build_StaticVector(benchmark::State& state)
+{
+    build<StaticVector<double, Capacity>>(state);
+}
+
+// -----------------------------------------------------------------------------
+void Train_Vector(benchmark::State& state) { train<Vector<double>>(state); }
+
+// -----------------------------------------------------------------------------
+void Train_StaticVector(benchmark::State& state)
+{
+    train<StaticVector<double, Capacity>>(state);
+}
+
+BENCHMARK(Build_Vector)->RangeMultiplier(4)->Range(16, Capacity);
+BENCHMARK(Build_StaticVector)->RangeMultiplier(4)->Range(16, Capacity);
+BENCHMARK(Train_Vector)->RangeMultiplier(4)->Range(16, Capacity);
+BENCHMARK(Train_StaticVector)->RangeMultiplier(4)->Range(16, Capacity);
+
+} // namespace
+} // namespace container
@@ -0,0 +1,173 @@
+/**
+ * @brief Benchmarks of vector push/pop throughput and the number of reallocations.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+#include "container/vector.h"
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Vector reallocating on every push and pop, as container::Vector formerly did.
+ */
+template <typename T>
+class ReallocVector
+{
+public:
+    ReallocVector() noexcept = default;
+    ~ReallocVector() noexcept { std::free(myData); }
+
+    ReallocVector(const ReallocVector&)            = delete;
+    ReallocVector& operator=(const ReallocVector&) = delete;
+
+    // -----------------------------------------------------------------------------
+    bool pushBack(const T& value) noexcept
+    {
+        if (!resize(mySize + 1U)) { return false; }
+        myData[mySize - 1U] = value;
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+    bool popBack() noexcept
+    {
+        if (mySize <= 1U)
+        {
+            std::free(myData);
+            myData = nullptr;
+            mySize = 0U;
+            return true;
+        }
+        return resize(mySize - 1U);
+    }
+
+    // -----------------------------------------------------------------------------
+    std::size_t size() const noexcept { return mySize; }
+
+    // -----------------------------------------------------------------------------
+    std::size_t reallocationCount() const noexcept { return myReallocationCount; }
+
+private:
+    // -----------------------------------------------------------------------------
+    bool resize(const std::size_t newSize) noexcept
+    {
+        auto copy{static_cast<T*>(std::realloc(myData, sizeof(T) * newSize))};
+        if (copy == nullptr) { return false; }
+        myData = copy;
+        mySize = newSize;
+        ++myReallocationCount;
+        return true;
+    }
+
+    T* myData{nullptr};
+    std::size_t mySize{};
+    std::size_t myReallocationCount{};
+};
+
+// -----------------------------------------------------------------------------
+void PushBack_Realloc(benchmark::State& state)
+{
+    const auto valueCount{static_cast<std::size_t>(state.range(0))};
+    std::size_t reallocationCount{};
+
+    for (auto _ : state)
+    {
+        // Build a vector from scratch, like a training set is built.
+        ReallocVector<double> vector{};
+        for (std::size_t i{}; i < valueCount; ++i) { vector.pushBack(i * 0.1); }
+        benchmark::DoNotOptimize(vector.size());
+        reallocationCount += vector.reallocationCount();
+    }
+    state.counters["allocs"] = static_cast<double>(reallocationCount) / state.iterations();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+void PushBack_Vector(benchmark::State& state)
+{
+    const auto valueCount{static_cast<std::size_t>(state.range(0))};
+    std::size_t reallocationCount{};
+
+    for (auto _ : state)
+    {
+        // Build a vector from scratch, counting the capacity changes.
+        Vector<double> vector{};
+        for (std::size_t i{}; i < valueCount; ++i)
+        {
+            const auto capacity{vector.capacity()};
+            vector.pushBack(i * 0.1);
+            if (vector.capacity() != capacity) { ++reallocationCount; }
+        }
+        benchmark::DoNotOptimize(vector.data());
+    }
+    state.counters["allocs"] = static_cast<double>(reallocationCount) / state.iterations();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+void PushBack_VectorReserved(benchmark::State& state)
+{
+    const auto valueCount{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        // Reserve the memory up front, a single allocation.
+        Vector<double> vector{};
+        vector.reserve(valueCount);
+        for (std::size_t i{}; i < valueCount; ++i) { vector.pushBack(i * 0.1); }
+        benchmark::DoNotOptimize(vector.data());
+    }
+    state.counters["allocs"] = 1.0;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -----------------------------------------------------------------------------
+void PushPop_Realloc(benchmark::State& state)
+{
+    ReallocVector<std::uint8_t> vector{};
+    for (std::int64_t i{}; i < state.range(0); ++i) { vector.pushBack(0U); }
+    const auto initialCount{vector.reallocationCount()};
+
+    for (auto _ : state)
+    {
+        // Push and pop one value at the end of a filled vector, like a stack or buffer.
+        vector.pushBack(1U);
+        vector.popBack();
+        benchmark::ClobberMemory();
+    }
+    state.counters["allocs"] =
+        static_cast<double>(vector.reallocationCount() - initialCount) / state.iterations();
+}
+
+// -----------------------------------------------------------------------------
+void PushPop_Vector(benchmark::State& state)
+{
+    Vector<std::uint8_t> vector{};
+    for (std::int64_t i{}; i < state.range(0); ++i) { vector.pushBack(0U); }
+    std::size_t reallocationCount{};
+
+    for (auto _ : state)
+    {
+        const auto capacity{vector.capacity()};
+        vector.pushBack(1U);
+        vector.popBack();
+        if (vector.capacity() != capacity) { ++reallocationCount; }
+        benchmark::ClobberMemory();
+    }
+    state.counters["allocs"] = static_cast<double>(reallocationCount) / state.iterations();
+}
+
+BENCHMARK(PushBack_Realloc)->RangeMultiplier(8)->Range(16, 4096);
+BENCHMARK(PushBack_Vector)->RangeMultiplier(8)->Range(16, 4096);
+BENCHMARK(PushBack_VectorReserved)->RangeMultiplier(8)->Range(16, 4096);
+BENCHMARK(PushPop_Realloc)->Arg(16)->Arg(256);
+BENCHMARK(PushPop_Vector)->Arg(16)->Arg(256);
+
+} // namespace
+} // namespace container
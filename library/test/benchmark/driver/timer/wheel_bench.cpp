@@ -0,0 +1,118 @@
+/**
+ * @brief Benchmarks of the timer tick cost as the number of software timers grows.
+ */
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief Timer counting ticks like timer::Atmega328p, used as baseline.
+ */
+struct CountingTimer
+{
+    /** The number of ticks counted so far. */
+    std::uint32_t counter;
+
+    /** The number of ticks to count before timeout. */
+    std::uint32_t maxCount;
+
+    /** Callback to invoke on timeout. */
+    void (*callback)();
+};
+
+/** The number of invoked callbacks. */
+volatile std::uint32_t callbackCount{0U};
+
+// -----------------------------------------------------------------------------
+void countCallback() noexcept { callbackCount = callbackCount + 1U; }
+
+// -----------------------------------------------------------------------------
+std::uint32_t timeout_ms(const std::size_t index) noexcept
+{
+    // Spread the timeouts between 10 ms and 10 s.
+    return static_cast<std::uint32_t>(10U + (index * 7919U) % 10000U);
+}
+
+// -----------------------------------------------------------------------------
+void Tick_Counters(benchmark::State& state)
+{
+    std::vector<CountingTimer> timers{};
+
+    for (std::size_t i{}; i < static_cast<std::size_t>(state.range(0)); ++i)
+    {
+        timers.push_back(CountingTimer{0U, timeout_ms(i), countCallback});
+    }
+
+    for (auto _ : state)
+    {
+        // Increment the counter of every timer on every tick, as done per hardware timer.
+        for (auto& timer : timers)
+        {
+            if (++timer.counter >= timer.maxCount)
+            {
+                timer.counter = 0U;
+                timer.callback();
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.counters["timers"] = static_cast<double>(timers.size());
+}
+
+// -----------------------------------------------------------------------------
+void Tick_Wheel(benchmark::State& state)
+{
+    timer::Wheel wheel{};
+    std::vector<std::unique_ptr<timer::Software>> timers{};
+
+    for (std::size_t i{}; i < static_cast<std::size_t>(state.range(0)); ++i)
+    {
+        timers.push_back(std::make_unique<timer::Software>(wheel, timeout_ms(i), countCallback, 
+                                                           true));
+    }
+
+    for (auto _ : state)
+    {
+        // Only process the timers of the current slots.
+        wheel.tick();
+        benchmark::ClobberMemory();
+    }
+    state.counters["timers"] = static_cast<double>(wheel.activeTimerCount());
+}
+
+// -----------------------------------------------------------------------------
+void StartStop_Wheel(benchmark::State& state)
+{
+    timer::Wheel wheel{};
+    std::vector<std::unique_ptr<timer::Software>> timers{};
+
+    for (std::size_t i{}; i < static_cast<std::size_t>(state.range(0)); ++i)
+    {
+        timers.push_back(std::make_unique<timer::Software>(wheel, timeout_ms(i), countCallback, 
+                                                           true));
+    }
+    timer::Software timer{wheel, 100U};
+
+    for (auto _ : state)
+    {
+        timer.start();
+        timer.stop();
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(Tick_Counters)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(Tick_Wheel)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(StartStop_Wheel)->RangeMultiplier(4)->Range(4, 1024);
+
+} // namespace
+} // namespace driver
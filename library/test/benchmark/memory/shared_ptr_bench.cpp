@@ -0,0 +1,105 @@
+/**
+ * @brief Benchmarks comparing shared pointers with separate and single allocations, and the
+ *        copy cost of the reference count policies.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <malloc.h>
+
+#include <benchmark/benchmark.h>
+
+#include "memory/heap_allocator.h"
+#include "memory/shared_ptr.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+namespace
+{
+/** The number of pointers held at once when measuring the heap usage. */
+constexpr std::size_t PointerCount{64U};
+
+/**
+ * @brief Object held by the pointers, sized like a small driver state.
+ */
+struct Object
+{
+    /** The value of the object. */
+    std::uint32_t value;
+
+    /** Padding, so the object isn't smaller than the control block. */
+    std::uint32_t data[3U];
+};
+
+// -----------------------------------------------------------------------------
+std::size_t heapUsage() { return mallinfo2().uordblks; }
+
+// -----------------------------------------------------------------------------
+SharedPtr<Object> createSeparate(const std::uint32_t value) noexcept
+{
+    return SharedPtr<Object>{utils::newObject<Object>(Object{value, {}})};
+}
+
+// -----------------------------------------------------------------------------
+SharedPtr<Object> createSingle(const std::uint32_t value) noexcept
+{
+    return makeShared<Object>(Object{value, {}});
+}
+
+// -----------------------------------------------------------------------------
+template <typename Factory>
+void create(benchmark::State& state, const Factory& factory, const double allocations)
+{
+    std::uint32_t value{};
+
+    for (auto _ : state)
+    {
+        auto ptr{factory(value++)};
+        benchmark::DoNotOptimize(ptr.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    // Record the heap usage per object, including the block headers of malloc.
+    SharedPtr<Object> pointers[PointerCount]{};
+    const auto startUsage{heapUsage()};
+    for (auto& ptr : pointers) { ptr = factory(value++); }
+    state.counters["heap_bytes_per_object"] =
+        static_cast<double>(heapUsage() - startUsage) / PointerCount;
+    state.counters["allocations_per_object"] = allocations;
+}
+
+// -----------------------------------------------------------------------------
+template <typename RefCount>
+void copy(benchmark::State& state)
+{
+    const auto ptr{makeShared<Object, RefCount>(Object{1U, {}})};
+
+    for (auto _ : state)
+    {
+        // Copy and release the pointer, i.e. increment and decrement the owner count.
+        const auto other{ptr};
+        benchmark::DoNotOptimize(other.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+void Create_Separate(benchmark::State& state) { create(state, createSeparate, 2.0); }
+
+// -----------------------------------------------------------------------------
+void Create_MakeShared(benchmark::State& state) { create(state, createSingle, 1.0); }
+
+// -----------------------------------------------------------------------------
+void Copy_Plain(benchmark::State& state) { copy<refcount::Plain>(state); }
+
+// -----------------------------------------------------------------------------
+void Copy_Guarded(benchmark::State& state) { copy<refcount::Guarded>(state); }
+
+BENCHMARK(Create_Separate);
+BENCHMARK(Create_MakeShared);
+BENCHMARK(Copy_Plain);
+BENCHMARK(Copy_Guarded);
+
+} // namespace
+} // namespace memory
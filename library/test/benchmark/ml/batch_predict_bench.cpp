@@ -0,0 +1,136 @@
+/**
+ * @brief Benchmarks of the batch predictions of the multivariate and polynomial models, which
+ *        the compiler vectorizes on the host, compared to predicting one sample at a time.
+ */
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/lin_reg/multivariate.h"
+#include "ml/lin_reg/polynomial.h"
+
+namespace ml
+{
+namespace
+{
+/** The number of samples predicted per iteration. */
+constexpr std::size_t SampleCount{10000U};
+
+/**
+ * @brief Structure holding input and output buffers of the benchmarks.
+ */
+struct Samples
+{
+    double inputs[3U][SampleCount];
+    double outputs[SampleCount];
+};
+
+// -----------------------------------------------------------------------------
+Samples& samples() noexcept
+{
+    static Samples myInstance{};
+    static bool myInitialized{false};
+
+    if (!myInitialized)
+    {
+        for (std::size_t i{}; i < SampleCount; ++i)
+        {
+            myInstance.inputs[0U][i] = (i % 150U) * 0.01;
+            myInstance.inputs[1U][i] = 4.5 + (i % 7U) * 0.15;
+            myInstance.inputs[2U][i] = 15.0 + (i % 40U) * 0.5;
+        }
+        myInitialized = true;
+    }
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+void setParameters(lin_reg::Multivariate<3U>& model) noexcept
+{
+    model.setParameters(lin_reg::Multivariate<3U>::Inputs{100.0, -2.0, 0.5}, -40.0);
+}
+
+// -----------------------------------------------------------------------------
+void setParameters(lin_reg::Polynomial<3U>& model) noexcept
+{
+    model.setCoefficients(lin_reg::Polynomial<3U>::Coefficients{-45.0, 120.0, -30.0, 1.5});
+}
+
+// -----------------------------------------------------------------------------
+void BatchPredict_Multivariate3(benchmark::State& state)
+{
+    lin_reg::Multivariate<3U> model{};
+    setParameters(model);
+    auto& data{samples()};
+    const double* const inputs[]{data.inputs[0U], data.inputs[1U], data.inputs[2U]};
+
+    for (auto _ : state)
+    {
+        model.predict(inputs, data.outputs, SampleCount);
+        benchmark::DoNotOptimize(data.outputs);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+// -----------------------------------------------------------------------------
+void BatchPredict_Polynomial3(benchmark::State& state)
+{
+    lin_reg::Polynomial<3U> model{};
+    setParameters(model);
+    auto& data{samples()};
+
+    for (auto _ : state)
+    {
+        model.predict(data.inputs[0U], data.outputs, SampleCount);
+        benchmark::DoNotOptimize(data.outputs);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+// -----------------------------------------------------------------------------
+void PredictEach_Multivariate3(benchmark::State& state)
+{
+    lin_reg::Multivariate<3U> model{};
+    setParameters(model);
+    auto& data{samples()};
+    lin_reg::Multivariate<3U>::Inputs inputs{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{}; i < SampleCount; ++i)
+        {
+            inputs[0U] = data.inputs[0U][i];
+            inputs[1U] = data.inputs[1U][i];
+            inputs[2U] = data.inputs[2U][i];
+            benchmark::DoNotOptimize(model.predict(inputs));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+// -----------------------------------------------------------------------------
+void PredictEach_Polynomial3(benchmark::State& state)
+{
+    lin_reg::Polynomial<3U> model{};
+    setParameters(model);
+    auto& data{samples()};
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{}; i < SampleCount; ++i)
+        {
+            benchmark::DoNotOptimize(model.predict(data.inputs[0U][i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+BENCHMARK(BatchPredict_Multivariate3);
+BENCHMARK(BatchPredict_Polynomial3);
+BENCHMARK(PredictEach_Multivariate3);
+BENCHMARK(PredictEach_Polynomial3);
+
+} // namespace
+} // namespace ml
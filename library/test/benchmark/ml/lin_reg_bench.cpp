@@ -0,0 +1,222 @@
+/**
+ * @brief Benchmarks comparing the floating-point and fixed-point linear regression models, and
+ *        the startup cost of training them epoch by epoch versus fitting them in closed form.
+ *        The per-sample cost of the online model is measured after learning from a varying
+ *        number of samples, which shouldn't affect it. The trainer benchmarks measure the epochs
+ *        and the wall time needed to reach a target loss with different training strategies.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/fixed_point.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/lin_reg/recursive.h"
+#include "ml/trainer.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace
+{
+/** The learning rate used by the application. */
+constexpr double LearningRate{0.01};
+
+/** The mean squared error to reach when training with the trainer. */
+constexpr double TargetLoss{1e-4};
+
+/** The maximum number of epochs when training with the trainer. */
+constexpr std::size_t MaxEpochCount{100000U};
+
+/** The number of inputs predicted per iteration. */
+constexpr std::size_t InputCount{64U};
+
+// -----------------------------------------------------------------------------
+const Matrix1d& trainIn() noexcept
+{
+    // The temperature dataset of the application, T = 100 * Uin - 50.
+    static const Matrix1d myInstance{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6,
+                                     0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+const Matrix2d& trainOut() noexcept
+{
+    static const Matrix2d myInstance{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0,
+                                     30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0};
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+double meanSquaredError(const Model& model) noexcept
+{
+    double sum{};
+    for (std::size_t i{}; i < trainIn().size(); ++i)
+    {
+        const double error{trainOut()[i] - model.predict(trainIn()[i])};
+        sum += error * error;
+    }
+    return sum / trainIn().size();
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+void train(benchmark::State& state)
+{
+    const auto epochCount{static_cast<std::size_t>(state.range(0))};
+    Model model{};
+
+    for (auto _ : state)
+    {
+        model.train(trainIn(), trainOut(), epochCount, LearningRate);
+        benchmark::ClobberMemory();
+    }
+    // Record the convergence, i.e. the error after the given number of epochs.
+    state.counters["mse"] = meanSquaredError(model);
+}
+
+// -----------------------------------------------------------------------------
+void Train_Double(benchmark::State& state) { train<lin_reg::Fixed>(state); }
+
+// -----------------------------------------------------------------------------
+void Train_Q16_16(benchmark::State& state) { train<lin_reg::Quantized<>>(state); }
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+void fit(benchmark::State& state)
+{
+    Model model{};
+
+    for (auto _ : state)
+    {
+        model.fit(trainIn(), trainOut());
+        benchmark::ClobberMemory();
+    }
+    state.counters["mse"] = meanSquaredError(model);
+}
+
+// -----------------------------------------------------------------------------
+void Fit_Double(benchmark::State& state) { fit<lin_reg::Fixed>(state); }
+
+// -----------------------------------------------------------------------------
+void Fit_Q16_16(benchmark::State& state) { fit<lin_reg::Quantized<>>(state); }
+
+// -----------------------------------------------------------------------------
+void Predict_Double(benchmark::State& state)
+{
+    lin_reg::Fixed model{};
+    model.train(trainIn(), trainOut(), 100U, LearningRate);
+    double inputs[InputCount]{};
+    for (std::size_t i{}; i < InputCount; ++i) { inputs[i] = i * 0.02; }
+
+    for (auto _ : state)
+    {
+        for (const auto input : inputs) { benchmark::DoNotOptimize(model.predict(input)); }
+    }
+    state.SetItemsProcessed(state.iterations() * InputCount);
+}
+
+// -----------------------------------------------------------------------------
+void Predict_Q16_16(benchmark::State& state)
+{
+    lin_reg::Quantized<> model{};
+    model.train(trainIn(), trainOut(), 100U, LearningRate);
+    Q16_16 inputs[InputCount]{};
+    for (std::size_t i{}; i < InputCount; ++i) { inputs[i] = Q16_16::fromDouble(i * 0.02); }
+
+    for (auto _ : state)
+    {
+        for (const auto input : inputs) { benchmark::DoNotOptimize(model.predict(input)); }
+    }
+    state.SetItemsProcessed(state.iterations() * InputCount);
+}
+
+// -----------------------------------------------------------------------------
+void Update_Recursive(benchmark::State& state)
+{
+    const auto sampleCount{static_cast<std::size_t>(state.range(0))};
+    const auto setCount{trainIn().size()};
+    lin_reg::Recursive model{};
+
+    for (std::size_t i{}; i < sampleCount; ++i)
+    {
+        model.update(trainIn()[i % setCount], trainOut()[i % setCount]);
+    }
+    std::size_t i{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(model.update(trainIn()[i], trainOut()[i]));
+        if (++i == setCount) { i = 0U; }
+    }
+    state.counters["mse"] = meanSquaredError(model);
+}
+
+// -----------------------------------------------------------------------------
+void trainToLoss(benchmark::State& state, const std::size_t batchSize, const double learningRate,
+                 const bool shuffle, const Schedule schedule = Schedule::Constant,
+                 const double decay = 1.0)
+{
+    TrainConfig config{};
+    config.epochCount   = MaxEpochCount;
+    config.batchSize    = batchSize;
+    config.learningRate = learningRate;
+    config.schedule     = schedule;
+    config.decay        = decay;
+    config.targetLoss   = TargetLoss;
+    config.shuffle      = shuffle;
+    Trainer trainer{config};
+    lin_reg::Fixed model{};
+    TrainResult result{};
+
+    for (auto _ : state)
+    {
+        trainer.train(model, trainIn(), trainOut(), &result);
+        benchmark::ClobberMemory();
+    }
+    // Record the epochs needed to reach the target loss.
+    state.counters["epochs"] = static_cast<double>(result.epochCount);
+    state.counters["mse"]    = result.loss;
+}
+
+// -----------------------------------------------------------------------------
+void TrainToLoss_InOrder(benchmark::State& state)
+{
+    // Train like lin_reg::Fixed::train(), i.e. one update per sample in order.
+    trainToLoss(state, 1U, LearningRate, false);
+}
+
+// -----------------------------------------------------------------------------
+void TrainToLoss_Shuffled(benchmark::State& state) { trainToLoss(state, 1U, 0.5, true); }
+
+// -----------------------------------------------------------------------------
+void TrainToLoss_ShuffledDecay(benchmark::State& state)
+{
+    trainToLoss(state, 1U, 0.5, true, Schedule::Exponential, 0.98);
+}
+
+// -----------------------------------------------------------------------------
+void TrainToLoss_MiniBatch(benchmark::State& state) { trainToLoss(state, 3U, 0.8, true); }
+
+// -----------------------------------------------------------------------------
+void TrainToLoss_FullBatch(benchmark::State& state) { trainToLoss(state, 15U, 1.0, false); }
+
+BENCHMARK(Train_Double)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(Train_Q16_16)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(Fit_Double);
+BENCHMARK(Fit_Q16_16);
+BENCHMARK(Predict_Double);
+BENCHMARK(Predict_Q16_16);
+BENCHMARK(Update_Recursive)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(TrainToLoss_InOrder);
+BENCHMARK(TrainToLoss_Shuffled);
+BENCHMARK(TrainToLoss_ShuffledDecay);
+BENCHMARK(TrainToLoss_MiniBatch);
+BENCHMARK(TrainToLoss_FullBatch);
+
+} // namespace
+} // namespace ml
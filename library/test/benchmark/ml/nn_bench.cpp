@@ -0,0 +1,117 @@
+/**
+ * @brief Benchmarks of the inference of the quantized neural network exported by the host-side
+ *        trainer, with and without floating-point scaling, compared to a cubic polynomial
+ *        fitted to the same nonlinear thermistor response. The maximum calibration error of
+ *        each model is recorded as well.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/lin_reg/polynomial.h"
+#include "ml/types.h"
+#include "../../ml/nn/thermistor_model.h"
+
+namespace ml
+{
+namespace
+{
+/** The number of inputs predicted per iteration. */
+constexpr std::size_t InputCount{128U};
+
+/** The number of training samples of the polynomial. */
+constexpr std::size_t TrainCount{61U};
+
+// -----------------------------------------------------------------------------
+double thermistorVoltage(const double temp) noexcept
+{
+    const double resistance{10e3 * std::exp(3950.0 * (1.0 / (temp + 273.15) - 1.0 / 298.15))};
+    return 5.0 * resistance / (resistance + 10e3);
+}
+
+// -----------------------------------------------------------------------------
+double inputTemp(const std::size_t index) noexcept
+{
+    // Sweep the calibrated range from -20 to 100 degrees Celsius.
+    return -20.0 + 120.0 * index / (InputCount - 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+double maxError(const Model& model) noexcept
+{
+    double result{};
+    for (std::size_t i{}; i < InputCount; ++i)
+    {
+        const double error{std::abs(model.predict(thermistorVoltage(inputTemp(i))) - inputTemp(i))};
+        if (error > result) { result = error; }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+void predict(benchmark::State& state, const Model& model)
+{
+    double inputs[InputCount]{};
+    for (std::size_t i{}; i < InputCount; ++i) { inputs[i] = thermistorVoltage(inputTemp(i)); }
+
+    for (auto _ : state)
+    {
+        for (const auto input : inputs) { benchmark::DoNotOptimize(model.predict(input)); }
+    }
+    state.SetItemsProcessed(state.iterations() * InputCount);
+    state.counters["max_error"] = maxError(model);
+}
+
+// -----------------------------------------------------------------------------
+void Predict_Network(benchmark::State& state) { predict(state, thermistor::Model{}); }
+
+// -----------------------------------------------------------------------------
+void Predict_Polynomial3(benchmark::State& state)
+{
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (std::size_t i{}; i < TrainCount; ++i)
+    {
+        const double temp{-20.0 + 120.0 * i / (TrainCount - 1U)};
+        trainIn.pushBack(thermistorVoltage(temp));
+        trainOut.pushBack(temp);
+    }
+    lin_reg::Polynomial<3U> model{};
+    model.fit(trainIn, trainOut);
+    predict(state, model);
+}
+
+// -----------------------------------------------------------------------------
+void PredictQuantized_Network(benchmark::State& state)
+{
+    // Quantize the inputs once, so that only integer math is measured.
+    std::int16_t inputs[InputCount]{};
+    for (std::size_t i{}; i < InputCount; ++i)
+    {
+        inputs[i] = thermistor::Model::quantizeInput(0U, thermistorVoltage(inputTemp(i)));
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto input : inputs)
+        {
+            std::int16_t output[1U]{};
+            thermistor::Model::predictQuantized({input}, output);
+            benchmark::DoNotOptimize(output[0U]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * InputCount);
+    state.counters["scratch_bytes"]   = thermistor::Model::ScratchBytes;
+    state.counters["parameter_bytes"] = thermistor::Model::ParameterBytes;
+}
+
+BENCHMARK(Predict_Network);
+BENCHMARK(PredictQuantized_Network);
+BENCHMARK(Predict_Polynomial3);
+
+} // namespace
+} // namespace ml
@@ -0,0 +1,105 @@
+/**
+ * @brief Benchmarks comparing type-safe string formatting with snprintf.
+ */
+#include <cstdint>
+#include <cstdio>
+
+#include <benchmark/benchmark.h>
+
+#include "utils/format.h"
+
+namespace utils
+{
+namespace
+{
+/** Buffer size used by the former snprintf-based serial::Interface::printf. */
+constexpr std::size_t SnprintfBufferSize{101U};
+
+/**
+ * @brief Sink simulating a transport, only counting the formatted characters.
+ */
+struct CountingSink
+{
+    /** The number of formatted characters. */
+    std::size_t count{};
+
+    // -----------------------------------------------------------------------------
+    void operator()(const char* data, const std::uint16_t length) noexcept
+    {
+        benchmark::DoNotOptimize(data);
+        count += length;
+    }
+};
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+void snprintfMessage(benchmark::State& state, const char* fmt, const Args&... args)
+{
+    std::size_t count{};
+
+    for (auto _ : state)
+    {
+        // Format into an intermediate buffer, then pass the buffer to the transport.
+        char buffer[SnprintfBufferSize]{'\0'};
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wformat-security"
+        const int length{std::snprintf(buffer, sizeof(buffer), fmt, args...)};
+        #pragma GCC diagnostic pop
+        benchmark::DoNotOptimize(buffer);
+        count += static_cast<std::size_t>(length);
+    }
+    state.counters["chars/msg"] = static_cast<double>(count) / state.iterations();
+}
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+void formatMessage(benchmark::State& state, const char* fmt, const Args&... args)
+{
+    CountingSink sink{};
+
+    for (auto _ : state)
+    {
+        // Stream the formatted characters straight to the transport.
+        format(sink, fmt, args...);
+        benchmark::ClobberMemory();
+    }
+    state.counters["chars/msg"] = static_cast<double>(sink.count) / state.iterations();
+}
+
+/** Temperature printout, as printed by the system logic. */
+constexpr const char* TemperatureFormat{"Temperature: %d Celsius\n"};
+
+/** Telemetry line containing integers, hexadecimal numbers, fixed-point numbers and strings. */
+constexpr const char* TelemetryFormat{"[%lu] id=0x%04X temp=%.2f state=%s err=%d\n"};
+
+// -----------------------------------------------------------------------------
+void Snprintf_Temperature(benchmark::State& state)
+{
+    snprintfMessage(state, TemperatureFormat, static_cast<std::int16_t>(23));
+}
+
+// -----------------------------------------------------------------------------
+void Format_Temperature(benchmark::State& state)
+{
+    formatMessage(state, TemperatureFormat, static_cast<std::int16_t>(23));
+}
+
+// -----------------------------------------------------------------------------
+void Snprintf_Telemetry(benchmark::State& state)
+{
+    snprintfMessage(state, TelemetryFormat, 123456UL, 0xBEEFU, 23.45, "running", -3);
+}
+
+// -----------------------------------------------------------------------------
+void Format_Telemetry(benchmark::State& state)
+{
+    formatMessage(state, TelemetryFormat, 123456UL, 0xBEEFU, 23.45, "running", -3);
+}
+
+BENCHMARK(Snprintf_Temperature);
+BENCHMARK(Format_Temperature);
+BENCHMARK(Snprintf_Telemetry);
+BENCHMARK(Format_Telemetry);
+
+} // namespace
+} // namespace utils
@@ -0,0 +1,40 @@
+/**
+ * @brief Code size probe comparing type-safe string formatting with snprintf.
+ *
+ *        Build once with and once without SIZE_PROBE_SNPRINTF defined, then compare the size
+ *        of the text sections, see the size target in the makefile.
+ */
+#include <stdint.h>
+#include <stdio.h>
+
+#include "utils/format.h"
+
+namespace
+{
+/** Simulated transport data register. */
+volatile char dataReg{};
+
+// -----------------------------------------------------------------------------
+void transmit(const char* data, const uint16_t length) noexcept
+{
+    for (uint16_t i{}; i < length; ++i) { dataReg = data[i]; }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+int main(const int argc, char**)
+{
+    const int16_t temperature{static_cast<int16_t>(argc)};
+    const uint16_t id{static_cast<uint16_t>(argc * 3)};
+    const double voltage{argc * 0.5};
+
+#ifdef SIZE_PROBE_SNPRINTF
+    char buffer[101U]{'\0'};
+    const int length{snprintf(buffer, sizeof(buffer), "Temp: %d id=0x%04X %.2f V %s\n",
+                              temperature, id, voltage, "OK")};
+    transmit(buffer, static_cast<uint16_t>(length));
+#else
+    utils::format(transmit, "Temp: %d id=0x%04X %.2f V %s\n", temperature, id, voltage, "OK");
+#endif
+    return 0;
+}
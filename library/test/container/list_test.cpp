@@ -0,0 +1,239 @@
+/**
+ * @brief Unit tests for doubly linked lists.
+ */
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "container/list.h"
+#include "memory/pool.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Element type counting its live instances and copies.
+ */
+struct Counted
+{
+    /** The number of live instances. */
+    static int liveCount;
+
+    /** The number of copies made. */
+    static int copyCount;
+
+    /** The value of the instance. */
+    int value;
+
+    // -----------------------------------------------------------------------------
+    Counted(const int val = 0) noexcept
+        : value{val} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted(const Counted& other) noexcept
+        : value{other.value} { ++liveCount; ++copyCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted(Counted&& other) noexcept
+        : value{other.value} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    ~Counted() noexcept { --liveCount; }
+};
+
+int Counted::liveCount{};
+int Counted::copyCount{};
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+std::vector<T> toVector(const List<T, Allocator>& list)
+{
+    std::vector<T> values{};
+    for (const auto& value : list) { values.push_back(value); }
+    return values;
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, PushPop)
+{
+    List<int> list{};
+    EXPECT_TRUE(list.empty());
+
+    EXPECT_TRUE(list.pushBack(2));
+    EXPECT_TRUE(list.pushBack(3));
+    EXPECT_TRUE(list.pushFront(1));
+    EXPECT_TRUE(list.emplaceFront(0));
+    EXPECT_TRUE(list.emplaceBack(4));
+    EXPECT_EQ(list.size(), 5U);
+    EXPECT_EQ(toVector(list), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    list.popFront();
+    list.popBack();
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3}));
+
+    // Resizing adds or removes values at the back.
+    EXPECT_TRUE(list.resize(5U, 9));
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3, 9, 9}));
+    EXPECT_TRUE(list.resize(2U));
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2}));
+
+    list.popBack();
+    list.popBack();
+    list.popBack();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, InsertRemove)
+{
+    List<int> list{};
+    auto end{list.end()};
+    EXPECT_FALSE(list.insert(end, 1));
+    EXPECT_FALSE(list.remove(end));
+
+    for (int i{1}; i <= 3; ++i) { EXPECT_TRUE(list.pushBack(i * 10)); }
+
+    // Values are inserted before the value the iterator is pointing at.
+    auto first{list.begin()};
+    EXPECT_TRUE(list.insert(first, 5));
+    auto third{++(++list.begin())};
+    EXPECT_TRUE(list.insert(third, 15));
+    EXPECT_EQ(toVector(list), (std::vector<int>{5, 10, 15, 20, 30}));
+
+    // The iterator points at the next value once a value is removed.
+    auto i{list.begin()};
+    EXPECT_TRUE(list.remove(i));
+    EXPECT_EQ(*i, 10);
+    ++i;
+    EXPECT_TRUE(list.remove(i));
+    EXPECT_EQ(*i, 20);
+    ++i;
+    EXPECT_TRUE(list.remove(i));
+    EXPECT_EQ(i, list.end());
+    EXPECT_EQ(toVector(list), (std::vector<int>{10, 20}));
+    EXPECT_EQ(list.size(), 2U);
+    EXPECT_EQ(*list.rbegin(), 20);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, CopyMove)
+{
+    List<int> list{};
+    for (int i{}; i < 3; ++i) { EXPECT_TRUE(list.pushBack(i)); }
+
+    List<int> copy{list};
+    EXPECT_EQ(toVector(copy), toVector(list));
+
+    // Appending a list to itself doubles its content.
+    copy += copy;
+    EXPECT_EQ(toVector(copy), (std::vector<int>{0, 1, 2, 0, 1, 2}));
+
+    List<int> moved{static_cast<List<int>&&>(list)};
+    EXPECT_EQ(toVector(moved), (std::vector<int>{0, 1, 2}));
+    EXPECT_TRUE(list.empty());
+
+    copy = static_cast<List<int>&&>(moved);
+    EXPECT_EQ(copy.size(), 3U);
+    EXPECT_TRUE(moved.empty());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, ObjectLifetime)
+{
+    Counted::liveCount = 0;
+    Counted::copyCount = 0;
+    {
+        List<Counted> list{};
+
+        // Values are only copied when pushing lvalues.
+        const Counted value{1};
+        EXPECT_TRUE(list.pushBack(value));
+        EXPECT_TRUE(list.pushBack(Counted{2}));
+        EXPECT_TRUE(list.emplaceBack(3));
+        EXPECT_TRUE(list.emplaceFront(0));
+        EXPECT_EQ(Counted::copyCount, 1);
+        EXPECT_EQ(Counted::liveCount, 5);
+
+        // Removed values are destroyed.
+        list.popFront();
+        auto i{list.begin()};
+        EXPECT_TRUE(list.remove(i));
+        EXPECT_EQ(Counted::liveCount, 3);
+        EXPECT_EQ((*i).value, 2);
+    }
+    // All values are destroyed with the list.
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, ConvertingEmplace)
+{
+    List<double> list{};
+    const int value{3};
+    EXPECT_TRUE(list.emplaceBack(value));
+    EXPECT_TRUE(list.emplaceFront(value - 1));
+    EXPECT_EQ(toVector(list), (std::vector<double>{2.0, 3.0}));
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, PoolAllocator)
+{
+    memory::StaticPool<List<Counted>::nodeSize(), 4U> pool{};
+    Counted::liveCount = 0;
+    {
+        // Nodes are allocated from the pool, the list is full when the pool is exhausted.
+        List<Counted, memory::Pool> list{pool};
+        for (int i{}; i < 4; ++i) { EXPECT_TRUE(list.emplaceBack(i)); }
+        EXPECT_TRUE(pool.full());
+        EXPECT_FALSE(list.pushBack(Counted{4}));
+        EXPECT_EQ(list.size(), 4U);
+        EXPECT_EQ(Counted::liveCount, 4);
+
+        // Removed nodes are returned to the pool and reused.
+        auto i{list.begin()};
+        EXPECT_TRUE(list.remove(i));
+        list.popBack();
+        EXPECT_EQ(pool.usedCount(), 2U);
+        EXPECT_TRUE(list.pushFront(Counted{5}));
+        EXPECT_EQ(pool.usedCount(), 3U);
+
+        // Moved lists keep allocating from the same pool.
+        List<Counted, memory::Pool> moved{static_cast<List<Counted, memory::Pool>&&>(list)};
+        EXPECT_EQ(&moved.allocator(), &pool);
+        EXPECT_TRUE(moved.emplaceBack(6));
+        EXPECT_EQ(pool.usedCount(), 4U);
+        EXPECT_EQ(Counted::liveCount, 4);
+    }
+    // All nodes are returned to the pool with the list.
+    EXPECT_EQ(pool.usedCount(), 0U);
+    EXPECT_EQ(pool.peakUsedCount(), 4U);
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_List, StaticPoolAllocator)
+{
+    // Lists created without an allocator share one static pool per pool type.
+    using Pool = memory::StaticPool<List<int>::nodeSize(), 3U>;
+    List<int, Pool> first{}, second{};
+    EXPECT_EQ(&first.allocator(), &second.allocator());
+
+    EXPECT_TRUE(first.pushBack(1));
+    EXPECT_TRUE(second.pushBack(2));
+    EXPECT_TRUE(second.pushBack(3));
+    EXPECT_FALSE(first.pushBack(4));
+    EXPECT_EQ(first.allocator().usedCount(), 3U);
+
+    second.clear();
+    EXPECT_TRUE(first.pushBack(4));
+    EXPECT_EQ(toVector(first), (std::vector<int>{1, 4}));
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
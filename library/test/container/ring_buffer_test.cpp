@@ -0,0 +1,170 @@
+/**
+ * @brief Unit tests for lock-free ring buffers.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "container/ring_buffer.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/** The number of values transferred in the stress tests. */
+constexpr std::uint32_t TransferCount{200000U};
+
+// -----------------------------------------------------------------------------
+template <typename T, std::size_t Size>
+std::vector<T> toVector(const RingBuffer<T, Size>& buffer)
+{
+    std::vector<T> values{};
+    for (const auto& value : buffer) { values.push_back(value); }
+    return values;
+}
+
+// -----------------------------------------------------------------------------
+template <std::size_t Size>
+void stressTest(const std::size_t chunkSize)
+{
+    RingBuffer<std::uint32_t, Size> buffer{};
+
+    // Push sequential values from another thread, in chunks if the chunk size exceeds 1.
+    std::thread producer{[&buffer, chunkSize]()
+    {
+        std::vector<std::uint32_t> chunk(chunkSize);
+        std::uint32_t next{};
+
+        while (next < TransferCount)
+        {
+            std::size_t count{};
+            for (; (count < chunkSize) && (next + count < TransferCount); ++count)
+            {
+                chunk[count] = next + static_cast<std::uint32_t>(count);
+            }
+            const std::size_t pushCount{chunkSize == 1U ? buffer.push(chunk[0U])
+                                                        : buffer.push(chunk.data(), count)};
+            next += static_cast<std::uint32_t>(pushCount);
+
+            // Let the consumer run if the buffer is full, in case both share one core.
+            if (pushCount == 0U) { std::this_thread::yield(); }
+        }
+    }};
+
+    // Pop the values and verify that all values arrive exactly once, in order.
+    std::vector<std::uint32_t> chunk(chunkSize);
+    std::uint32_t expected{};
+    std::size_t errorCount{};
+    const auto startTime{std::chrono::steady_clock::now()};
+
+    while (expected < TransferCount)
+    {
+        const std::size_t count{chunkSize == 1U ? static_cast<std::size_t>(buffer.pop(chunk[0U]))
+                                                : buffer.pop(chunk.data(), chunkSize)};
+        for (std::size_t i{}; i < count; ++i)
+        {
+            if (chunk[i] != expected++) { ++errorCount; }
+        }
+        if (count == 0U) { std::this_thread::yield(); }
+    }
+    producer.join();
+    const std::chrono::duration<double> duration{std::chrono::steady_clock::now() - startTime};
+
+    EXPECT_EQ(errorCount, 0U);
+    EXPECT_EQ(expected, TransferCount);
+    EXPECT_TRUE(buffer.empty());
+    ::testing::Test::RecordProperty("items_per_second",
+                                    static_cast<int>(TransferCount / duration.count()));
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_RingBuffer, PushPop)
+{
+    RingBuffer<int, 4U> buffer{};
+    int value{};
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.pop(value));
+
+    for (int i{}; i < 4; ++i) { EXPECT_TRUE(buffer.push(i)); }
+    EXPECT_TRUE(buffer.full());
+    EXPECT_FALSE(buffer.push(4));
+
+    // Wrap around the end of the buffer several times.
+    for (int i{4}; i < 20; ++i)
+    {
+        EXPECT_TRUE(buffer.pop(value));
+        EXPECT_EQ(value, i - 4);
+        EXPECT_TRUE(buffer.push(i));
+    }
+    EXPECT_EQ(buffer.size(), 4U);
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_RingBuffer, Bulk)
+{
+    RingBuffer<int, 8U> buffer{};
+    const int values[]{1, 2, 3, 4, 5, 6};
+
+    // Only the values there's space for are pushed.
+    EXPECT_EQ(buffer.push(values), 6U);
+    EXPECT_EQ(buffer.push(values), 2U);
+    EXPECT_EQ(buffer.size(), 8U);
+
+    int popped[5U]{};
+    EXPECT_EQ(buffer.pop(popped), 5U);
+    EXPECT_EQ(popped[0U], 1);
+    EXPECT_EQ(popped[4U], 5);
+
+    // Push and pop across the end of the buffer.
+    EXPECT_EQ(buffer.push(values, 4U), 4U);
+    EXPECT_EQ(buffer.size(), 7U);
+    int all[10U]{};
+    EXPECT_EQ(buffer.pop(all), 7U);
+    const int expected[]{6, 1, 2, 1, 2, 3, 4};
+    for (std::size_t i{}; i < 7U; ++i) { EXPECT_EQ(all[i], expected[i]); }
+
+    EXPECT_EQ(buffer.pop(all), 0U);
+    EXPECT_EQ(buffer.push(values, 0U), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_RingBuffer, Iterators)
+{
+    RingBuffer<int, 4U> buffer{};
+    EXPECT_EQ(buffer.begin(), buffer.end());
+
+    // Iterate across the end of the buffer, from the front to the back.
+    for (int i{}; i < 3; ++i) { EXPECT_TRUE(buffer.push(i)); }
+    int value{};
+    EXPECT_TRUE(buffer.pop(value));
+    EXPECT_TRUE(buffer.pop(value));
+    for (int i{3}; i < 6; ++i) { EXPECT_TRUE(buffer.push(i)); }
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{2, 3, 4, 5}));
+
+    // Values can be modified in place by the consumer.
+    for (auto& i : buffer) { i *= 10; }
+    auto i{buffer.begin()};
+    i += 2U;
+    EXPECT_EQ(*i, 40);
+    EXPECT_EQ(*(--i), 30);
+    EXPECT_TRUE(buffer.pop(value));
+    EXPECT_EQ(value, 20);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_RingBuffer, StressSingle) { stressTest<16U>(1U); }
+
+// -----------------------------------------------------------------------------
+TEST(Container_RingBuffer, StressBulk) { stressTest<128U>(32U); }
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,212 @@
+/**
+ * @brief Unit tests for vectors with static capacity.
+ */
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "container/static_vector.h"
+#include "container/vector.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/** The capacity of the static vectors under test. */
+constexpr std::size_t Capacity{16U};
+
+/**
+ * @brief Element type counting its live instances.
+ */
+struct Counted
+{
+    /** The number of live instances. */
+    static int liveCount;
+
+    /** The value of the instance. */
+    int value;
+
+    // -----------------------------------------------------------------------------
+    Counted(const int val = 0) noexcept
+        : value{val} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted(const Counted& other) noexcept
+        : value{other.value} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted& operator=(const Counted& other) noexcept = default;
+
+    // -----------------------------------------------------------------------------
+    ~Counted() noexcept { --liveCount; }
+};
+
+int Counted::liveCount{};
+
+// -----------------------------------------------------------------------------
+template <typename VectorType>
+std::vector<int> toVector(const VectorType& vector)
+{
+    std::vector<int> values{};
+    for (const auto& value : vector) { values.push_back(value); }
+    return values;
+}
+
+/**
+ * @brief Test fixture running the same tests for dynamic and static vectors.
+ */
+template <typename VectorType>
+class Container_Vectors : public ::testing::Test {};
+
+using VectorTypes = ::testing::Types<Vector<int>, StaticVector<int, Capacity>>;
+TYPED_TEST_SUITE(Container_Vectors, VectorTypes);
+
+// -----------------------------------------------------------------------------
+TYPED_TEST(Container_Vectors, PushPop)
+{
+    TypeParam vector{};
+    EXPECT_TRUE(vector.empty());
+
+    for (int i{}; i < 5; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+    EXPECT_TRUE(vector.emplaceBack(5));
+    EXPECT_EQ(vector.size(), 6U);
+    EXPECT_EQ(*vector.last(), 5);
+    EXPECT_EQ(toVector(vector), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    EXPECT_TRUE(vector.popBack());
+    EXPECT_TRUE(vector.resize(3U));
+    EXPECT_EQ(toVector(vector), (std::vector<int>{0, 1, 2}));
+
+    vector.clear();
+    EXPECT_TRUE(vector.empty());
+    EXPECT_FALSE(vector.popBack());
+    EXPECT_EQ(vector.last(), nullptr);
+}
+
+// -----------------------------------------------------------------------------
+TYPED_TEST(Container_Vectors, InsertErase)
+{
+    TypeParam vector{};
+    EXPECT_FALSE(vector.insert(1U, 1));
+
+    // Insert values at the back, the front and in between.
+    EXPECT_TRUE(vector.insert(0U, 3));
+    EXPECT_TRUE(vector.insert(0U, 1));
+    EXPECT_TRUE(vector.insert(1U, 2));
+    EXPECT_TRUE(vector.insert(3U, 4));
+    EXPECT_EQ(toVector(vector), (std::vector<int>{1, 2, 3, 4}));
+
+    // Inserting an element of the vector itself is safe.
+    EXPECT_TRUE(vector.insert(0U, vector[3U]));
+    EXPECT_EQ(toVector(vector), (std::vector<int>{4, 1, 2, 3, 4}));
+
+    EXPECT_FALSE(vector.erase(5U));
+    EXPECT_TRUE(vector.erase(0U));
+    EXPECT_TRUE(vector.erase(1U));
+    EXPECT_TRUE(vector.erase(2U));
+    EXPECT_EQ(toVector(vector), (std::vector<int>{1, 3}));
+}
+
+// -----------------------------------------------------------------------------
+TYPED_TEST(Container_Vectors, CopyMove)
+{
+    TypeParam vector{1, 2, 3};
+
+    TypeParam copy{vector};
+    EXPECT_EQ(toVector(copy), toVector(vector));
+
+    copy += vector;
+    copy += {4, 5};
+    EXPECT_EQ(toVector(copy), (std::vector<int>{1, 2, 3, 1, 2, 3, 4, 5}));
+
+    TypeParam moved{static_cast<TypeParam&&>(vector)};
+    EXPECT_EQ(toVector(moved), (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(vector.empty());
+
+    copy = moved;
+    EXPECT_EQ(toVector(copy), (std::vector<int>{1, 2, 3}));
+    copy = static_cast<TypeParam&&>(moved);
+    EXPECT_EQ(copy.size(), 3U);
+    EXPECT_TRUE(moved.empty());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_StaticVector, Capacity)
+{
+    // The capacity is known at compile time and the elements are stored inline.
+    static_assert(StaticVector<int, Capacity>::capacity() == Capacity, "Invalid capacity!");
+    static_assert(sizeof(StaticVector<int, Capacity>) >= Capacity * sizeof(int),
+                  "Elements must be stored inline!");
+
+    StaticVector<int, Capacity> vector{};
+    EXPECT_TRUE(vector.reserve(Capacity));
+    EXPECT_FALSE(vector.reserve(Capacity + 1U));
+
+    for (std::size_t i{}; i < Capacity; ++i) 
+    { 
+        EXPECT_TRUE(vector.pushBack(static_cast<int>(i))); 
+    }
+    EXPECT_TRUE(vector.full());
+
+    // Values can't be added to a full vector.
+    EXPECT_FALSE(vector.pushBack(0));
+    EXPECT_FALSE(vector.emplaceBack(0));
+    EXPECT_FALSE(vector.insert(0U, 0));
+    EXPECT_EQ(vector.size(), Capacity);
+    EXPECT_EQ(vector[0U], 0);
+
+    vector += {1, 2};
+    EXPECT_EQ(vector.size(), Capacity);
+
+    // Resizing beyond the capacity fails.
+    EXPECT_FALSE(vector.resize(Capacity + 1U));
+    EXPECT_TRUE(vector.resize(2U));
+    EXPECT_EQ(vector.size(), 2U);
+
+    const StaticVector<int, Capacity> tooLarge{Capacity + 1U};
+    EXPECT_TRUE(tooLarge.empty());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_StaticVector, ObjectLifetime)
+{
+    Counted::liveCount = 0;
+    {
+        // Elements are only constructed as they are added.
+        StaticVector<Counted, Capacity> vector{};
+        EXPECT_EQ(Counted::liveCount, 0);
+
+        for (int i{}; i < 5; ++i) { EXPECT_TRUE(vector.emplaceBack(i)); }
+        EXPECT_EQ(Counted::liveCount, 5);
+
+        EXPECT_TRUE(vector.insert(2U, Counted{10}));
+        EXPECT_EQ(Counted::liveCount, 6);
+        EXPECT_EQ(vector[2U].value, 10);
+
+        // Removed elements are destroyed.
+        EXPECT_TRUE(vector.erase(0U));
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_EQ(Counted::liveCount, 4);
+        EXPECT_EQ(vector[1U].value, 10);
+
+        const StaticVector<Counted, Capacity> copy{vector};
+        EXPECT_EQ(Counted::liveCount, 8);
+    }
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_StaticVector, ConvertingEmplace)
+{
+    StaticVector<double, Capacity> vector{};
+    const int value{3};
+    EXPECT_TRUE(vector.emplaceBack(value));
+    EXPECT_DOUBLE_EQ(*vector.last(), 3.0);
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
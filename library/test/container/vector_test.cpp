@@ -0,0 +1,262 @@
+/**
+ * @brief Unit tests for dynamic vectors.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/vector.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Element type counting its constructions and destructions.
+ */
+struct Counted
+{
+    /** The number of live instances. */
+    static int liveCount;
+
+    /** The number of copies made. */
+    static int copyCount;
+
+    /** The number of moves made. */
+    static int moveCount;
+
+    /** The value of the instance. */
+    int value;
+
+    // -----------------------------------------------------------------------------
+    Counted(const int val = 0) noexcept
+        : value{val} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted(const Counted& other) noexcept
+        : value{other.value} { ++liveCount; ++copyCount; }
+
+    // -----------------------------------------------------------------------------
+    Counted(Counted&& other) noexcept
+        : value{other.value} 
+    { 
+        other.value = -1;
+        ++liveCount; 
+        ++moveCount; 
+    }
+
+    // -----------------------------------------------------------------------------
+    ~Counted() noexcept { --liveCount; }
+
+    // -----------------------------------------------------------------------------
+    static void resetCounters() noexcept 
+    { 
+        liveCount = 0;
+        copyCount = 0;
+        moveCount = 0;
+    }
+};
+
+int Counted::liveCount{};
+int Counted::copyCount{};
+int Counted::moveCount{};
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, Initialization)
+{
+    const Vector<int> empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.size(), 0U);
+    EXPECT_EQ(empty.capacity(), 0U);
+    EXPECT_EQ(empty.data(), nullptr);
+
+    // Vectors created with a given size hold exactly that many elements.
+    const Vector<int> sized{std::size_t{10U}};
+    EXPECT_EQ(sized.size(), 10U);
+    EXPECT_EQ(sized.capacity(), 10U);
+
+    const Vector<int> values{1, 2, 3};
+    ASSERT_EQ(values.size(), 3U);
+    EXPECT_GE(values.capacity(), values.size());
+
+    for (int i{}; i < 3; ++i) { EXPECT_EQ(values[i], i + 1); }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, GeometricGrowth)
+{
+    constexpr std::size_t valueCount{1000U};
+    Vector<std::uint16_t> vector{};
+    std::size_t reallocationCount{};
+
+    for (std::size_t i{}; i < valueCount; ++i)
+    {
+        const auto capacity{vector.capacity()};
+        ASSERT_TRUE(vector.pushBack(static_cast<std::uint16_t>(i)));
+        EXPECT_GE(vector.capacity(), vector.size());
+        if (vector.capacity() != capacity) { ++reallocationCount; }
+    }
+
+    // The first growth allocates the minimum capacity, then the capacity grows by 50 %.
+    EXPECT_EQ(vector.size(), valueCount);
+    EXPECT_LE(reallocationCount, 16U);
+
+    for (std::size_t i{}; i < valueCount; ++i) { EXPECT_EQ(vector[i], i); }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, PopBack)
+{
+    Vector<int> vector{1, 2, 3, 4, 5};
+    const auto capacity{vector.capacity()};
+
+    // Popping values doesn't release memory.
+    for (std::size_t i{}; i < 5U; ++i)
+    {
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_EQ(vector.size(), 4U - i);
+        EXPECT_EQ(vector.capacity(), capacity);
+    }
+    EXPECT_TRUE(vector.empty());
+    EXPECT_FALSE(vector.popBack());
+
+    // Pushing values up to the capacity reuses the memory.
+    const auto data{vector.data()};
+    for (std::size_t i{}; i < capacity; ++i) 
+    { 
+        EXPECT_TRUE(vector.pushBack(static_cast<int>(i))); 
+    }
+    EXPECT_EQ(vector.data(), data);
+    EXPECT_EQ(vector.capacity(), capacity);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, ReserveShrinkToFit)
+{
+    Vector<int> vector{};
+
+    // Reserving memory keeps the size, pushing up to the capacity doesn't reallocate.
+    EXPECT_TRUE(vector.reserve(100U));
+    EXPECT_EQ(vector.capacity(), 100U);
+    EXPECT_TRUE(vector.empty());
+    const auto data{vector.data()};
+
+    for (int i{}; i < 100; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+    EXPECT_EQ(vector.data(), data);
+    EXPECT_EQ(vector.capacity(), 100U);
+
+    // Reserving less than the capacity has no effect.
+    EXPECT_TRUE(vector.reserve(10U));
+    EXPECT_EQ(vector.capacity(), 100U);
+
+    // Shrinking the vector keeps the capacity until shrinkToFit() is called.
+    EXPECT_TRUE(vector.resize(20U));
+    EXPECT_EQ(vector.size(), 20U);
+    EXPECT_EQ(vector.capacity(), 100U);
+    EXPECT_TRUE(vector.shrinkToFit());
+    EXPECT_EQ(vector.capacity(), 20U);
+
+    for (int i{}; i < 20; ++i) { EXPECT_EQ(vector[i], i); }
+
+    // Shrinking an empty vector releases all memory.
+    EXPECT_TRUE(vector.resize(0U));
+    EXPECT_TRUE(vector.shrinkToFit());
+    EXPECT_EQ(vector.capacity(), 0U);
+    EXPECT_EQ(vector.data(), nullptr);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, CopyMove)
+{
+    Vector<int> vector{1, 2, 3};
+    EXPECT_TRUE(vector.reserve(50U));
+
+    // Copies only allocate memory for the copied values.
+    Vector<int> copy{vector};
+    ASSERT_EQ(copy.size(), 3U);
+    EXPECT_EQ(copy.capacity(), 3U);
+    for (int i{}; i < 3; ++i) { EXPECT_EQ(copy[i], i + 1); }
+
+    // Moving transfers the memory, leaving the source empty.
+    Vector<int> moved{static_cast<Vector<int>&&>(vector)};
+    EXPECT_EQ(moved.size(), 3U);
+    EXPECT_EQ(moved.capacity(), 50U);
+    EXPECT_EQ(vector.size(), 0U);
+    EXPECT_EQ(vector.capacity(), 0U);
+
+    // Appending values grows the vector like pushing them one by one.
+    copy += moved;
+    copy += {4, 5};
+    ASSERT_EQ(copy.size(), 8U);
+    EXPECT_GE(copy.capacity(), copy.size());
+    EXPECT_EQ(copy[3], 1);
+    EXPECT_EQ(copy[7], 5);
+
+    copy.clear();
+    EXPECT_EQ(copy.size(), 0U);
+    EXPECT_EQ(copy.capacity(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, ObjectLifetime)
+{
+    Counted::resetCounters();
+    {
+        Vector<Counted> vector{};
+        EXPECT_TRUE(vector.reserve(4U));
+
+        // Lvalues are copied, rvalues are moved and emplaced values are constructed in place.
+        const Counted value{1};
+        EXPECT_TRUE(vector.pushBack(value));
+        EXPECT_TRUE(vector.pushBack(Counted{2}));
+        EXPECT_TRUE(vector.emplaceBack(3));
+        EXPECT_EQ(Counted::copyCount, 1);
+        EXPECT_EQ(Counted::moveCount, 1);
+        EXPECT_EQ(Counted::liveCount, 4);
+
+        // Elements are moved rather than copied when the vector grows.
+        for (int i{4}; i <= 10; ++i) { EXPECT_TRUE(vector.emplaceBack(i)); }
+        EXPECT_EQ(Counted::copyCount, 1);
+        EXPECT_EQ(Counted::liveCount, 11);
+
+        for (int i{}; i < 10; ++i) { EXPECT_EQ(vector[i].value, i + 1); }
+
+        // Pushing an element of the vector itself is safe, even if the vector grows.
+        EXPECT_TRUE(vector.shrinkToFit());
+        EXPECT_TRUE(vector.pushBack(vector[0U]));
+        EXPECT_EQ(vector[10U].value, 1);
+        EXPECT_EQ(Counted::liveCount, 12);
+
+        // Removed elements are destroyed.
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_TRUE(vector.resize(5U));
+        EXPECT_EQ(Counted::liveCount, 6);
+        EXPECT_TRUE(vector.resize(8U));
+        EXPECT_EQ(Counted::liveCount, 9);
+        EXPECT_EQ(vector[7U].value, 0);
+    }
+    // All elements are destroyed with the vector.
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Container_Vector, ConvertingEmplace)
+{
+    // Emplaced arguments are converted like in a direct initialization, both in place and while
+    // the vector grows.
+    Vector<double> vector{};
+    const int value{3};
+    EXPECT_TRUE(vector.emplaceBack(value));
+    EXPECT_TRUE(vector.reserve(2U));
+    EXPECT_TRUE(vector.emplaceBack(value + 1));
+    EXPECT_EQ(vector.size(), 2U);
+    EXPECT_DOUBLE_EQ(vector[0U], 3.0);
+    EXPECT_DOUBLE_EQ(vector[1U], 4.0);
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,230 @@
+/**
+ * @brief Unit tests for the ATmega328p system clock driver.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "arch/test/hw_platform.h"
+#include "driver/clock/atmega328p.h"
+#include "driver/clock/stub.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief Simulated tick source driving the clock via the timer registers.
+ */
+class TickSource
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] clock Reference to the clock to drive.
+     */
+    explicit TickSource(clock::Atmega328p& clock) noexcept
+        : myClock{clock}
+    {}
+
+    /**
+     * @brief Advance the simulated time, invoking the overflow handler on overflow.
+     * 
+     * @param[in] duration_us The duration to advance the time with in microseconds.
+     */
+    void advance_us(const std::uint64_t duration_us) noexcept
+    {
+        std::uint64_t counter{static_cast<std::uint64_t>(TCNT1) + 
+                              duration_us * clock::Atmega328p::CountsPerUs};
+
+        while (0xFFFFU < counter)
+        {
+            counter -= 0x10000U;
+            myClock.handleOverflow();
+        }
+        TCNT1 = static_cast<std::uint16_t>(counter);
+    }
+
+private:
+    /** Reference to the clock to drive. */
+    clock::Atmega328p& myClock;
+};
+
+// -----------------------------------------------------------------------------
+clock::Atmega328p& systemClock() noexcept
+{
+    return static_cast<clock::Atmega328p&>(clock::Atmega328p::getInstance());
+}
+
+/**
+ * @brief Test fixture releasing Timer 1 after each test, so that other tests can use it.
+ */
+class Clock_Atmega328p : public ::testing::Test
+{
+protected:
+    // -----------------------------------------------------------------------------
+    void SetUp() override { systemClock().setEnabled(true); }
+
+    // -----------------------------------------------------------------------------
+    void TearDown() override { systemClock().setEnabled(false); }
+};
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, Initialization)
+{
+    auto& clock{systemClock()};
+
+    EXPECT_TRUE(clock.isInitialized());
+    EXPECT_TRUE(clock.isEnabled());
+    EXPECT_TRUE(utils::read(TCCR1B, CS11));
+    EXPECT_TRUE(utils::read(TIMSK1, TOIE1));
+    EXPECT_EQ(clock::Atmega328p::OverflowInterval_us, 32768U);
+}
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, Monotonic)
+{
+    auto& clock{systemClock()};
+    TickSource ticks{clock};
+
+    // Verify the time in steps crossing many overflows, including a partial counter.
+    std::uint32_t lastTime_us{clock.micros()};
+    const std::uint32_t start_us{lastTime_us};
+    const std::uint32_t startMillis{clock.millis()};
+
+    for (std::uint32_t i{1U}; i <= 10000U; ++i)
+    {
+        ticks.advance_us(997U);
+        const std::uint32_t time_us{clock.micros()};
+        ASSERT_EQ(time_us - lastTime_us, 997U);
+        lastTime_us = time_us;
+    }
+    EXPECT_EQ(lastTime_us - start_us, 9970000U);
+
+    // The millisecond time shall match the microsecond time.
+    const std::uint32_t elapsedMillis{clock.millis() - startMillis};
+    EXPECT_GE(elapsedMillis, 9969U);
+    EXPECT_LE(elapsedMillis, 9971U);
+}
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, Millis)
+{
+    auto& clock{systemClock()};
+    TickSource ticks{clock};
+
+    // Align the clock to a whole millisecond, then check that no millisecond gets lost.
+    ticks.advance_us(1000U - clock.micros() % 1000U);
+    const std::uint32_t startMillis{clock.millis()};
+    const std::uint32_t start_us{clock.micros()};
+
+    for (std::uint32_t i{1U}; i <= 5000U; ++i)
+    {
+        ticks.advance_us(1000U);
+        ASSERT_EQ(clock.millis() - startMillis, i);
+        ASSERT_EQ(clock.micros() - start_us, i * 1000U);
+    }
+}
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, PendingOverflow)
+{
+    auto& clock{systemClock()};
+    const std::uint32_t time_us{clock.micros()};
+    const std::uint16_t counter{TCNT1};
+
+    // Simulate that the counter has wrapped around while interrupts were disabled, 
+    // i.e. the overflow interrupt is pending.
+    TCNT1 = 10U;
+    utils::set(TIFR1, TOV1);
+    const std::uint32_t expected_us{time_us + (0x10000U - counter + 10U) / 2U};
+    EXPECT_EQ(clock.micros(), expected_us);
+
+    // A pending overflow shall be ignored if the counter was read before the wrap-around.
+    TCNT1 = 0xFFF0U;
+    EXPECT_EQ(clock.micros(), time_us + (0xFFF0U - counter) / 2U);
+
+    // Handle the overflow, the time shall be unchanged.
+    TCNT1 = 10U;
+    clock.handleOverflow();
+    utils::clear(TIFR1, TOV1);
+    EXPECT_EQ(clock.micros(), expected_us);
+}
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, WrapAround)
+{
+    auto& clock{systemClock()};
+    TickSource ticks{clock};
+
+    // Measure elapsed time across the 32-bit wrap-around of the microsecond time.
+    ticks.advance_us(0xFFFFFFFFULL - clock.micros() - 100U);
+    const std::uint32_t start_us{clock.micros()};
+    EXPECT_EQ(start_us, 0xFFFFFFFFU - 100U);
+
+    ticks.advance_us(500U);
+    EXPECT_LT(clock.micros(), start_us);
+    EXPECT_EQ(clock.micros() - start_us, 500U);
+}
+
+// -----------------------------------------------------------------------------
+TEST_F(Clock_Atmega328p, Timer1Reservation)
+{
+    auto& clock{systemClock()};
+
+    // Timer 1 is reserved while the clock is enabled, leaving two hardware timers.
+    {
+        timer::Atmega328p timer1{100U};
+        timer::Atmega328p timer2{100U};
+        timer::Atmega328p timer3{100U};
+        EXPECT_TRUE(timer1.isInitialized());
+        EXPECT_TRUE(timer2.isInitialized());
+        EXPECT_FALSE(timer3.isInitialized());
+    }
+
+    // Disable the clock, the time shall be kept while Timer 1 is used by a timer.
+    const std::uint32_t time_us{clock.micros()};
+    EXPECT_TRUE(clock.setEnabled(false));
+    EXPECT_FALSE(utils::read(TIMSK1, TOIE1));
+    {
+        timer::Atmega328p timers[3U]{timer::Atmega328p{100U}, timer::Atmega328p{100U}, 
+                                     timer::Atmega328p{100U}};
+        EXPECT_TRUE(timers[2U].isInitialized());
+        EXPECT_EQ(clock.micros(), time_us);
+
+        // The clock can't be enabled while Timer 1 is used.
+        EXPECT_FALSE(clock.setEnabled(true));
+        EXPECT_FALSE(clock.isEnabled());
+    }
+
+    EXPECT_TRUE(clock.setEnabled(true));
+    EXPECT_EQ(clock.micros(), time_us);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Clock_Stub, SimulatedTime)
+{
+    clock::Stub clock{};
+    EXPECT_EQ(clock.micros(), 0U);
+
+    clock.advance_us(1500U);
+    EXPECT_EQ(clock.micros(), 1500U);
+    EXPECT_EQ(clock.millis(), 1U);
+
+    // The time shall not advance while the clock is disabled.
+    clock.setEnabled(false);
+    clock.advance_us(1000U);
+    EXPECT_EQ(clock.micros(), 1500U);
+
+    clock.setTime_us(0x100000000ULL + 10U);
+    EXPECT_EQ(clock.micros(), 10U);
+    EXPECT_EQ(clock.millis(), 4294967U);
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
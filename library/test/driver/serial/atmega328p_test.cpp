@@ -1,6 +1,7 @@
 /**
  * @brief Unit tests for the ATmega328p serial driver.
  */
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <string>
@@ -126,10 +127,146 @@ TEST(Serial_Atmega328p, Initialization)
     EXPECT_FALSE(serial.isEnabled());
 
     //! - Check that baud rate can be read.
-    constexpr uint32_t expectedBaudRate_bps{9600U};
+    // The actual default baud rate deviates 0.16 % from 9600 bps at 16 MHz.
+    constexpr uint32_t expectedBaudRate_bps{9615U};
     EXPECT_EQ(expectedBaudRate_bps, serial.baudRate_bps());
 }
 
+/**
+ * @brief Serial baud rate computation test.
+ * 
+ *        Verify that the baud rate register value, the speed mode and the baud rate error 
+ *        are computed as listed in the ATmega328P datasheet (16 MHz clock frequency).
+ */
+TEST(Serial_Atmega328p, BaudRateConfig)
+{
+    using Config = serial::Atmega328p::BaudRateConfig;
+
+    // Expect the settings to be computable at compile time.
+    constexpr Config defaultConfig{
+        serial::Atmega328p::baudRateConfig(serial::Atmega328p::DefaultBaudRate_bps)};
+    static_assert(defaultConfig.isValid && (103U == defaultConfig.ubrr) && 
+                  !defaultConfig.doubleSpeed, "Invalid default baud rate settings!");
+
+    struct Expected
+    {
+        std::uint32_t requested_bps;
+        bool doubleSpeed;
+        std::uint16_t ubrr;
+        std::uint32_t actual_bps;
+        std::int32_t error_ppm;
+    };
+
+    // Expect normal speed unless double speed results in a smaller baud rate error.
+    constexpr Expected expected[]{
+        {300U, false, 3332U, 300U, 100},
+        {2400U, true, 832U, 2401U, 400},
+        {9600U, false, 103U, 9615U, 1603},
+        {38400U, false, 25U, 38462U, 1603},
+        {57600U, true, 34U, 57143U, -7937},
+        {115200U, true, 16U, 117647U, 21242},
+        {250000U, false, 3U, 250000U, 0},
+        {500000U, false, 1U, 500000U, 0},
+        {1000000U, false, 0U, 1000000U, 0},
+    };
+
+    for (const auto& exp : expected)
+    {
+        const Config config{serial::Atmega328p::baudRateConfig(exp.requested_bps)};
+        EXPECT_TRUE(config.isValid);
+        EXPECT_EQ(exp.doubleSpeed, config.doubleSpeed);
+        EXPECT_EQ(exp.ubrr, config.ubrr);
+        EXPECT_EQ(exp.actual_bps, config.baudRate_bps);
+        EXPECT_EQ(exp.error_ppm, config.error_ppm);
+    }
+
+    // Expect baud rates out of range to be rejected.
+    EXPECT_FALSE(serial::Atmega328p::baudRateConfig(0U).isValid);
+    EXPECT_FALSE(serial::Atmega328p::baudRateConfig(100U).isValid);
+    EXPECT_FALSE(serial::Atmega328p::baudRateConfig(2000000U).isValid);
+
+    // Expect baud rates with too large error to be rejected (230400 bps has a 3.5 % error).
+    EXPECT_FALSE(serial::Atmega328p::baudRateConfig(230400U).isValid);
+    EXPECT_TRUE(serial::Atmega328p::baudRateConfig(230400U, 40000U).isValid);
+    EXPECT_FALSE(serial::Atmega328p::baudRateConfig(115200U, 20000U).isValid);
+}
+
+/**
+ * @brief Serial baud rate configuration test.
+ * 
+ *        Verify that the baud rate registers are updated when the baud rate is changed and 
+ *        that invalid baud rates are rejected.
+ */
+TEST(Serial_Atmega328p, SetBaudRate)
+{
+    auto& serial{static_cast<serial::Atmega328p&>(initSerial())};
+
+    // Set 115200 bps, expect double speed mode to be used.
+    EXPECT_TRUE(serial.setBaudRate(115200U));
+    EXPECT_EQ(16U, UBRR0);
+    EXPECT_TRUE(utils::read(UCSR0A, U2X0));
+    EXPECT_EQ(117647U, serial.baudRate_bps());
+    EXPECT_EQ(21242, serial.baudRateError_ppm());
+
+    // Expect invalid baud rates to be rejected, the current settings are then kept.
+    EXPECT_FALSE(serial.setBaudRate(230400U));
+    EXPECT_FALSE(serial.setBaudRate(0U));
+    EXPECT_EQ(16U, UBRR0);
+    EXPECT_EQ(117647U, serial.baudRate_bps());
+
+    // Set 1 Mbps with settings computed at compile time, expect normal speed mode to be used.
+    serial.setBaudRate<1000000U>();
+    EXPECT_EQ(0U, UBRR0);
+    EXPECT_FALSE(utils::read(UCSR0A, U2X0));
+    EXPECT_EQ(1000000U, serial.baudRate_bps());
+    EXPECT_EQ(0, serial.baudRateError_ppm());
+
+    // Restore the default baud rate for the other tests.
+    serial.setBaudRate<serial::Atmega328p::DefaultBaudRate_bps>();
+    EXPECT_EQ(103U, UBRR0);
+    EXPECT_EQ(9615U, serial.baudRate_bps());
+}
+
+/**
+ * @brief Baud rate change test.
+ *
+ *        Verify that the baud rate isn't changed before the last character has been shifted
+ *        out, since it would be garbled otherwise.
+ */
+TEST(Serial_Atmega328p, SetBaudRateWaitsForTxComplete)
+{
+    auto& serial{static_cast<serial::Atmega328p&>(initSerial())};
+    serial.setTxMode(serial::Atmega328p::TxMode::Blocking);
+
+    // Transmit a character, then simulate that it's still being shifted out.
+    utils::set(UCSR0A, UDRE0);
+    serial.printf("x");
+    utils::clear(UCSR0A, TXC0);
+
+    // Expect the baud rate registers to be kept while the transmission is in progress.
+    std::atomic<bool> done{false};
+    std::thread changer{[&serial, &done]()
+    {
+        serial.setBaudRate<1000000U>();
+        done = true;
+    }};
+    delay_us(1000U);
+    EXPECT_FALSE(done);
+    EXPECT_EQ(103U, UBRR0);
+
+    // Expect the baud rate to be changed once the transmission is complete.
+    utils::set(UCSR0A, TXC0);
+    changer.join();
+    EXPECT_TRUE(done);
+    EXPECT_EQ(0U, UBRR0);
+
+    // Expect no wait if nothing has been transmitted since, restore the default baud rate.
+    utils::clear(UCSR0A, TXC0);
+    serial.setBaudRate<serial::Atmega328p::DefaultBaudRate_bps>();
+    EXPECT_EQ(103U, UBRR0);
+    utils::set(UCSR0A, TXC0);
+}
+
 /**
  * @brief Serial print test.
  * 
@@ -157,7 +294,297 @@ TEST(Serial_Atmega328p, Transmit)
     t3.join();
 }
 
-//! @todo Add more tests here!
+// -----------------------------------------------------------------------------
+serial::Atmega328p& initBufferedSerial(const serial::Atmega328p::OverflowPolicy policy) noexcept
+{
+    // Initialize the serial instance in buffered mode with the given overflow policy.
+    auto& serial{static_cast<serial::Atmega328p&>(initSerial())};
+    serial.setTxMode(serial::Atmega328p::TxMode::Buffered);
+    serial.setOverflowPolicy(policy);
+    return serial;
+}
+
+// -----------------------------------------------------------------------------
+std::string drainTxBuffer(serial::Atmega328p& serial) noexcept
+{
+    std::string transmitted{};
+
+    // Simulate data register empty interrupts until the interrupt is disabled by the driver.
+    while (utils::read(UCSR0B, UDRIE0))
+    {
+        const auto prevFreeSpace{serial.txFreeSpace()};
+        serial.handleTxInterrupt();
+
+        // Store the character put in the data register, if any.
+        if (prevFreeSpace != serial.txFreeSpace()) { transmitted += static_cast<char>(UDR0); }
+    }
+    return transmitted;
+}
+
+// -----------------------------------------------------------------------------
+void restoreBlockingMode(serial::Atmega328p& serial) noexcept
+{
+    // Make sure the singleton is left in blocking mode for the other tests.
+    (void) (drainTxBuffer(serial));
+    serial.setTxMode(serial::Atmega328p::TxMode::Blocking);
+}
+
+/**
+ * @brief Serial buffered transmission test.
+ * 
+ *        Verify that the caller isn't blocked in buffered mode and that queued characters are 
+ *        transmitted in order via the data register empty interrupt.
+ */
+TEST(Serial_Atmega328p, BufferedTransmit)
+{
+    using OverflowPolicy = serial::Atmega328p::OverflowPolicy;
+    auto& serial{initBufferedSerial(OverflowPolicy::Drop)};
+    constexpr auto bufferSize{serial::Atmega328p::TxBufferSize};
+
+    // Expect the entire buffer to be available at start.
+    EXPECT_EQ(bufferSize, serial.txFreeSpace());
+    const auto dropCount{serial.txDropCount()};
+
+    // Print a 40-character message (which takes about 40 ms to transmit at 9600 bps).
+    const std::string msg{"Temperature: 25 Celsius, 40 characters!"};
+    const auto startTime{std::chrono::steady_clock::now()};
+    EXPECT_TRUE(serial.printf(msg.c_str()));
+    const auto blockTime_us{std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count()};
+
+    // Expect the caller to be blocked far shorter than the wire time of the message.
+    // Each character consists of ten bits (start bit, eight data bits and a stop bit).
+    constexpr double bitsPerChar{10.0};
+    const double wireTime_us{msg.size() * bitsPerChar * 1e6 / serial.baudRate_bps()};
+    EXPECT_LT(blockTime_us, wireTime_us / 10.0);
+
+    // Expect the message to be queued and the data register empty interrupt to be enabled.
+    EXPECT_EQ(bufferSize - msg.size(), serial.txFreeSpace());
+    EXPECT_TRUE(utils::read(UCSR0B, UDRIE0));
+
+    // Expect the message to be transmitted in order, the interrupt is then disabled.
+    EXPECT_EQ(msg, drainTxBuffer(serial));
+    EXPECT_FALSE(utils::read(UCSR0B, UDRIE0));
+    EXPECT_EQ(bufferSize, serial.txFreeSpace());
+    EXPECT_EQ(dropCount, serial.txDropCount());
+
+    // Expect new lines to be combined with carriage returns in buffered mode as well.
+    EXPECT_TRUE(serial.printf("OK\n"));
+    EXPECT_EQ(std::string{"OK\n\r"}, drainTxBuffer(serial));
+
+    // Expect no free space to be reported in blocking mode.
+    restoreBlockingMode(serial);
+    EXPECT_EQ(0U, serial.txFreeSpace());
+}
+
+/**
+ * @brief Serial formatted transmission test.
+ * 
+ *        Verify that formatted arguments are streamed to the serial port in order, with new 
+ *        lines combined with carriage returns just like for unformatted strings.
+ */
+TEST(Serial_Atmega328p, FormattedTransmit)
+{
+    using OverflowPolicy = serial::Atmega328p::OverflowPolicy;
+    auto& serial{initBufferedSerial(OverflowPolicy::Drop)};
+    const auto dropCount{serial.txDropCount()};
+
+    // Print integers, hexadecimal numbers, fixed-point numbers and strings.
+    const std::int16_t temperature{-12};
+    const std::uint8_t id{0xAU};
+    EXPECT_TRUE(serial.printf("Temp: %d C, id 0x%02X, %.1f V, %s\n", 
+                              temperature, id, 4.96, "OK"));
+    EXPECT_EQ(std::string{"Temp: -12 C, id 0x0A, 5.0 V, OK\n\r"}, drainTxBuffer(serial));
+    EXPECT_EQ(dropCount, serial.txDropCount());
+
+    // Expect percent signs to be printed as is without arguments, else merged.
+    EXPECT_TRUE(serial.printf("100%%"));
+    EXPECT_EQ(std::string{"100%%"}, drainTxBuffer(serial));
+    EXPECT_TRUE(serial.printf("%u%%", 100U));
+    EXPECT_EQ(std::string{"100%"}, drainTxBuffer(serial));
+
+    // Expect nothing to be printed when the serial device is disabled.
+    serial.setEnabled(false);
+    EXPECT_TRUE(serial.printf("%d", 1));
+    EXPECT_FALSE(utils::read(UCSR0B, UDRIE0));
+    serial.setEnabled(true);
+    restoreBlockingMode(serial);
+}
+
+/**
+ * @brief Serial binary transmission test.
+ * 
+ *        Verify that binary data is transmitted as is, without combining new lines with 
+ *        carriage returns.
+ */
+TEST(Serial_Atmega328p, BinaryWrite)
+{
+    using OverflowPolicy = serial::Atmega328p::OverflowPolicy;
+    auto& serial{initBufferedSerial(OverflowPolicy::Drop)};
+
+    const std::uint8_t data[]{0x01U, '\n', 0x7FU, '\r', 0xFFU};
+    EXPECT_EQ(static_cast<std::int16_t>(sizeof(data)), serial.write(data, sizeof(data)));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(data), sizeof(data)), 
+              drainTxBuffer(serial));
+
+    // Expect invalid data to be rejected and nothing to be written when disabled.
+    EXPECT_EQ(-1, serial.write(nullptr, sizeof(data)));
+    EXPECT_EQ(-1, serial.write(data, 0U));
+    serial.setEnabled(false);
+    EXPECT_EQ(0, serial.write(data, sizeof(data)));
+    EXPECT_EQ(serial::Atmega328p::TxBufferSize, serial.txFreeSpace());
+    serial.setEnabled(true);
+    restoreBlockingMode(serial);
+}
+
+/**
+ * @brief Serial transmit buffer overflow test.
+ * 
+ *        Verify that each overflow policy handles a full transmit buffer as intended.
+ */
+TEST(Serial_Atmega328p, BufferedOverflow)
+{
+    using OverflowPolicy = serial::Atmega328p::OverflowPolicy;
+    constexpr auto bufferSize{serial::Atmega328p::TxBufferSize};
+    constexpr std::size_t overflowCount{10U};
+
+    // Create a message that doesn't fit in the transmit buffer.
+    std::string msg{};
+    for (std::size_t i{}; i < bufferSize + overflowCount; ++i) 
+    { 
+        msg += static_cast<char>('a' + (i % 26U)); 
+    }
+
+    // Case 1 - Drop policy, expect the characters that don't fit to be discarded.
+    {
+        auto& serial{initBufferedSerial(OverflowPolicy::Drop)};
+        const auto dropCount{serial.txDropCount()};
+        serial.printf(msg.c_str());
+
+        EXPECT_EQ(0U, serial.txFreeSpace());
+        EXPECT_EQ(dropCount + overflowCount, serial.txDropCount());
+        EXPECT_EQ(msg.substr(0U, bufferSize), drainTxBuffer(serial));
+        restoreBlockingMode(serial);
+    }
+
+    // Case 2 - Overwrite policy, expect the oldest characters to be discarded.
+    {
+        auto& serial{initBufferedSerial(OverflowPolicy::OverwriteOldest)};
+        const auto dropCount{serial.txDropCount()};
+        serial.printf(msg.c_str());
+
+        EXPECT_EQ(0U, serial.txFreeSpace());
+        EXPECT_EQ(dropCount + overflowCount, serial.txDropCount());
+        EXPECT_EQ(msg.substr(overflowCount), drainTxBuffer(serial));
+        restoreBlockingMode(serial);
+    }
+
+    // Case 3 - Block policy with interrupts disabled (e.g. printing from an interrupt handler).
+    // Expect the driver to feed the data register itself until the message fits in the buffer.
+    {
+        auto& serial{initBufferedSerial(OverflowPolicy::Block)};
+        const auto dropCount{serial.txDropCount()};
+        utils::globalInterruptDisable();
+        utils::set(UCSR0A, UDRE0);
+        serial.printf(msg.c_str());
+
+        // Expect the first characters to have been transmitted, the rest to be queued.
+        EXPECT_EQ(0U, serial.txFreeSpace());
+        EXPECT_EQ(dropCount, serial.txDropCount());
+        EXPECT_EQ(msg.substr(overflowCount), drainTxBuffer(serial));
+        restoreBlockingMode(serial);
+        utils::globalInterruptEnable();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void simulateReceive(serial::Atmega328p& serial, const std::string& data) noexcept
+{
+    // Put each byte in the data register, then simulate a receive complete interrupt.
+    for (const auto& byte : data)
+    {
+        UDR0 = static_cast<std::uint8_t>(byte);
+        serial.handleRxInterrupt();
+    }
+}
+
+/**
+ * @brief Serial buffered reception test.
+ * 
+ *        Verify that received bytes are buffered via the receive complete interrupt and can be
+ *        read without blocking.
+ */
+TEST(Serial_Atmega328p, BufferedReceive)
+{
+    auto& serial{static_cast<serial::Atmega328p&>(initSerial())};
+    std::uint8_t buffer[serial::Atmega328p::RxBufferSize]{};
+    constexpr std::uint8_t newLine{'\n'};
+
+    // Expect no data to be available at start, and non-blocking reads to return immediately.
+    EXPECT_EQ(0U, serial.available());
+    EXPECT_EQ(0, serial.read(buffer, sizeof(buffer)));
+    EXPECT_EQ(0, serial.readUntil(buffer, sizeof(buffer), newLine));
+
+    // Expect invalid read parameters to be rejected.
+    EXPECT_EQ(-1, serial.read(nullptr, sizeof(buffer)));
+    EXPECT_EQ(-1, serial.read(buffer, 0U));
+    EXPECT_EQ(-1, serial.readUntil(nullptr, sizeof(buffer), newLine));
+
+    // Receive part of a command, expect nothing to be consumed until the delimiter is received.
+    simulateReceive(serial, "te");
+    EXPECT_EQ(2U, serial.available());
+    EXPECT_EQ(0, serial.readUntil(buffer, sizeof(buffer), newLine));
+    EXPECT_EQ(2U, serial.available());
+
+    // Receive the rest of the command and the start of the next one.
+    // Expect the command to be read up to and including the delimiter.
+    simulateReceive(serial, "mp\nab");
+    EXPECT_EQ(5, serial.readUntil(buffer, sizeof(buffer), newLine));
+    EXPECT_EQ(std::string{"temp\n"}, std::string(reinterpret_cast<char*>(buffer), 5U));
+    EXPECT_EQ(2U, serial.available());
+
+    // Expect a non-blocking read to return the remaining bytes only.
+    EXPECT_EQ(2, serial.read(buffer, sizeof(buffer)));
+    EXPECT_EQ(std::string{"ab"}, std::string(reinterpret_cast<char*>(buffer), 2U));
+    EXPECT_EQ(0U, serial.available());
+
+    // Expect a read with timeout to return as soon as the read buffer is full.
+    simulateReceive(serial, "xyz");
+    const auto startTime{std::chrono::steady_clock::now()};
+    EXPECT_EQ(3, serial.read(buffer, 3U, 1000U));
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, std::chrono::milliseconds(100U));
+    EXPECT_EQ(std::string{"xyz"}, std::string(reinterpret_cast<char*>(buffer), 3U));
+
+    // Expect readUntil to read as many bytes as fit if the read buffer is too small.
+    simulateReceive(serial, "status\n");
+    EXPECT_EQ(4, serial.readUntil(buffer, 4U, newLine));
+    EXPECT_EQ(3, serial.readUntil(buffer, sizeof(buffer), newLine));
+    EXPECT_EQ(0U, serial.available());
+}
+
+/**
+ * @brief Serial receive buffer overflow test.
+ * 
+ *        Verify that bytes received when the receive buffer is full are discarded.
+ */
+TEST(Serial_Atmega328p, BufferedReceiveOverflow)
+{
+    auto& serial{static_cast<serial::Atmega328p&>(initSerial())};
+    constexpr auto bufferSize{serial::Atmega328p::RxBufferSize};
+    constexpr std::size_t overflowCount{5U};
+    const auto dropCount{serial.rxDropCount()};
+
+    // Receive more bytes than fit in the receive buffer.
+    simulateReceive(serial, std::string(bufferSize + overflowCount, 'a'));
+    EXPECT_EQ(bufferSize, serial.available());
+    EXPECT_EQ(dropCount + overflowCount, serial.rxDropCount());
+
+    // Expect readUntil to read the full buffer even without a delimiter to avoid a deadlock.
+    std::uint8_t buffer[2U * bufferSize]{};
+    EXPECT_EQ(static_cast<std::int16_t>(bufferSize), 
+              serial.readUntil(buffer, sizeof(buffer), '\n'));
+    EXPECT_EQ(0U, serial.available());
+}
 
 } // namespace
 } // namespace driver.
@@ -0,0 +1,269 @@
+/**
+ * @brief Unit tests for the timing wheel and software timers.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+std::uint32_t callbackCount{0U};
+
+timer::Software* stoppedTimer{nullptr};
+timer::Software* startedTimer{nullptr};
+bool timedOutInCallback{false};
+
+// -----------------------------------------------------------------------------
+void countCallback() noexcept { ++callbackCount; }
+
+// -----------------------------------------------------------------------------
+void switchCallback() noexcept
+{
+    ++callbackCount;
+    if (nullptr != stoppedTimer) { stoppedTimer->stop(); }
+    if (nullptr != startedTimer) { startedTimer->start(); }
+}
+
+// -----------------------------------------------------------------------------
+void checkTimedOutCallback() noexcept
+{
+    timedOutInCallback = (nullptr != stoppedTimer) && stoppedTimer->hasTimedOut();
+}
+
+// -----------------------------------------------------------------------------
+void runTicks(timer::Wheel& wheel, const std::uint32_t tickCount) noexcept
+{
+    for (std::uint32_t i{}; i < tickCount; ++i) { wheel.tick(); }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, Initialization)
+{
+    timer::Wheel wheel{};
+    timer::Software timer1{wheel, 100U};
+    timer::Software timer2{wheel, 0U};
+
+    EXPECT_TRUE(timer1.isInitialized());
+    EXPECT_FALSE(timer2.isInitialized());
+    EXPECT_FALSE(timer1.isEnabled());
+    EXPECT_EQ(timer1.timeout_ms(), 100U);
+    EXPECT_EQ(timer1.mode(), timer::Software::Mode::Periodic);
+
+    // Uninitialized timers can't be started.
+    timer2.start();
+    EXPECT_FALSE(timer2.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+
+    // The timeout is rounded to a whole number of ticks.
+    timer::Wheel coarseWheel{1024U};
+    timer::Software timer3{coarseWheel, 100U};
+    EXPECT_EQ(timer3.timeout_ms(), 100U);
+    timer3.setTimeout_ms(1U);
+    EXPECT_EQ(timer3.timeout_ms(), 1U);
+    timer3.setTimeout_ms(0U);
+    EXPECT_TRUE(timer3.isInitialized());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, EnableDisable)
+{
+    timer::Wheel wheel{};
+    timer::Software timer{wheel, 100U};
+
+    timer.start();
+    EXPECT_TRUE(timer.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 1U);
+
+    // Starting a running timer shall not schedule it twice.
+    timer.start();
+    EXPECT_EQ(wheel.activeTimerCount(), 1U);
+
+    timer.stop();
+    EXPECT_FALSE(timer.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+
+    timer.toggle();
+    EXPECT_TRUE(timer.isEnabled());
+    timer.toggle();
+    EXPECT_FALSE(timer.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, Periodic)
+{
+    timer::Wheel wheel{};
+    timer::Software timer{wheel, 10U, countCallback, true};
+    callbackCount = 0U;
+
+    runTicks(wheel, 9U);
+    EXPECT_EQ(callbackCount, 0U);
+    wheel.tick();
+    EXPECT_EQ(callbackCount, 1U);
+    EXPECT_TRUE(timer.isEnabled());
+    EXPECT_FALSE(timer.hasTimedOut());
+
+    // The timer shall time out every tenth tick without drifting.
+    runTicks(wheel, 990U);
+    EXPECT_EQ(callbackCount, 100U);
+    EXPECT_EQ(wheel.activeTimerCount(), 1U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, OneShot)
+{
+    timer::Wheel wheel{};
+    timer::Software timer{wheel, 5U, nullptr, true, timer::Software::Mode::OneShot};
+
+    runTicks(wheel, 4U);
+    EXPECT_FALSE(timer.hasTimedOut());
+    wheel.tick();
+
+    // Without callback, the timeout flag stays set until the timer is restarted.
+    EXPECT_TRUE(timer.hasTimedOut());
+    EXPECT_FALSE(timer.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+    runTicks(wheel, 10U);
+    EXPECT_TRUE(timer.hasTimedOut());
+
+    timer.restart();
+    EXPECT_FALSE(timer.hasTimedOut());
+    EXPECT_TRUE(timer.isEnabled());
+    runTicks(wheel, 5U);
+    EXPECT_TRUE(timer.hasTimedOut());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, Restart)
+{
+    timer::Wheel wheel{};
+    timer::Software timer{wheel, 10U, countCallback, true, timer::Software::Mode::OneShot};
+    callbackCount = 0U;
+
+    // Restarting the timer before the timeout shall postpone the timeout.
+    runTicks(wheel, 8U);
+    timer.restart();
+    runTicks(wheel, 9U);
+    EXPECT_EQ(callbackCount, 0U);
+    wheel.tick();
+    EXPECT_EQ(callbackCount, 1U);
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, LongTimeouts)
+{
+    // Test timeouts handled by each level of the wheel, including timeouts beyond the top level.
+    constexpr std::uint32_t timeouts[]{1U, 15U, 16U, 17U, 255U, 256U, 4095U, 4097U, 
+                                       65535U, 65536U, 100000U, 200003U};
+
+    for (const auto& timeout : timeouts)
+    {
+        timer::Wheel wheel{};
+        timer::Software timer{wheel, timeout, nullptr, true, timer::Software::Mode::OneShot};
+
+        runTicks(wheel, timeout - 1U);
+        EXPECT_FALSE(timer.hasTimedOut()) << "Timeout: " << timeout;
+        wheel.tick();
+        EXPECT_TRUE(timer.hasTimedOut()) << "Timeout: " << timeout;
+    }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, ManyTimers)
+{
+    constexpr std::uint16_t timerCount{300U};
+    timer::Wheel wheel{};
+    timer::Software* timers[timerCount]{};
+
+    runTicks(wheel, 123U);
+
+    for (std::uint16_t i{}; i < timerCount; ++i)
+    {
+        timers[i] = new timer::Software{wheel, (i * 37U) % 5000U + 1U, nullptr, true, 
+                                        timer::Software::Mode::OneShot};
+    }
+    EXPECT_EQ(wheel.activeTimerCount(), timerCount);
+
+    // Each timer shall time out at exactly its timeout.
+    for (std::uint32_t tick{1U}; tick <= 5000U; ++tick)
+    {
+        wheel.tick();
+
+        for (std::uint16_t i{}; i < timerCount; ++i)
+        {
+            const std::uint32_t timeout{(i * 37U) % 5000U + 1U};
+            ASSERT_EQ(timers[i]->hasTimedOut(), tick >= timeout) << "Timer: " << i;
+        }
+    }
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+
+    for (auto& timer : timers) { delete timer; }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, StopFromCallback)
+{
+    timer::Wheel wheel{};
+    timer::Software timer1{wheel, 10U, switchCallback, true};
+    timer::Software timer2{wheel, 10U, nullptr, true};
+    timer::Software timer3{wheel, 20U, nullptr, false, timer::Software::Mode::OneShot};
+    callbackCount = 0U;
+
+    // Stop a timer expiring at the same tick and start another timer from the callback.
+    stoppedTimer = &timer2;
+    startedTimer = &timer3;
+    runTicks(wheel, 10U);
+    stoppedTimer = nullptr;
+    startedTimer = nullptr;
+
+    EXPECT_EQ(callbackCount, 1U);
+    EXPECT_FALSE(timer2.isEnabled());
+    EXPECT_FALSE(timer2.hasTimedOut());
+    EXPECT_TRUE(timer3.isEnabled());
+    EXPECT_EQ(wheel.activeTimerCount(), 2U);
+
+    runTicks(wheel, 20U);
+    EXPECT_TRUE(timer3.hasTimedOut());
+    EXPECT_EQ(callbackCount, 3U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, TimedOutDuringCallback)
+{
+    timer::Wheel wheel{};
+    timer::Software timer{wheel, 3U, checkTimedOutCallback, true};
+    stoppedTimer = &timer;
+    timedOutInCallback = false;
+
+    // The timeout flag shall be set during the callback only, like for the hardware timers.
+    runTicks(wheel, 3U);
+    stoppedTimer = nullptr;
+    EXPECT_TRUE(timedOutInCallback);
+    EXPECT_FALSE(timer.hasTimedOut());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Timer_Wheel, Destruction)
+{
+    timer::Wheel wheel{};
+    {
+        timer::Software timer{wheel, 10U, countCallback, true};
+        EXPECT_EQ(wheel.activeTimerCount(), 1U);
+    }
+    // Destroyed timers shall be removed from the wheel.
+    EXPECT_EQ(wheel.activeTimerCount(), 0U);
+    callbackCount = 0U;
+    runTicks(wheel, 20U);
+    EXPECT_EQ(callbackCount, 0U);
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
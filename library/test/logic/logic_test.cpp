@@ -1,14 +1,17 @@
 /**
  * @brief Component tests for the logic implementation.
  */
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <thread>
 
 #include <gtest/gtest.h>
 
+#include "driver/clock/stub.h"
 #include "driver/eeprom/stub.h"
 #include "driver/gpio/stub.h"
 #include "driver/serial/stub.h"
@@ -16,6 +19,7 @@
 #include "driver/timer/stub.h"
 #include "driver/watchdog/stub.h"
 #include "logic/stub.h"
+#include "scheduler/scheduler.h"
 
 
 
@@ -145,6 +149,80 @@ private:
     }
 };
 
+/**
+ * @brief Watchdog stub publishing the progress of the run loop, which resets the watchdog
+ *        once per iteration.
+ *
+ *        The LED toggle count is published via an atomic counter, since the LED is toggled
+ *        by the run loop thread. The stop flag is only written by the run loop thread as well,
+ *        once the LED has been toggled given number of times.
+ */
+class ProgressWatchdog final : public driver::watchdog::Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] led The LED toggled by the run loop.
+     */
+    explicit ProgressWatchdog(const driver::gpio::Stub& led) noexcept
+        : myLed{led}
+        , myToggleCount{0U}
+        , myStopCount{UINT32_MAX}
+        , myStop{false}
+    {}
+
+    bool isInitialized() const noexcept override { return true; }
+    bool isEnabled() const noexcept override { return true; }
+    void setEnabled(const bool) noexcept override {}
+    std::uint16_t timeout_ms() const noexcept override { return 1024U; }
+    bool setTimeout_ms(const std::uint16_t) noexcept override { return true; }
+
+    /**
+     * @brief Publish the LED toggle count, and stop the run loop once the stop count is reached.
+     */
+    void reset() noexcept override
+    {
+        const std::uint32_t toggleCount{myLed.toggleCount()};
+        myToggleCount = toggleCount;
+        myStop        = myStopCount <= toggleCount;
+    }
+
+    /**
+     * @brief Get the LED toggle count published by the run loop.
+     *
+     * @return The LED toggle count.
+     */
+    std::uint32_t toggleCount() const noexcept { return myToggleCount; }
+
+    /**
+     * @brief Set the LED toggle count at which the run loop is stopped.
+     *
+     * @param[in] toggleCount The LED toggle count. Use 0 to stop the run loop right away.
+     */
+    void stopAt(const std::uint32_t toggleCount) noexcept { myStopCount = toggleCount; }
+
+    /**
+     * @brief Get the stop flag of the run loop.
+     *
+     * @return Reference to the stop flag.
+     */
+    const bool& stop() const noexcept { return myStop; }
+
+private:
+    /** The LED toggled by the run loop. */
+    const driver::gpio::Stub& myLed;
+
+    /** The LED toggle count published by the run loop. */
+    std::atomic<std::uint32_t> myToggleCount;
+
+    /** The LED toggle count at which the run loop is stopped. */
+    std::atomic<std::uint32_t> myStopCount;
+
+    /** Stop flag of the run loop, only accessed by the run loop thread. */
+    bool myStop;
+};
+
 /**
  * @brief Debounce handling test.
  *
@@ -393,6 +471,216 @@ TEST(Logic, Eeprom)
         EXPECT_TRUE(mock.toggleTimer.isEnabled());
     }
 }
+
+/**
+ * @brief Event ordering test.
+ *
+ *        Verify that posted events are handled by the run loop in the order they were posted.
+ */
+TEST(Logic, EventOrdering)
+{
+    Mock mock{};
+    logic::Stub& logic{static_cast<logic::Stub&>(mock.createLogic())};
+
+    // Case 1 - Post a button event followed by two toggle timer timeouts.
+    // Expect the toggle timer to be enabled first, so that the LED is toggled twice.
+    {
+        mock.toggleButton.write(true);
+        EXPECT_TRUE(logic.postEvent(Event::ButtonPressed));
+        EXPECT_TRUE(logic.postEvent(Event::ToggleTimerTimeout));
+        EXPECT_TRUE(logic.postEvent(Event::ToggleTimerTimeout));
+
+        // Nothing shall be handled until the run loop is running.
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        mock.runSystem();
+        mock.toggleButton.write(false);
+
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+        EXPECT_TRUE(mock.debounceTimer.isEnabled());
+        EXPECT_EQ(mock.led.toggleCount(), 2U);
+    }
+
+    // Case 2 - Post a debounce timer timeout followed by a button event.
+    // Expect the button interrupts to be re-enabled before the button event is handled, 
+    // which disables the toggle timer and the LED.
+    {
+        mock.toggleButton.write(true);
+        EXPECT_TRUE(logic.postEvent(Event::DebounceTimerTimeout));
+        EXPECT_TRUE(logic.postEvent(Event::ButtonPressed));
+        EXPECT_TRUE(logic.postEvent(Event::ToggleTimerTimeout));
+        mock.runSystem();
+        mock.toggleButton.write(false);
+
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        EXPECT_FALSE(mock.led.read());
+
+        // The toggle timer timeout was posted before the toggle timer was disabled, but handled
+        // after, expect it to be ignored.
+        EXPECT_EQ(mock.led.toggleCount(), 2U);
+    }
+
+    // Case 3 - Post temperature timer timeouts, expect one printout per event.
+    {
+        const auto initialPrintCount{logic.tempPrintoutCount()};
+        EXPECT_TRUE(logic.postEvent(Event::TempTimerTimeout));
+        EXPECT_TRUE(logic.postEvent(Event::TempTimerTimeout));
+        mock.runSystem();
+        EXPECT_EQ(initialPrintCount + 2U, logic.tempPrintoutCount());
+    }
+}
+
+/**
+ * @brief Event burst test.
+ *
+ *        Verify that no events are lost when posted in bursts of up to the queue capacity.
+ */
+TEST(Logic, EventBurst)
+{
+    Mock mock{};
+    ProgressWatchdog watchdog{mock.led};
+    logic::Stub logic{mock.led, mock.toggleButton, mock.tempButton, mock.debounceTimer,
+                      mock.toggleTimer, mock.tempTimer, mock.serial, watchdog, mock.eeprom,
+                      mock.tempSensor};
+    mock.toggleTimer.start();
+
+    // Case 1 - Fill the event queue while the run loop isn't running, as when interrupts
+    // occur while the main loop is busy. Expect every event to be queued and handled.
+    {
+        for (std::uint8_t i{}; i < Logic::EventQueueSize; ++i)
+        {
+            EXPECT_TRUE(logic.postEvent(Event::ToggleTimerTimeout));
+        }
+        EXPECT_EQ(logic.droppedEventCount(), 0U);
+
+        watchdog.stopAt(Logic::EventQueueSize);
+        logic.run(watchdog.stop());
+        EXPECT_EQ(mock.led.toggleCount(), Logic::EventQueueSize);
+    }
+
+    // Case 2 - Post bursts from the main thread, simulating interrupts, while the run loop is
+    // running in another thread. An interrupt handler can't retry, hence expect every event
+    // to be posted at the first attempt when each burst starts once the previous one has
+    // been handled, and every event to be handled.
+    {
+        constexpr std::uint32_t burstCount{200U};
+        constexpr std::uint32_t eventCount{burstCount * Logic::EventQueueSize};
+        const std::uint32_t initialToggleCount{mock.led.toggleCount()};
+        std::uint32_t postedCount{};
+        std::uint32_t lostCount{};
+
+        // Clear the stop flag of the previous case before the run loop is started.
+        watchdog.stopAt(initialToggleCount + eventCount);
+        watchdog.reset();
+        std::thread runThread{[&logic, &watchdog]() { logic.run(watchdog.stop()); }};
+
+        for (std::uint32_t burst{}; burst < burstCount; ++burst)
+        {
+            // Wait for the run loop to handle the previous burst, give up after about a second.
+            for (std::uint32_t i{}; (i < 100000U) &&
+                (postedCount > watchdog.toggleCount() - initialToggleCount); ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(10U));
+            }
+
+            for (std::uint8_t i{}; i < Logic::EventQueueSize; ++i)
+            {
+                if (logic.postEvent(Event::ToggleTimerTimeout)) { ++postedCount; }
+                else { ++lostCount; }
+            }
+        }
+
+        // Stop the run loop right away if events were lost, since the stop count is never
+        // reached then.
+        if (0U < lostCount) { watchdog.stopAt(0U); }
+        runThread.join();
+
+        EXPECT_EQ(lostCount, 0U);
+        EXPECT_EQ(logic.droppedEventCount(), 0U);
+        EXPECT_EQ(mock.led.toggleCount() - initialToggleCount, eventCount);
+    }
+}
+
+/**
+ * @brief Task registration test.
+ *
+ *        Verify that the periodic handlers can be run as tasks of a scheduler.
+ */
+TEST(Logic, Tasks)
+{
+    constexpr std::uint32_t toggleTimeout_ms{100U};
+    constexpr std::uint32_t tempTimeout_ms{1000U};
+
+    Mock mock{};
+    mock.toggleTimer.setTimeout_ms(toggleTimeout_ms);
+    mock.tempTimer.setTimeout_ms(tempTimeout_ms);
+    logic::Stub& logic{static_cast<logic::Stub&>(mock.createLogic())};
+
+    driver::clock::Stub clock{};
+    scheduler::Scheduler scheduler{clock, mock.watchdog};
+    EXPECT_TRUE(logic.registerTasks(scheduler));
+    EXPECT_FALSE(logic.registerTasks(scheduler));
+    EXPECT_EQ(scheduler.taskCount(), 2U);
+
+    // Case 1 - Let the toggle task run while the toggle timer is disabled.
+    // Expect the LED to be unaffected.
+    {
+        clock.advance_us(toggleTimeout_ms * 1000U);
+        EXPECT_TRUE(scheduler.run());
+        EXPECT_EQ(mock.led.toggleCount(), 0U);
+    }
+
+    // Case 2 - Enable the toggle timer, expect the LED to be toggled every toggle period.
+    {
+        mock.toggleTimer.start();
+        for (std::uint8_t i{1U}; i <= 5U; ++i)
+        {
+            clock.advance_us(toggleTimeout_ms * 1000U);
+            EXPECT_TRUE(scheduler.run());
+            EXPECT_EQ(mock.led.toggleCount(), i);
+        }
+    }
+
+    // Case 3 - Let the temperature period elapse, expect the temperature to be printed once
+    // and the watchdog to be reset by the scheduler.
+    {
+        const auto initialPrintCount{logic.tempPrintoutCount()};
+        const auto initialResetCount{mock.watchdog.resetCount()};
+        clock.setTime_us(tempTimeout_ms * 1000U);
+        while (scheduler.run()) {}
+        EXPECT_EQ(initialPrintCount + 1U, logic.tempPrintoutCount());
+        EXPECT_LT(initialResetCount, mock.watchdog.resetCount());
+    }
+
+    // Case 4 - Destroy the logic implementation, expect its tasks to be removed.
+    {
+        mock.logicImpl.reset();
+        EXPECT_EQ(scheduler.taskCount(), 0U);
+    }
+}
+
+/**
+ * @brief Serial command test.
+ *
+ *        Verify that the memory statistics are printed on request via the serial device.
+ */
+TEST(Logic, SerialCommands)
+{
+    Mock mock{};
+    mock.createLogic();
+
+    // Send an unknown command followed by the memory statistics command.
+    // Expect both commands to be consumed and the statistics to be printed once.
+    const std::uint8_t commands[]{'x', Logic::MemoryStatsCommand};
+    mock.serial.appendReadBuffer(commands, sizeof(commands));
+
+    testing::internal::CaptureStdout();
+    mock.runSystem();
+    const auto output{testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(mock.serial.available(), 0U);
+    EXPECT_NE(output.find("Heap: "), std::string::npos);
+    EXPECT_NE(output.find("Stack: "), std::string::npos);
+}
 } // namespace
 } // namespace logic
 
@@ -0,0 +1,192 @@
+/**
+ * @brief Unit tests for monotonic arena allocators.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/list.h"
+#include "container/vector.h"
+#include "memory/arena.h"
+#include "memory/shared_ptr.h"
+#include "memory/unique_ptr.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/** The size of the arenas under test in bytes. */
+constexpr std::size_t ArenaSize{1024U};
+
+/**
+ * @brief Element type counting its live instances.
+ */
+struct Counted
+{
+    /** The number of live instances. */
+    static int liveCount;
+
+    /** The value of the instance. */
+    int value;
+
+    // -----------------------------------------------------------------------------
+    Counted(const int val = 0) noexcept
+        : value{val} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    ~Counted() noexcept { --liveCount; }
+};
+
+int Counted::liveCount{};
+
+// -----------------------------------------------------------------------------
+void recordUsage(const Arena& arena)
+{
+    ::testing::Test::RecordProperty("bytes_used", static_cast<int>(arena.used()));
+    ::testing::Test::RecordProperty("allocation_count", static_cast<int>(arena.allocationCount()));
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Arena, AllocateReset)
+{
+    StaticArena<ArenaSize> arena{};
+    EXPECT_EQ(arena.capacity(), ArenaSize);
+    EXPECT_EQ(arena.used(), 0U);
+
+    // Allocations are aligned and placed one after another.
+    auto first{static_cast<std::uint8_t*>(arena.allocate(3U))};
+    auto second{static_cast<std::uint8_t*>(arena.allocate(8U))};
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(max_align_t), 0U);
+    EXPECT_EQ(second - first, static_cast<std::ptrdiff_t>(alignof(max_align_t)));
+    EXPECT_EQ(arena.used(), alignof(max_align_t) + 8U);
+    EXPECT_EQ(arena.allocationCount(), 2U);
+
+    // Released memory isn't reused.
+    arena.deallocate(second);
+    EXPECT_EQ(arena.used(), alignof(max_align_t) + 8U);
+
+    // Allocations fail when the arena is exhausted.
+    EXPECT_EQ(arena.allocate(ArenaSize), nullptr);
+    EXPECT_EQ(arena.failureCount(), 1U);
+    EXPECT_EQ(arena.allocationCount(), 2U);
+
+    // All memory is reclaimed at once on reset.
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0U);
+    EXPECT_EQ(arena.available(), ArenaSize);
+    EXPECT_EQ(arena.allocate(ArenaSize), first);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Arena, Reallocate)
+{
+    StaticArena<ArenaSize> arena{};
+
+    // The most recent allocation is resized in place.
+    auto block{static_cast<std::uint8_t*>(arena.reallocate(nullptr, 0U, 16U))};
+    ASSERT_NE(block, nullptr);
+    block[15U] = 42U;
+    EXPECT_EQ(arena.reallocate(block, 16U, 64U), block);
+    EXPECT_EQ(arena.used(), 64U);
+    EXPECT_EQ(arena.reallocate(block, 64U, ArenaSize + 1U), nullptr);
+
+    // Other allocations are copied to a new allocation.
+    EXPECT_NE(arena.allocate(1U), nullptr);
+    auto copy{static_cast<std::uint8_t*>(arena.reallocate(block, 16U, 128U))};
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, block);
+    EXPECT_EQ(copy[15U], 42U);
+    EXPECT_EQ(arena.allocationCount(), 3U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Arena, Containers)
+{
+    StaticArena<ArenaSize> arena{};
+
+    // Build a training set like at startup, the vectors grow in place while they are last.
+    container::Vector<double, Arena> trainIn{arena};
+    for (int i{}; i < 20; ++i) { EXPECT_TRUE(trainIn.pushBack(i * 0.1)); }
+    EXPECT_EQ(arena.allocationCount(), 1U);
+    EXPECT_EQ(arena.used(), trainIn.capacity() * sizeof(double));
+
+    container::Vector<double, Arena> trainOut{arena};
+    for (const auto& input : trainIn) { EXPECT_TRUE(trainOut.pushBack(100.0 * input - 50.0)); }
+    EXPECT_DOUBLE_EQ(trainOut[10U], 50.0);
+
+    // Nodes of lists are allocated one after another.
+    container::List<int, Arena> list{arena};
+    for (int i{}; i < 4; ++i) { EXPECT_TRUE(list.pushBack(i)); }
+    EXPECT_EQ(&list.allocator(), &arena);
+
+    // Copies allocate from the same arena.
+    const container::Vector<double, Arena> copy{trainIn};
+    EXPECT_EQ(&copy.allocator(), &arena);
+    EXPECT_DOUBLE_EQ(copy[19U], trainIn[19U]);
+    EXPECT_EQ(arena.failureCount(), 0U);
+    recordUsage(arena);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Arena, SmartPointers)
+{
+    StaticArena<ArenaSize> arena{};
+    Counted::liveCount = 0;
+    {
+        auto unique{allocateUnique<Counted>(arena, 1)};
+        ASSERT_TRUE(unique);
+        EXPECT_EQ(unique->value, 1);
+        EXPECT_EQ(&unique.allocator(), &arena);
+
+        // The data and the control block are allocated at once from the same arena.
+        auto shared{allocateShared<Counted>(arena, 2)};
+        ASSERT_TRUE(shared);
+        EXPECT_EQ(arena.allocationCount(), 2U);
+        {
+            const auto copy{shared};
+            EXPECT_EQ(shared.useCount(), 2U);
+        }
+        EXPECT_EQ(shared.useCount(), 1U);
+        EXPECT_EQ(Counted::liveCount, 2);
+        recordUsage(arena);
+    }
+    // The objects are destroyed, but the memory is only reclaimed on reset.
+    EXPECT_EQ(Counted::liveCount, 0);
+    EXPECT_GT(arena.used(), 0U);
+
+    // The pointers are empty when the arena is exhausted. The shared pointer needs room for
+    // the control block as well, so the arena can still hold the unique pointer afterwards.
+    StaticArena<sizeof(Counted)> tiny{};
+    auto shared{allocateShared<Counted>(tiny, 3)};
+    EXPECT_FALSE(shared);
+    EXPECT_EQ(Counted::liveCount, 0);
+    EXPECT_TRUE(allocateUnique<Counted>(tiny, 4));
+    EXPECT_FALSE(allocateUnique<Counted>(tiny, 5));
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_SmartPointers, HeapAllocator)
+{
+    Counted::liveCount = 0;
+    {
+        // Pointers using the heap by default destroy their data when released.
+        auto unique{makeUnique<Counted>(1)};
+        auto shared{makeShared<Counted>(2)};
+        auto other{shared};
+        EXPECT_EQ(Counted::liveCount, 2);
+        unique.reset();
+        shared.reset();
+        EXPECT_EQ(Counted::liveCount, 1);
+        EXPECT_EQ(other->value, 2);
+    }
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
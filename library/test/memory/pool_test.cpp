@@ -0,0 +1,124 @@
+/**
+ * @brief Unit tests for fixed-block memory pools.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/pool.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/** The number of blocks of the pools under test. */
+constexpr std::size_t BlockCount{4U};
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Pool, AllocateRelease)
+{
+    StaticPool<24U, BlockCount> pool{};
+    EXPECT_EQ(pool.blockCount(), BlockCount);
+    EXPECT_GE(pool.blockSize(), 24U);
+    EXPECT_EQ(pool.blockSize() % alignof(max_align_t), 0U);
+
+    // Allocate all blocks, each block is aligned and separate from the others.
+    void* blocks[BlockCount]{};
+    for (auto& block : blocks)
+    {
+        block = pool.allocate(24U);
+        ASSERT_NE(block, nullptr);
+        EXPECT_TRUE(pool.owns(block));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(max_align_t), 0U);
+    }
+    for (std::size_t i{1U}; i < BlockCount; ++i)
+    {
+        const auto distance{static_cast<std::uint8_t*>(blocks[i])
+                            - static_cast<std::uint8_t*>(blocks[i - 1U])};
+        EXPECT_GE(distance, static_cast<std::ptrdiff_t>(pool.blockSize()));
+    }
+    EXPECT_TRUE(pool.full());
+    EXPECT_EQ(pool.allocate(1U), nullptr);
+
+    // The most recently released block is reused first.
+    pool.deallocate(blocks[1U]);
+    pool.deallocate(blocks[2U]);
+    EXPECT_EQ(pool.usedCount(), 2U);
+    EXPECT_EQ(pool.allocate(8U), blocks[2U]);
+    EXPECT_EQ(pool.allocate(8U), blocks[1U]);
+    EXPECT_EQ(pool.peakUsedCount(), BlockCount);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Pool, InvalidRequests)
+{
+    StaticPool<16U, BlockCount> pool{};
+
+    // Blocks larger than the block size can't be allocated.
+    EXPECT_EQ(pool.allocate(pool.blockSize() + 1U), nullptr);
+    EXPECT_EQ(pool.usedCount(), 0U);
+
+    // Memory not belonging to the pool is ignored when released.
+    int value{};
+    pool.deallocate(&value);
+    pool.deallocate(nullptr);
+    EXPECT_FALSE(pool.owns(&value));
+    EXPECT_EQ(pool.usedCount(), 0U);
+
+    // Pointers into the middle of a block and blocks never handed out are ignored.
+    auto block{static_cast<std::uint8_t*>(pool.allocate(16U))};
+    ASSERT_NE(block, nullptr);
+    pool.deallocate(block + 1U);
+    pool.deallocate(block + pool.blockSize());
+    EXPECT_EQ(pool.usedCount(), 1U);
+    EXPECT_EQ(pool.allocate(16U), block + pool.blockSize());
+
+    // Double frees are ignored while other blocks are in use, so the block is only handed out
+    // once afterwards.
+    pool.deallocate(block);
+    pool.deallocate(block);
+    EXPECT_EQ(pool.usedCount(), 1U);
+    EXPECT_EQ(pool.allocate(16U), block);
+    EXPECT_EQ(pool.allocate(16U), block + 2U * pool.blockSize());
+    EXPECT_EQ(pool.usedCount(), 3U);
+
+    // Double frees don't make the used count wrap around.
+    pool.deallocate(block + 2U * pool.blockSize());
+    pool.deallocate(block + pool.blockSize());
+    pool.deallocate(block);
+    pool.deallocate(block);
+    EXPECT_EQ(pool.usedCount(), 0U);
+    EXPECT_EQ(pool.allocate(16U), block);
+    EXPECT_EQ(pool.allocate(16U), block + pool.blockSize());
+    EXPECT_EQ(pool.allocate(16U), block + 2U * pool.blockSize());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Pool, ExternalBuffer)
+{
+    // Use an unaligned buffer, the bytes before the first aligned address are skipped. One more
+    // byte is needed after the blocks to track the blocks in use.
+    constexpr std::size_t blockSize{Pool::alignedBlockSize(8U)};
+    alignas(max_align_t) std::uint8_t buffer[blockSize * BlockCount + 1U]{};
+    Pool pool{buffer + 1U, sizeof(buffer) - 1U, 8U};
+    EXPECT_EQ(pool.blockCount(), BlockCount - 1U);
+    Pool exact{buffer, blockSize * BlockCount + Pool::flagsSize(BlockCount), 8U};
+    EXPECT_EQ(exact.blockCount(), BlockCount);
+    Pool tooSmall{buffer, blockSize * BlockCount, 8U};
+    EXPECT_EQ(tooSmall.blockCount(), BlockCount - 1U);
+
+    void* block{pool.allocate(8U)};
+    EXPECT_EQ(block, buffer + alignof(max_align_t));
+
+    // Empty buffers result in empty pools.
+    Pool empty{nullptr, sizeof(buffer), 8U};
+    EXPECT_EQ(empty.blockCount(), 0U);
+    EXPECT_EQ(empty.allocate(1U), nullptr);
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,223 @@
+/**
+ * @brief Unit tests for shared and weak pointers.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "memory/heap_allocator.h"
+#include "memory/shared_ptr.h"
+#include "memory/weak_ptr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Heap allocator counting its allocations, which can be set to fail.
+ */
+class CountingAllocator final : public Allocator
+{
+public:
+    // -----------------------------------------------------------------------------
+    CountingAllocator() noexcept
+        : myHeap{}
+        , myAllocationCount{0U}
+        , myLiveCount{0U}
+        , myFail{false} {}
+
+    // -----------------------------------------------------------------------------
+    void* allocate(const std::size_t size) noexcept override
+    {
+        if (myFail) { return nullptr; }
+        ++myAllocationCount;
+        ++myLiveCount;
+        return myHeap.allocate(size);
+    }
+
+    // -----------------------------------------------------------------------------
+    void deallocate(void* block) noexcept override
+    {
+        if (block) { --myLiveCount; }
+        myHeap.deallocate(block);
+    }
+
+    // -----------------------------------------------------------------------------
+    std::size_t allocationCount() const noexcept { return myAllocationCount; }
+
+    // -----------------------------------------------------------------------------
+    std::size_t liveCount() const noexcept { return myLiveCount; }
+
+    // -----------------------------------------------------------------------------
+    void setFail(const bool fail) noexcept { myFail = fail; }
+
+private:
+    /** The heap providing the memory. */
+    HeapAllocator myHeap;
+
+    /** The number of allocations. */
+    std::size_t myAllocationCount;
+
+    /** The number of blocks not yet released. */
+    std::size_t myLiveCount;
+
+    /** Indicate whether allocations fail. */
+    bool myFail;
+};
+
+/**
+ * @brief Element type counting its live instances.
+ */
+struct Counted
+{
+    /** The number of live instances. */
+    static int liveCount;
+
+    /** The value of the instance. */
+    int value;
+
+    // -----------------------------------------------------------------------------
+    Counted(const int val = 0) noexcept
+        : value{val} { ++liveCount; }
+
+    // -----------------------------------------------------------------------------
+    ~Counted() noexcept { --liveCount; }
+};
+
+int Counted::liveCount{0};
+
+// -----------------------------------------------------------------------------
+TEST(Memory_SharedPtr, SingleAllocation)
+{
+    CountingAllocator allocator{};
+    Counted::liveCount = 0;
+    {
+        // The object and the control block are allocated at once.
+        auto shared{allocateShared<Counted>(allocator, 1)};
+        ASSERT_TRUE(shared);
+        EXPECT_EQ(shared->value, 1);
+        EXPECT_EQ(allocator.allocationCount(), 1U);
+
+        // Copies share the control block, so no allocations are made.
+        auto copy{shared};
+        EXPECT_EQ(shared.useCount(), 2U);
+        EXPECT_EQ(allocator.allocationCount(), 1U);
+
+        // Pointers created from raw pointers allocate the control block separately.
+        SharedPtr<Counted, CountingAllocator> separate{
+            utils::construct(static_cast<Counted*>(allocator.allocate(sizeof(Counted))), 2),
+            allocator};
+        ASSERT_TRUE(separate);
+        EXPECT_EQ(allocator.allocationCount(), 3U);
+        EXPECT_EQ(Counted::liveCount, 2);
+    }
+    EXPECT_EQ(Counted::liveCount, 0);
+    EXPECT_EQ(allocator.liveCount(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_SharedPtr, CustomDeleter)
+{
+    int deleteCount{0};
+    int value{5};
+    {
+        // Data not allocated by the pointer can be deleted by a custom deleter.
+        auto deleter{[&deleteCount](int*) noexcept { ++deleteCount; }};
+        SharedPtr<int> shared{&value, deleter};
+        ASSERT_TRUE(shared);
+        const auto copy{shared};
+        EXPECT_EQ(*copy, 5);
+        shared.reset();
+        EXPECT_EQ(deleteCount, 0);
+    }
+    EXPECT_EQ(deleteCount, 1);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_SharedPtr, AllocationFailure)
+{
+    CountingAllocator allocator{};
+    allocator.setFail(true);
+    EXPECT_FALSE(allocateShared<Counted>(allocator, 1));
+
+    // The data is deleted if the control block can't be allocated.
+    int deleteCount{0};
+    int value{5};
+    auto deleter{[&deleteCount](int*) noexcept { ++deleteCount; }};
+    SharedPtr<int, CountingAllocator> shared{&value, deleter, allocator};
+    EXPECT_FALSE(shared);
+    EXPECT_EQ(shared.useCount(), 0U);
+    EXPECT_EQ(deleteCount, 1);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_WeakPtr, ExpireAndLock)
+{
+    CountingAllocator allocator{};
+    Counted::liveCount = 0;
+    WeakPtr<Counted, CountingAllocator> weak{};
+    EXPECT_TRUE(weak.expired());
+    EXPECT_FALSE(weak.lock());
+    {
+        auto shared{allocateShared<Counted>(allocator, 3)};
+        weak = WeakPtr<Counted, CountingAllocator>{shared};
+        EXPECT_FALSE(weak.expired());
+        EXPECT_EQ(weak.useCount(), 1U);
+
+        // Locking the weak pointer shares the ownership of the data.
+        auto locked{weak.lock()};
+        ASSERT_TRUE(locked);
+        EXPECT_EQ(locked->value, 3);
+        EXPECT_EQ(shared.useCount(), 2U);
+    }
+    // The data is destroyed with the last owner, but the block is kept for the weak pointer.
+    EXPECT_EQ(Counted::liveCount, 0);
+    EXPECT_TRUE(weak.expired());
+    EXPECT_FALSE(weak.lock());
+    EXPECT_EQ(allocator.liveCount(), 1U);
+
+    // The block is released with the last observer.
+    weak.reset();
+    EXPECT_EQ(allocator.liveCount(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_SharedPtr, GuardedRefCount)
+{
+    Counted::liveCount = 0;
+    utils::set(SREG, I_FLAG);
+    {
+        auto shared{makeShared<Counted, refcount::Guarded>(4)};
+        ASSERT_TRUE(shared);
+        {
+            const auto copy{shared};
+            EXPECT_EQ(shared.useCount(), 2U);
+            const WeakPtr<Counted, HeapAllocator, refcount::Guarded> weak{copy};
+            EXPECT_EQ(weak.lock()->value, 4);
+        }
+        EXPECT_EQ(shared.useCount(), 1U);
+
+        // Interrupts are enabled again once the counts have been updated.
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    }
+    EXPECT_EQ(Counted::liveCount, 0);
+
+    // Interrupts stay disabled if they were disabled before, e.g. in an interrupt routine.
+    utils::clear(SREG, I_FLAG);
+    {
+        auto shared{makeShared<Counted, refcount::Guarded>(5)};
+        const auto copy{shared};
+        EXPECT_EQ(copy.useCount(), 2U);
+    }
+    EXPECT_FALSE(utils::read(SREG, I_FLAG));
+    EXPECT_EQ(Counted::liveCount, 0);
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,197 @@
+/**
+ * @brief Unit tests for the heap and stack instrumentation.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/ring_buffer.h"
+#include "container/static_vector.h"
+#include "container/vector.h"
+#include "memory/shared_ptr.h"
+#include "memory/stats.h"
+#include "memory/weak_ptr.h"
+#include "utils/format.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace stats
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+TEST(Memory_Stats, HeapCounters)
+{
+    // The heap usage is only tracked by the test build with MEMORY_STATS defined.
+    if (!enabled()) { GTEST_SKIP() << "MEMORY_STATS isn't defined"; }
+    resetHeap();
+    const auto start{heap()};
+    EXPECT_EQ(start.allocationCount, 0U);
+    EXPECT_EQ(start.peakBytes, start.liveBytes);
+
+    // Expect allocations to add to the live usage and the peak to follow.
+    auto block{utils::newMemory<std::uint32_t>(4U)};
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(heap().liveBytes, start.liveBytes + 16U);
+    EXPECT_EQ(heap().allocationCount, 1U);
+
+    // Expect reallocations to replace the size of the block.
+    block = utils::reallocMemory(block, 8U);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(heap().liveBytes, start.liveBytes + 32U);
+    block = utils::reallocMemory(block, 2U);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(heap().liveBytes, start.liveBytes + 8U);
+    EXPECT_EQ(heap().allocationCount, 3U);
+
+    // Expect the peak to be kept once the memory is released.
+    utils::deleteMemory(block);
+    EXPECT_EQ(block, nullptr);
+    EXPECT_EQ(heap().liveBytes, start.liveBytes);
+    EXPECT_EQ(heap().peakBytes, start.liveBytes + 32U);
+    EXPECT_EQ(heap().failureCount, 0U);
+
+    // Expect failed allocations to be counted without affecting the usage.
+    EXPECT_EQ(utils::newMemory<std::uint8_t>(SIZE_MAX), nullptr);
+    EXPECT_EQ(heap().failureCount, 1U);
+    EXPECT_EQ(heap().liveBytes, start.liveBytes);
+
+    resetHeap();
+    EXPECT_EQ(heap().peakBytes, start.liveBytes);
+    EXPECT_EQ(heap().failureCount, 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Stats, ContainerUsage)
+{
+    if (!enabled()) { GTEST_SKIP() << "MEMORY_STATS isn't defined"; }
+
+    resetHeap();
+    const auto start{heap()};
+    {
+        container::Vector<std::uint16_t> vector{};
+        EXPECT_TRUE(vector.reserve(10U));
+        EXPECT_EQ(heap().liveBytes, start.liveBytes + 20U);
+
+        // The object and the control block of shared pointers are allocated at once.
+        auto shared{makeShared<std::uint32_t>(1U)};
+        EXPECT_EQ(heap().allocationCount, 2U);
+        EXPECT_GT(heap().liveBytes, start.liveBytes + 20U + sizeof(std::uint32_t));
+    }
+    EXPECT_EQ(heap().liveBytes, start.liveBytes);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Stats, ZeroAllocations)
+{
+    container::Vector<std::uint16_t> vector{};
+    ASSERT_TRUE(vector.reserve(16U));
+    auto shared{makeShared<std::uint32_t>(1U)};
+    resetHeap();
+
+    // Expect the following code paths to run without heap memory.
+    {
+        container::RingBuffer<std::uint16_t, 8U> ringBuffer{};
+        container::StaticVector<std::uint16_t, 8U> staticVector{};
+        std::uint16_t value{};
+
+        for (std::uint16_t i{}; i < 8U; ++i)
+        {
+            ringBuffer.push(i);
+            ringBuffer.pop(value);
+            staticVector.pushBack(i);
+
+            // Pushing values within the reserved capacity doesn't reallocate.
+            vector.pushBack(i);
+        }
+
+        // Copying shared pointers and locking weak pointers only updates the counts.
+        const auto copy{shared};
+        const WeakPtr<std::uint32_t> weak{copy};
+        EXPECT_EQ(*weak.lock(), 1U);
+
+        std::size_t length{};
+        auto sink{[&length](const char*, const std::uint16_t size) { length += size; }};
+        utils::format(sink, "Temperature: %d Celsius, %.2f V\n", 25, 0.75);
+        EXPECT_GT(length, 0U);
+    }
+    EXPECT_EQ(heap().allocationCount, 0U);
+    EXPECT_EQ(heap().failureCount, 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Stats, UntrackedHeap)
+{
+    // Without MEMORY_STATS the heap functions call malloc, realloc and free directly.
+    if (enabled()) { GTEST_SKIP() << "MEMORY_STATS is defined"; }
+
+    auto block{utils::newMemory<std::uint32_t>(4U)};
+    ASSERT_NE(block, nullptr);
+    for (std::uint32_t i{}; i < 4U; ++i) { block[i] = i; }
+
+    // Expect reallocations to keep the contents.
+    block = utils::reallocMemory(block, 64U);
+    ASSERT_NE(block, nullptr);
+    for (std::uint32_t i{}; i < 4U; ++i) { EXPECT_EQ(block[i], i); }
+    block = utils::reallocMemory(block, 2U);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block[1U], 1U);
+
+    utils::deleteMemory(block);
+    EXPECT_EQ(block, nullptr);
+    EXPECT_EQ(utils::newMemory<std::uint8_t>(SIZE_MAX), nullptr);
+
+    // Expect the counters to stay at 0.
+    EXPECT_EQ(heap().liveBytes, 0U);
+    EXPECT_EQ(heap().peakBytes, 0U);
+    EXPECT_EQ(heap().allocationCount, 0U);
+    EXPECT_EQ(heap().failureCount, 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Memory_Stats, StackHighWaterMark)
+{
+    std::uint8_t stack[64U]{};
+    std::uint8_t* const end{stack + sizeof(stack)};
+
+    // Expect no usage once the region has been painted.
+    paintStack(stack, end);
+    EXPECT_EQ(stackHighWaterMark(stack, end), 0U);
+
+    // Simulate stack usage growing downwards from the end of the region.
+    end[-1] = 0U;
+    end[-2] = 0U;
+    EXPECT_EQ(stackHighWaterMark(stack, end), 2U);
+
+    // Expect the deepest usage to be kept, even if a painted byte value was pushed on top.
+    stack[40U] = 0U;
+    stack[41U] = StackPaint;
+    EXPECT_EQ(stackHighWaterMark(stack, end), 24U);
+
+    // Expect the whole region to be reported when the stack has overflowed it.
+    stack[0U] = 0U;
+    EXPECT_EQ(stackHighWaterMark(stack, end), sizeof(stack));
+
+    // Expect heap memory allocated at the start of the region not to be reported.
+    paintStack(stack, end);
+    end[-1]   = 0U;
+    stack[0U] = 0U;
+    stack[7U] = 0U;
+    EXPECT_EQ(stackHighWaterMark(stack, end, stack + 8U), 1U);
+
+    // Expect the end of the heap to be ignored when it's outside the region.
+    EXPECT_EQ(stackHighWaterMark(stack, end, end + 1U), sizeof(stack));
+
+    // The platform stack isn't painted on the host.
+    paintStack();
+    EXPECT_EQ(stackHighWaterMark(), 0U);
+}
+} // namespace
+} // namespace stats
+} // namespace memory
+
+#endif /** TESTSUITE */
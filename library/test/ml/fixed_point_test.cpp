@@ -0,0 +1,85 @@
+/**
+ * @brief Unit tests for fixed-point numbers.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/fixed_point.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Q16.16 number rounding down instead of to nearest. */
+using Q16_16Down = FixedPoint<16U, Rounding::Down>;
+
+/** Q16.16 number wrapping around on overflow. */
+using Q16_16Wrap = FixedPoint<16U, Rounding::Nearest, Overflow::Wrap>;
+
+// -----------------------------------------------------------------------------
+TEST(Ml_FixedPoint, Conversion)
+{
+    // Values are evaluated at compile time when possible.
+    static_assert(Q16_16::fromInt(3).raw() == 3 * 65536, "Invalid conversion!");
+    static_assert(Q16_16::fromDouble(0.5).raw() == 32768, "Invalid conversion!");
+
+    EXPECT_EQ(Q16_16::fromInt(-2).toInt(), -2);
+    EXPECT_DOUBLE_EQ(Q16_16::fromDouble(-1.25).toDouble(), -1.25);
+    EXPECT_DOUBLE_EQ(FixedPoint<8U>::fromDouble(1.5).toDouble(), 1.5);
+
+    // Expect values between two representable numbers to be rounded by the rounding mode.
+    constexpr double between{2.5 / 65536.0};
+    EXPECT_EQ(Q16_16::fromDouble(between).raw(), 3);
+    EXPECT_EQ(Q16_16Down::fromDouble(between).raw(), 2);
+    EXPECT_EQ(Q16_16::fromDouble(-between).raw(), -2);
+    EXPECT_EQ(Q16_16Down::fromDouble(-between).raw(), -3);
+
+    // Expect integer conversions to round as well.
+    EXPECT_EQ(Q16_16::fromDouble(2.5).toInt(), 3);
+    EXPECT_EQ(Q16_16Down::fromDouble(2.5).toInt(), 2);
+    EXPECT_EQ(Q16_16Down::fromDouble(-2.5).toInt(), -3);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Ml_FixedPoint, Arithmetic)
+{
+    const auto a{Q16_16::fromDouble(1.5)};
+    const auto b{Q16_16::fromDouble(-0.25)};
+
+    EXPECT_DOUBLE_EQ((a + b).toDouble(), 1.25);
+    EXPECT_DOUBLE_EQ((a - b).toDouble(), 1.75);
+    EXPECT_DOUBLE_EQ((a * b).toDouble(), -0.375);
+    EXPECT_DOUBLE_EQ((-a).toDouble(), -1.5);
+    EXPECT_TRUE(b < a);
+    EXPECT_NE(a, b);
+
+    // Expect products below the resolution to be rounded by the rounding mode.
+    const auto tiny{Q16_16::fromRaw(1)};
+    EXPECT_EQ((tiny * Q16_16::fromDouble(0.5)).raw(), 1);
+    EXPECT_EQ((Q16_16Down::fromRaw(1) * Q16_16Down::fromDouble(0.5)).raw(), 0);
+    EXPECT_EQ((Q16_16Down::fromRaw(-1) * Q16_16Down::fromDouble(0.5)).raw(), -1);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Ml_FixedPoint, Overflow)
+{
+    // Expect results out of range to saturate by default.
+    const auto big{Q16_16::fromInt(30000)};
+    EXPECT_EQ(big + big, Q16_16::max());
+    EXPECT_EQ(-big - big, Q16_16::min());
+    EXPECT_EQ(big * Q16_16::fromInt(-2), Q16_16::min());
+    EXPECT_EQ(Q16_16::fromDouble(1.0e6), Q16_16::max());
+    EXPECT_EQ(Q16_16::fromDouble(-1.0e30), Q16_16::min());
+    EXPECT_EQ(Q16_16::fromInt(40000), Q16_16::max());
+
+    // Expect results out of range to wrap around if saturation is disabled.
+    const auto wrapped{Q16_16Wrap::fromInt(30000) + Q16_16Wrap::fromInt(30000)};
+    EXPECT_EQ(wrapped.toInt(), 60000 - 65536);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,118 @@
+/**
+ * @brief Unit tests for the linear regression model trained at compile time.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/stub.h"
+#include "driver/tempsensor/smart.h"
+#include "ml/lin_reg/constant.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Training data input values, the temperature dataset of the application. */
+constexpr double TrainIn[]{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                           0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+
+/** Training data output values, T = 100 * Uin - 50 (the surplus value is ignored). */
+constexpr double TrainOut[]{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+                            30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
+
+/** Noisy training data output values. */
+constexpr double NoisyOut[]{-49.0, -41.5, -29.0, -20.5, -9.0, 0.5, 9.0, 21.0, 
+                            29.5, 40.5, 49.0, 61.0, 69.5, 80.5, 89.0};
+
+/** Coefficients fitted at compile time. */
+constexpr lin_reg::Line TempLine{lin_reg::fitLine(TrainIn, TrainOut)};
+
+/** Coefficients of noisy data fitted at compile time. */
+constexpr lin_reg::Line NoisyLine{lin_reg::fitLine(TrainIn, NoisyOut)};
+
+// -----------------------------------------------------------------------------
+constexpr bool isNear(const double value, const double expected, const double tolerance) noexcept
+{
+    return (value - expected <= tolerance) && (expected - value <= tolerance);
+}
+
+// Pin the coefficients, the build fails if the compile-time fit changes.
+static_assert(TempLine.valid, "Expected the temperature data to be fitted!");
+static_assert(isNear(TempLine.weight, 100.0, 1e-9), "Unexpected weight!");
+static_assert(isNear(TempLine.bias, -50.0, 1e-9), "Unexpected bias!");
+static_assert(isNear(lin_reg::Constant<TempLine>::evaluate(0.75), 25.0, 1e-9), 
+              "Unexpected prediction!");
+
+// Expect degenerate data not to be fitted.
+constexpr double SameIn[]{0.5, 0.5, 0.5};
+constexpr double SingleIn[]{0.5};
+static_assert(!lin_reg::fitLine(SameIn, TrainOut).valid, "Expected constant inputs to fail!");
+static_assert(!lin_reg::fitLine(SingleIn, TrainOut).valid, "Expected a single input to fail!");
+
+/**
+ * @brief Runtime fit test.
+ *
+ *        Verify that the compile-time fit matches the least-squares fit at runtime.
+ */
+TEST(LinRegConstant, RuntimeFit)
+{
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                           0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+    const Matrix2d noisyOut{-49.0, -41.5, -29.0, -20.5, -9.0, 0.5, 9.0, 21.0, 
+                            29.5, 40.5, 49.0, 61.0, 69.5, 80.5, 89.0};
+    lin_reg::Fit fit{};
+    ASSERT_TRUE(lin_reg::leastSquares(trainIn, noisyOut, fit));
+
+    // Expect the exact same computation, hence the exact same coefficients.
+    EXPECT_TRUE(NoisyLine.valid);
+    EXPECT_EQ(NoisyLine.weight, fit.weight);
+    EXPECT_EQ(NoisyLine.bias, fit.bias);
+}
+
+/**
+ * @brief Prediction test.
+ *
+ *        Verify that the model predicts via the interface without training.
+ */
+TEST(LinRegConstant, Predict)
+{
+    const lin_reg::Constant<TempLine> model{};
+    const lin_reg::Interface& linReg{model};
+    EXPECT_TRUE(linReg.isTrained());
+
+    for (double input{0.0}; input <= 1.5; input += 0.05)
+    {
+        EXPECT_NEAR(linReg.predict(input), 100.0 * input - 50.0, 1e-9);
+        EXPECT_EQ(linReg.predict(input), lin_reg::Constant<TempLine>::evaluate(input));
+    }
+}
+
+/**
+ * @brief Smart temperature sensor test.
+ *
+ *        Verify that the smart temperature sensor reads temperatures with the model.
+ */
+TEST(LinRegConstant, SmartTempSensor)
+{
+    constexpr std::uint8_t pin{0U};
+    driver::adc::Stub adc{};
+    adc.setInitialized(true);
+    adc.setChannelValidity(true);
+
+    const lin_reg::Constant<TempLine> model{};
+    driver::tempsensor::Smart tempSensor{pin, adc, model};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Expect 0.75 V, i.e. ADC value 153 of 1023 at 5 V, to read as 25 degrees Celsius.
+    adc.setValue(153U);
+    EXPECT_EQ(tempSensor.read(), 25);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,123 @@
+/**
+ * @brief Unit tests for closed-form least-squares fitting.
+ */
+#include <cmath>
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/**
+ * @brief Exact fit test.
+ *
+ *        Verify that data on a straight line is fitted exactly in a single pass.
+ */
+TEST(LinRegLeastSquares, ExactFit)
+{
+    // Fit the temperature dataset of the application, T = 100 * Uin - 50.
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3};
+    const Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0,
+                            20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0};
+    lin_reg::Fit fit{};
+    ASSERT_TRUE(lin_reg::leastSquares(trainIn, trainOut, fit));
+
+    EXPECT_NEAR(fit.weight, 100.0, 1e-9);
+    EXPECT_NEAR(fit.bias, -50.0, 1e-9);
+    EXPECT_NEAR(fit.rSquared, 1.0, 1e-12);
+    EXPECT_NEAR(fit.residualMse, 0.0, 1e-12);
+    EXPECT_EQ(fit.count, trainIn.size());
+
+    // Expect the models to predict the line after fitting.
+    lin_reg::Fixed linReg{};
+    lin_reg::Quantized<> quantized{};
+    EXPECT_TRUE(linReg.fit(trainIn, trainOut));
+    EXPECT_TRUE(quantized.fit(trainIn, trainOut));
+    EXPECT_TRUE(linReg.isTrained());
+    EXPECT_TRUE(quantized.isTrained());
+
+    for (double input{0.0}; input <= 1.5; input += 0.05)
+    {
+        EXPECT_NEAR(linReg.predict(input), 100.0 * input - 50.0, 1e-9);
+        EXPECT_NEAR(quantized.predict(input), 100.0 * input - 50.0, 1e-2);
+    }
+}
+
+/**
+ * @brief Residual statistics test.
+ *
+ *        Verify that the statistics of a noisy fit match a two-pass calculation.
+ */
+TEST(LinRegLeastSquares, ResidualStatistics)
+{
+    // Offset the inputs to check that the single-pass sums don't lose precision.
+    const Matrix1d trainIn{1000.0, 1001.0, 1002.0, 1003.0, 1004.0, 1005.0};
+    const Matrix2d trainOut{2.1, 3.9, 6.2, 7.8, 10.1, 12.0};
+    lin_reg::Fit fit{};
+    lin_reg::Fixed linReg{};
+    ASSERT_TRUE(linReg.fit(trainIn, trainOut, &fit));
+
+    // Calculate the reference statistics in two passes.
+    double meanOut{};
+    for (const auto output : trainOut) { meanOut += output / trainOut.size(); }
+    double residualSum{};
+    double totalSum{};
+
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        const double residual{trainOut[i] - linReg.predict(trainIn[i])};
+        residualSum += residual * residual;
+        totalSum    += (trainOut[i] - meanOut) * (trainOut[i] - meanOut);
+    }
+    EXPECT_NEAR(fit.weight, 1.9914286, 1e-6);
+    EXPECT_NEAR(fit.rSquared, 1.0 - residualSum / totalSum, 1e-9);
+    EXPECT_NEAR(fit.residualMse, residualSum / trainIn.size(), 1e-9);
+    EXPECT_NEAR(fit.residualStdError, std::sqrt(residualSum / (trainIn.size() - 2U)), 1e-9);
+    EXPECT_LT(fit.rSquared, 1.0);
+    EXPECT_GT(fit.rSquared, 0.99);
+}
+
+/**
+ * @brief Degenerate data test.
+ *
+ *        Verify that no line is fitted unless the data holds two distinct inputs.
+ */
+TEST(LinRegLeastSquares, DegenerateData)
+{
+    lin_reg::Fit fit{};
+    EXPECT_FALSE(lin_reg::leastSquares(Matrix1d{}, Matrix2d{}, fit));
+    EXPECT_FALSE(lin_reg::leastSquares(Matrix1d{1.0}, Matrix2d{2.0}, fit));
+    EXPECT_FALSE(lin_reg::leastSquares(Matrix1d{1.0, 1.0, 1.0}, Matrix2d{2.0, 3.0, 4.0}, fit));
+
+    lin_reg::Fixed linReg{};
+    EXPECT_FALSE(linReg.fit(Matrix1d{1.0, 2.0}, Matrix2d{}));
+    EXPECT_FALSE(linReg.isTrained());
+
+    // Expect the accumulator to be reusable once reset.
+    lin_reg::LeastSquares accumulator{};
+    accumulator.add(1.0, 1.0);
+    accumulator.add(2.0, 5.0);
+    EXPECT_EQ(accumulator.count(), 2U);
+    accumulator.reset();
+    EXPECT_EQ(accumulator.count(), 0U);
+    EXPECT_FALSE(accumulator.solve(fit));
+    accumulator.add(0.0, 1.0);
+    accumulator.add(1.0, 3.0);
+    ASSERT_TRUE(accumulator.solve(fit));
+    EXPECT_DOUBLE_EQ(fit.weight, 2.0);
+    EXPECT_DOUBLE_EQ(fit.bias, 1.0);
+    EXPECT_DOUBLE_EQ(fit.residualStdError, 0.0);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,177 @@
+/**
+ * @brief Unit tests for the linear regression implementation with several inputs.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/stub.h"
+#include "driver/tempsensor/smart.h"
+#include "ml/lin_reg/multivariate.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** The number of training samples. */
+constexpr std::size_t SetCount{40U};
+
+// -----------------------------------------------------------------------------
+constexpr double compensatedTemp(const double sensorVoltage, const double supplyVoltage, 
+                                 const double boardTemp) noexcept
+{
+    // Temperature based on the sensor voltage, compensated for supply and board temperature.
+    return 100.0 * sensorVoltage - 2.0 * supplyVoltage + 0.5 * boardTemp - 40.0;
+}
+
+/**
+ * @brief Structure holding training data with three inputs.
+ */
+struct TrainingData
+{
+    double sensorVoltage[SetCount];
+    double supplyVoltage[SetCount];
+    double boardTemp[SetCount];
+    double temp[SetCount];
+
+    TrainingData() noexcept
+        : sensorVoltage{}
+        , supplyVoltage{}
+        , boardTemp{}
+        , temp{}
+    {
+        // Vary the inputs independently with co-prime periods.
+        for (std::size_t i{}; i < SetCount; ++i)
+        {
+            sensorVoltage[i] = (i % 15U) * 0.1;
+            supplyVoltage[i] = 4.5 + (i % 7U) * 0.15;
+            boardTemp[i]     = 15.0 + (i % 4U) * 5.0;
+            temp[i]          = compensatedTemp(sensorVoltage[i], supplyVoltage[i], boardTemp[i]);
+        }
+    }
+};
+
+/**
+ * @brief Fit test.
+ *
+ *        Verify that data on a plane is fitted exactly, and that the batch predictions match
+ *        the single predictions.
+ */
+TEST(LinRegMultivariate, Fit)
+{
+    const TrainingData data{};
+    const double* const trainIn[]{data.sensorVoltage, data.supplyVoltage, data.boardTemp};
+    lin_reg::Multivariate<3U> linReg{};
+    EXPECT_FALSE(linReg.isTrained());
+
+    ASSERT_TRUE(linReg.fit(trainIn, data.temp, SetCount));
+    EXPECT_TRUE(linReg.isTrained());
+    EXPECT_NEAR(linReg.weights()[0U], 100.0, 1e-6);
+    EXPECT_NEAR(linReg.weights()[1U], -2.0, 1e-6);
+    EXPECT_NEAR(linReg.weights()[2U], 0.5, 1e-6);
+    EXPECT_NEAR(linReg.bias(), -40.0, 1e-6);
+
+    double outputs[SetCount]{};
+    linReg.predict(trainIn, outputs, SetCount);
+
+    for (std::size_t i{}; i < SetCount; ++i)
+    {
+        lin_reg::Multivariate<3U>::Inputs inputs{};
+        inputs[0U] = data.sensorVoltage[i];
+        inputs[1U] = data.supplyVoltage[i];
+        inputs[2U] = data.boardTemp[i];
+        EXPECT_NEAR(linReg.predict(inputs), data.temp[i], 1e-6);
+        EXPECT_NEAR(outputs[i], linReg.predict(inputs), 1e-9);
+    }
+
+    // Expect an empty batch to be ignored.
+    linReg.predict(trainIn, nullptr, 0U);
+}
+
+/**
+ * @brief Degenerate data test.
+ *
+ *        Verify that data not determining the model is rejected, leaving the model unchanged.
+ */
+TEST(LinRegMultivariate, DegenerateData)
+{
+    const TrainingData data{};
+    const double constant[SetCount]{};
+    lin_reg::Multivariate<3U> linReg{};
+
+    // Expect too few samples to fail.
+    const double* const trainIn[]{data.sensorVoltage, data.supplyVoltage, data.boardTemp};
+    EXPECT_FALSE(linReg.fit(trainIn, data.temp, 3U));
+
+    // Expect a constant input or duplicate inputs to fail.
+    const double* const constantIn[]{data.sensorVoltage, constant, data.boardTemp};
+    const double* const duplicateIn[]{data.sensorVoltage, data.sensorVoltage, data.boardTemp};
+    EXPECT_FALSE(linReg.fit(constantIn, data.temp, SetCount));
+    EXPECT_FALSE(linReg.fit(duplicateIn, data.temp, SetCount));
+
+    // Expect missing data to fail.
+    const double* const missingIn[]{data.sensorVoltage, nullptr, data.boardTemp};
+    EXPECT_FALSE(linReg.fit(missingIn, data.temp, SetCount));
+    EXPECT_FALSE(linReg.fit(trainIn, nullptr, SetCount));
+    EXPECT_FALSE(linReg.isTrained());
+}
+
+/**
+ * @brief Held inputs test.
+ *
+ *        Verify that the held inputs are used when predicting via the interface.
+ */
+TEST(LinRegMultivariate, HeldInputs)
+{
+    lin_reg::Multivariate<3U> linReg{};
+    linReg.setParameters(lin_reg::Multivariate<3U>::Inputs{100.0, -2.0, 0.5}, -40.0);
+    EXPECT_TRUE(linReg.isTrained());
+
+    // Expect only the inputs following the first to be held.
+    EXPECT_FALSE(linReg.setInput(0U, 1.0));
+    EXPECT_FALSE(linReg.setInput(3U, 1.0));
+    EXPECT_TRUE(linReg.setInput(1U, 5.0));
+    EXPECT_TRUE(linReg.setInput(2U, 20.0));
+
+    const lin_reg::Interface& model{linReg};
+    EXPECT_DOUBLE_EQ(model.predict(0.75), compensatedTemp(0.75, 5.0, 20.0));
+}
+
+/**
+ * @brief Smart temperature sensor test.
+ *
+ *        Verify that the smart temperature sensor reads compensated temperatures with the model.
+ */
+TEST(LinRegMultivariate, SmartTempSensor)
+{
+    constexpr std::uint8_t pin{0U};
+    driver::adc::Stub adc{};
+    adc.setInitialized(true);
+    adc.setChannelValidity(true);
+
+    const TrainingData data{};
+    const double* const trainIn[]{data.sensorVoltage, data.supplyVoltage, data.boardTemp};
+    lin_reg::Multivariate<3U> linReg{};
+    ASSERT_TRUE(linReg.fit(trainIn, data.temp, SetCount));
+
+    driver::tempsensor::Smart tempSensor{pin, adc, linReg};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Expect 0.75 V, i.e. ADC value 153 of 1023 at 5 V, to read as 35 degrees Celsius
+    // at nominal supply voltage and board temperature.
+    adc.setValue(153U);
+    linReg.setInput(1U, 5.0);
+    linReg.setInput(2U, 20.0);
+    EXPECT_EQ(tempSensor.read(), 35);
+
+    // Expect the reading to be compensated for a higher board temperature.
+    linReg.setInput(2U, 30.0);
+    EXPECT_EQ(tempSensor.read(), 40);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
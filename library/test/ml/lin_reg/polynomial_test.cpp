@@ -0,0 +1,141 @@
+/**
+ * @brief Unit tests for the polynomial regression implementation.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/stub.h"
+#include "driver/tempsensor/smart.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/lin_reg/polynomial.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr double thermistorTemp(const double voltage) noexcept
+{
+    // Quadratic approximation of a thermistor response.
+    return -30.0 * voltage * voltage + 120.0 * voltage - 45.0;
+}
+
+// -----------------------------------------------------------------------------
+Matrix1d sweep(const std::size_t count, const double step) noexcept
+{
+    Matrix1d values{};
+    for (std::size_t i{}; i < count; ++i) { values.pushBack(i * step); }
+    return values;
+}
+
+/**
+ * @brief Fit test.
+ *
+ *        Verify that data on a parabola is fitted exactly, and that the batch predictions
+ *        match the single predictions.
+ */
+TEST(LinRegPolynomial, Fit)
+{
+    const auto trainIn{sweep(20U, 0.1)};
+    Matrix2d trainOut{};
+    for (const auto input : trainIn) { trainOut.pushBack(thermistorTemp(input)); }
+
+    lin_reg::Polynomial<2U> linReg{};
+    EXPECT_FALSE(linReg.isTrained());
+    ASSERT_TRUE(linReg.fit(trainIn, trainOut));
+    EXPECT_TRUE(linReg.isTrained());
+
+    EXPECT_NEAR(linReg.coefficients()[0U], -45.0, 1e-6);
+    EXPECT_NEAR(linReg.coefficients()[1U], 120.0, 1e-6);
+    EXPECT_NEAR(linReg.coefficients()[2U], -30.0, 1e-6);
+
+    // Expect a cubic polynomial to fit the parabola as well, with a vanishing cubic term.
+    lin_reg::Polynomial<3U> cubic{};
+    ASSERT_TRUE(cubic.fit(trainIn, trainOut));
+    EXPECT_NEAR(cubic.coefficients()[3U], 0.0, 1e-6);
+
+    const auto inputs{sweep(40U, 0.05)};
+    double outputs[40U]{};
+    linReg.predict(inputs.data(), outputs, inputs.size());
+
+    for (std::size_t i{}; i < inputs.size(); ++i)
+    {
+        EXPECT_NEAR(linReg.predict(inputs[i]), thermistorTemp(inputs[i]), 1e-6);
+        EXPECT_NEAR(cubic.predict(inputs[i]), thermistorTemp(inputs[i]), 1e-6);
+        EXPECT_EQ(outputs[i], linReg.predict(inputs[i]));
+    }
+}
+
+/**
+ * @brief Straight line test.
+ *
+ *        Verify that a polynomial of degree 1 matches the least-squares line.
+ */
+TEST(LinRegPolynomial, StraightLine)
+{
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+    const Matrix2d trainOut{-49.0, -41.5, -29.0, -20.5, -9.0, 0.5, 9.0, 21.0};
+    lin_reg::Fit fit{};
+    ASSERT_TRUE(lin_reg::leastSquares(trainIn, trainOut, fit));
+
+    lin_reg::Polynomial<1U> linReg{};
+    ASSERT_TRUE(linReg.fit(trainIn, trainOut));
+    EXPECT_NEAR(linReg.coefficients()[0U], fit.bias, 1e-9);
+    EXPECT_NEAR(linReg.coefficients()[1U], fit.weight, 1e-9);
+}
+
+/**
+ * @brief Degenerate data test.
+ *
+ *        Verify that data with fewer distinct inputs than coefficients is rejected.
+ */
+TEST(LinRegPolynomial, DegenerateData)
+{
+    const Matrix1d trainIn{0.5, 1.0, 0.5, 1.0};
+    const Matrix2d trainOut{1.0, 2.0, 1.0, 2.0};
+    lin_reg::Polynomial<2U> linReg{};
+
+    EXPECT_FALSE(linReg.fit(trainIn, trainOut));
+    EXPECT_FALSE(linReg.fit(Matrix1d{}, Matrix2d{}));
+    EXPECT_FALSE(linReg.isTrained());
+
+    // Expect coefficients set explicitly to mark the model trained.
+    linReg.setCoefficients(lin_reg::Polynomial<2U>::Coefficients{1.0, 2.0, 3.0});
+    EXPECT_TRUE(linReg.isTrained());
+    EXPECT_DOUBLE_EQ(linReg.predict(2.0), 17.0);
+}
+
+/**
+ * @brief Smart temperature sensor test.
+ *
+ *        Verify that the smart temperature sensor reads temperatures with the model.
+ */
+TEST(LinRegPolynomial, SmartTempSensor)
+{
+    constexpr std::uint8_t pin{0U};
+    driver::adc::Stub adc{};
+    adc.setInitialized(true);
+    adc.setChannelValidity(true);
+
+    const auto trainIn{sweep(20U, 0.1)};
+    Matrix2d trainOut{};
+    for (const auto input : trainIn) { trainOut.pushBack(thermistorTemp(input)); }
+    lin_reg::Polynomial<2U> linReg{};
+    ASSERT_TRUE(linReg.fit(trainIn, trainOut));
+
+    driver::tempsensor::Smart tempSensor{pin, adc, linReg};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Expect 1.0 V, i.e. ADC value 205 of 1023 at 5 V, to read as 45 degrees Celsius.
+    adc.setValue(205U);
+    EXPECT_EQ(tempSensor.read(), 45);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
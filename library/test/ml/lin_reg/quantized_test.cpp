@@ -0,0 +1,113 @@
+/**
+ * @brief Unit tests for the fixed-point linear regression model.
+ */
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "ml/fixed_point.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/**
+ * @brief Accuracy test.
+ *
+ *        Verify that the fixed-point model predicts the same values as the floating-point
+ *        model when trained on the temperature dataset of the application, T = 100 * Uin - 50.
+ */
+TEST(LinRegQuantized, Accuracy)
+{
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3};
+    const Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0,
+                            20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0};
+    constexpr std::size_t epochCount{100U};
+    constexpr double learningRate{0.01};
+
+    lin_reg::Fixed reference{};
+    lin_reg::Quantized<> linReg{};
+    EXPECT_FALSE(linReg.isTrained());
+    EXPECT_TRUE(reference.train(trainIn, trainOut, epochCount, learningRate));
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, epochCount, learningRate));
+    EXPECT_TRUE(linReg.isTrained());
+
+    // Expect the predictions to match within a hundredth of a degree.
+    for (double input{0.0}; input <= 1.5; input += 0.05)
+    {
+        EXPECT_NEAR(reference.predict(input), linReg.predict(input), 0.01);
+        EXPECT_EQ(linReg.predict(Q16_16::fromDouble(input)).toDouble(), linReg.predict(input));
+    }
+}
+
+/**
+ * @brief Happy path test.
+ *
+ *        Verify that the model predicts as intended during optimal conditions.
+ */
+TEST(LinRegQuantized, HappyPath)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+
+    // Expect the model to predict 0 when untrained.
+    lin_reg::Quantized<> linReg{};
+    EXPECT_EQ(linReg.predict(2.0), 0.0);
+
+    // Expect the model to converge within the fixed-point resolution.
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, 100U, 0.01));
+    EXPECT_NEAR(linReg.weight().toDouble(), 2.0, 1e-3);
+    EXPECT_NEAR(linReg.bias().toDouble(), 2.0, 1e-3);
+
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        EXPECT_NEAR(trainOut[i], linReg.predict(trainIn[i]), 1e-3);
+    }
+}
+
+/**
+ * @brief Invalid training parameters test.
+ *
+ *        Verify that the model doesn't get trained with invalid parameters.
+ */
+TEST(LinRegQuantized, InvalidParameters)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0};
+    lin_reg::Quantized<> linReg{};
+
+    EXPECT_FALSE(linReg.train(Matrix1d{}, trainOut, 100U, 0.01));
+    EXPECT_FALSE(linReg.train(trainIn, Matrix2d{}, 100U, 0.01));
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, 0U, 0.01));
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 0.0));
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 1.5));
+
+    // Expect learning rates below the fixed-point resolution to be rejected.
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 1e-6));
+    EXPECT_FALSE(linReg.isTrained());
+}
+
+/**
+ * @brief Saturation test.
+ *
+ *        Verify that predictions out of range saturate instead of wrapping around.
+ */
+TEST(LinRegQuantized, Saturation)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0};
+    const Matrix2d trainOut{0.0, 1000.0, 2000.0};
+    lin_reg::Quantized<> linReg{};
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, 100U, 0.1));
+
+    EXPECT_EQ(linReg.predict(Q16_16::fromInt(1000)), Q16_16::max());
+    EXPECT_EQ(linReg.predict(Q16_16::fromInt(-1000)), Q16_16::min());
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,198 @@
+/**
+ * @brief Unit tests for online linear regression using recursive least squares.
+ */
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "memory/stats.h"
+#include "ml/lin_reg/recursive.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/**
+ * @brief Get the reference temperature of synthetic drifting sensor data.
+ *
+ *        The sensor follows T = 100 * Uin - 50 at first. Its gain then drifts linearly to
+ *        T = 110 * Uin - 45 over given number of samples, after which it stays constant.
+ *
+ * @param[in] input The input voltage.
+ * @param[in] sample The sample index.
+ * @param[in] driftCount The number of samples the drift lasts.
+ *
+ * @return The reference temperature.
+ */
+double driftingOutput(const double input, const size_t sample, const size_t driftCount) noexcept
+{
+    const double progress{sample < driftCount ? static_cast<double>(sample) / driftCount : 1.0};
+    return (100.0 + 10.0 * progress) * input + (-50.0 + 5.0 * progress);
+}
+
+/**
+ * @brief Get the input voltage of given sample, sweeping 0.0 - 1.4 V.
+ *
+ * @param[in] sample The sample index.
+ *
+ * @return The input voltage.
+ */
+double sweepInput(const size_t sample) noexcept { return (sample % 15U) * 0.1; }
+
+/**
+ * @brief Initialization test.
+ *
+ *        Verify that the model is untrained until it has learned from two samples, and that
+ *        models with invalid parameters refuse to learn.
+ */
+TEST(LinRegRecursive, Initialization)
+{
+    lin_reg::Recursive linReg{};
+    EXPECT_FALSE(linReg.isTrained());
+    EXPECT_EQ(linReg.sampleCount(), 0U);
+
+    EXPECT_TRUE(linReg.update(0.0, -50.0));
+    EXPECT_FALSE(linReg.isTrained());
+    EXPECT_TRUE(linReg.update(1.0, 50.0));
+    EXPECT_TRUE(linReg.isTrained());
+    EXPECT_EQ(linReg.sampleCount(), 2U);
+
+    // Expect two samples to roughly determine the line, since the initial covariance is large.
+    EXPECT_NEAR(linReg.weight(), 100.0, 0.5);
+    EXPECT_NEAR(linReg.bias(), -50.0, 0.5);
+
+    // Expect the model to start over after reset.
+    linReg.reset();
+    EXPECT_FALSE(linReg.isTrained());
+    EXPECT_EQ(linReg.weight(), 0.0);
+    EXPECT_EQ(linReg.bias(), 0.0);
+
+    // Expect invalid forgetting factors or covariances to be rejected.
+    for (const double factor : {0.0, -0.5, 1.5})
+    {
+        lin_reg::Recursive invalid{factor};
+        EXPECT_FALSE(invalid.update(1.0, 50.0));
+        EXPECT_EQ(invalid.sampleCount(), 0U);
+    }
+    lin_reg::Recursive invalid{0.99, 0.0};
+    EXPECT_FALSE(invalid.update(1.0, 50.0));
+}
+
+/**
+ * @brief Convergence test.
+ *
+ *        Verify that the model converges to the least-squares solution on stationary data
+ *        when no samples are forgotten. The initial covariance acts as a prior pulling the
+ *        parameters towards 0, which a greater initial covariance makes weaker.
+ */
+TEST(LinRegRecursive, Convergence)
+{
+    lin_reg::Recursive linReg{1.0, 1.0e6};
+
+    for (size_t i{}; i < 150U; ++i)
+    {
+        const double input{sweepInput(i)};
+        EXPECT_TRUE(linReg.update(input, 100.0 * input - 50.0));
+    }
+    EXPECT_NEAR(linReg.weight(), 100.0, 1e-3);
+    EXPECT_NEAR(linReg.bias(), -50.0, 1e-3);
+
+    for (double input{0.0}; input <= 1.5; input += 0.05)
+    {
+        EXPECT_NEAR(linReg.predict(input), 100.0 * input - 50.0, 1e-2);
+    }
+}
+
+/**
+ * @brief Drift test.
+ *
+ *        Verify that the model tracks drifting data when older samples are forgotten, while
+ *        a model weighing all samples equally lags behind.
+ */
+TEST(LinRegRecursive, Drift)
+{
+    constexpr size_t driftCount{300U};
+    constexpr size_t sampleCount{600U};
+    lin_reg::Recursive tracking{0.95};
+    lin_reg::Recursive averaging{1.0};
+
+    for (size_t i{}; i < sampleCount; ++i)
+    {
+        const double input{sweepInput(i)};
+        const double output{driftingOutput(input, i, driftCount)};
+        EXPECT_TRUE(tracking.update(input, output));
+        EXPECT_TRUE(averaging.update(input, output));
+
+        // Expect the tracking model to follow the drift closely, lagging slightly behind.
+        if (i > 30U)
+        {
+            EXPECT_NEAR(tracking.predict(1.0), driftingOutput(1.0, i, driftCount), 1.5);
+        }
+    }
+    // Expect the tracking model to have converged to the drifted sensor.
+    EXPECT_NEAR(tracking.weight(), 110.0, 1e-2);
+    EXPECT_NEAR(tracking.bias(), -45.0, 1e-2);
+
+    // Expect the averaging model to still be off due to the samples before the drift.
+    EXPECT_GT(110.0 - averaging.weight(), 1.0);
+}
+
+/**
+ * @brief Windup test.
+ *
+ *        Verify that the covariance doesn't grow without bound when the input stays constant,
+ *        so that the model still adapts to new inputs afterwards.
+ */
+TEST(LinRegRecursive, Windup)
+{
+    lin_reg::Recursive linReg{0.9};
+
+    for (size_t i{}; i < 150U; ++i)
+    {
+        const double input{sweepInput(i)};
+        linReg.update(input, 100.0 * input - 50.0);
+    }
+
+    // Feed the same sample for a long time, which carries no information about the slope.
+    for (size_t i{}; i < 10000U; ++i) { EXPECT_TRUE(linReg.update(0.5, 0.0)); }
+    EXPECT_NEAR(linReg.predict(0.5), 0.0, 1e-3);
+    EXPECT_NEAR(linReg.weight(), 100.0, 1.0);
+
+    // Expect the model to recover once the input varies again.
+    for (size_t i{}; i < 150U; ++i)
+    {
+        const double input{sweepInput(i)};
+        linReg.update(input, 100.0 * input - 50.0);
+    }
+    EXPECT_NEAR(linReg.weight(), 100.0, 1e-2);
+    EXPECT_NEAR(linReg.bias(), -50.0, 1e-2);
+}
+
+/**
+ * @brief Constant cost test.
+ *
+ *        Verify that learning requires no memory beyond the model itself, regardless of the
+ *        number of samples.
+ */
+TEST(LinRegRecursive, ConstantCost)
+{
+    lin_reg::Recursive linReg{};
+    memory::stats::resetHeap();
+    const auto liveBytes{memory::stats::heap().liveBytes};
+
+    for (size_t i{}; i < 100000U; ++i)
+    {
+        const double input{sweepInput(i)};
+        linReg.update(input, 100.0 * input - 50.0);
+    }
+    EXPECT_EQ(linReg.sampleCount(), 100000U);
+    EXPECT_EQ(memory::stats::heap().allocationCount, 0U);
+    EXPECT_EQ(memory::stats::heap().liveBytes, liveBytes);
+    EXPECT_NEAR(linReg.predict(1.0), 50.0, 1e-3);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,213 @@
+/**
+ * @brief Unit tests for the storage of linear regression model parameters in EEPROM.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/types.h"
+#include "telemetry/crc16.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Size of the EEPROM stubs used in the tests. */
+constexpr uint16_t EepromSize{64U};
+
+/** Start address of the records, after a byte used by something else. */
+constexpr uint16_t RecordAddr{1U};
+
+// -----------------------------------------------------------------------------
+void readRecord(const driver::eeprom::Interface& eeprom, uint8_t* record) noexcept
+{
+    for (uint16_t i{}; i < lin_reg::storage::RecordSize; ++i)
+    {
+        EXPECT_TRUE(eeprom.read(RecordAddr + i, record[i]));
+    }
+}
+
+// -----------------------------------------------------------------------------
+void writeRecord(driver::eeprom::Interface& eeprom, const uint8_t* record) noexcept
+{
+    for (uint16_t i{}; i < lin_reg::storage::RecordSize; ++i)
+    {
+        EXPECT_TRUE(eeprom.write(RecordAddr + i, record[i]));
+    }
+}
+
+/**
+ * @brief Save and load test.
+ *
+ *        Verify that saved parameters are loaded as is and restore a trained model.
+ */
+TEST(LinRegStorage, SaveLoad)
+{
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9};
+    const Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 30.0, 40.0};
+    const auto fingerprint{lin_reg::storage::fingerprint(trainIn, trainOut)};
+    driver::eeprom::Stub<EepromSize> eeprom{};
+
+    lin_reg::Fixed trained{};
+    ASSERT_TRUE(trained.fit(trainIn, trainOut));
+    const lin_reg::storage::Parameters saved{trained.weight(), trained.bias()};
+    ASSERT_TRUE(lin_reg::storage::save(eeprom, RecordAddr, saved, fingerprint));
+
+    // Expect the record not to overwrite the byte before it.
+    uint8_t before{};
+    EXPECT_TRUE(eeprom.read(RecordAddr - 1U, before));
+    EXPECT_EQ(before, 0U);
+
+    lin_reg::storage::Parameters loaded{};
+    ASSERT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Valid);
+    EXPECT_EQ(loaded.weight, saved.weight);
+    EXPECT_EQ(loaded.bias, saved.bias);
+
+    // Expect the loaded parameters to restore the trained models without training.
+    lin_reg::Fixed linReg{};
+    lin_reg::Quantized<> quantized{};
+    EXPECT_FALSE(linReg.isTrained());
+    linReg.setParameters(loaded.weight, loaded.bias);
+    quantized.setParameters(Q16_16::fromDouble(loaded.weight), Q16_16::fromDouble(loaded.bias));
+    EXPECT_TRUE(linReg.isTrained());
+    EXPECT_TRUE(quantized.isTrained());
+
+    for (double input{0.0}; input <= 1.0; input += 0.05)
+    {
+        EXPECT_EQ(linReg.predict(input), trained.predict(input));
+        EXPECT_NEAR(quantized.predict(input), trained.predict(input), 1e-2);
+    }
+
+    // Expect saving the same record again to succeed and leave the record valid.
+    EXPECT_TRUE(lin_reg::storage::save(eeprom, RecordAddr, saved, fingerprint));
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Valid);
+}
+
+/**
+ * @brief Corrupt record test.
+ *
+ *        Verify that blank EEPROM and records with flipped bits are rejected, leaving the
+ *        parameters unchanged.
+ */
+TEST(LinRegStorage, CorruptRecord)
+{
+    constexpr uint16_t fingerprint{0x1234U};
+    driver::eeprom::Stub<EepromSize> eeprom{};
+    lin_reg::storage::Parameters loaded{1.0, 2.0};
+
+    // Expect erased EEPROM, i.e. all zeros or all ones, not to hold a valid record.
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Corrupt);
+
+    for (uint16_t i{}; i < EepromSize - 1U; ++i) { eeprom.write(i, static_cast<uint8_t>(0xFFU)); }
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Corrupt);
+
+    // Flip each bit of a valid record, one at a time.
+    ASSERT_TRUE(lin_reg::storage::save(eeprom, RecordAddr, {100.0, -50.0}, fingerprint));
+    uint8_t record[lin_reg::storage::RecordSize]{};
+    readRecord(eeprom, record);
+
+    for (uint16_t i{}; i < lin_reg::storage::RecordSize; ++i)
+    {
+        for (uint8_t bit{}; bit < 8U; ++bit)
+        {
+            record[i] ^= static_cast<uint8_t>(1U << bit);
+            writeRecord(eeprom, record);
+            EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+                      lin_reg::storage::Status::Corrupt);
+            record[i] ^= static_cast<uint8_t>(1U << bit);
+        }
+    }
+    EXPECT_EQ(loaded.weight, 1.0);
+    EXPECT_EQ(loaded.bias, 2.0);
+
+    // Expect the record to be valid once restored.
+    writeRecord(eeprom, record);
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Valid);
+    EXPECT_EQ(loaded.weight, 100.0);
+    EXPECT_EQ(loaded.bias, -50.0);
+}
+
+/**
+ * @brief Stale record test.
+ *
+ *        Verify that intact records of another training set or format version are rejected.
+ */
+TEST(LinRegStorage, StaleRecord)
+{
+    const Matrix1d trainIn{0.0, 0.5, 1.0};
+    const Matrix2d trainOut{-50.0, 0.0, 50.0};
+    const Matrix2d otherOut{-50.0, 0.0, 50.5};
+    const Matrix1d shortIn{0.0, 0.5};
+    const auto fingerprint{lin_reg::storage::fingerprint(trainIn, trainOut)};
+    driver::eeprom::Stub<EepromSize> eeprom{};
+    lin_reg::storage::Parameters loaded{1.0, 2.0};
+
+    // Expect the fingerprint to be deterministic and to change along with the training set.
+    EXPECT_EQ(lin_reg::storage::fingerprint(trainIn, trainOut), fingerprint);
+    EXPECT_NE(lin_reg::storage::fingerprint(trainIn, otherOut), fingerprint);
+    EXPECT_NE(lin_reg::storage::fingerprint(shortIn, trainOut), fingerprint);
+
+    // Expect a record of another training set to be stale.
+    ASSERT_TRUE(lin_reg::storage::save(eeprom, RecordAddr, {100.0, -50.0}, fingerprint));
+    const auto otherFingerprint{lin_reg::storage::fingerprint(trainIn, otherOut)};
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, otherFingerprint, loaded), 
+              lin_reg::storage::Status::Stale);
+
+    // Expect a record of another version to be stale, even if the checksum matches.
+    uint8_t record[lin_reg::storage::RecordSize]{};
+    readRecord(eeprom, record);
+    record[0U] = lin_reg::storage::Version + 1U;
+    constexpr uint16_t crcOffset{lin_reg::storage::RecordSize - sizeof(uint16_t)};
+    const auto crc{telemetry::crc16::compute(record, crcOffset)};
+    record[crcOffset]      = static_cast<uint8_t>(crc);
+    record[crcOffset + 1U] = static_cast<uint8_t>(crc >> 8U);
+    writeRecord(eeprom, record);
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Stale);
+    EXPECT_EQ(loaded.weight, 1.0);
+    EXPECT_EQ(loaded.bias, 2.0);
+
+    // Expect the record to be valid once saved again, e.g. after retraining.
+    ASSERT_TRUE(lin_reg::storage::save(eeprom, RecordAddr, {100.0, -50.0}, fingerprint));
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Valid);
+}
+
+/**
+ * @brief Unavailable EEPROM test.
+ *
+ *        Verify that records can't be saved or loaded if the EEPROM is disabled or too small.
+ */
+TEST(LinRegStorage, Unavailable)
+{
+    constexpr uint16_t fingerprint{0x1234U};
+    driver::eeprom::Stub<EepromSize> eeprom{};
+    lin_reg::storage::Parameters loaded{};
+
+    eeprom.setEnabled(false);
+    EXPECT_FALSE(lin_reg::storage::save(eeprom, RecordAddr, {100.0, -50.0}, fingerprint));
+    EXPECT_EQ(lin_reg::storage::load(eeprom, RecordAddr, fingerprint, loaded), 
+              lin_reg::storage::Status::Unavailable);
+
+    // Expect records not to fit at the end of the EEPROM.
+    eeprom.setEnabled(true);
+    constexpr uint16_t lastAddr{EepromSize - lin_reg::storage::RecordSize};
+    EXPECT_FALSE(lin_reg::storage::save(eeprom, lastAddr + 1U, {100.0, -50.0}, fingerprint));
+    EXPECT_EQ(lin_reg::storage::load(eeprom, lastAddr + 1U, fingerprint, loaded), 
+              lin_reg::storage::Status::Unavailable);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
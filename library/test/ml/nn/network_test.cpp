@@ -0,0 +1,274 @@
+/**
+ * @brief Unit tests for the quantized neural network inference engine.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/stub.h"
+#include "driver/tempsensor/smart.h"
+#include "ml/nn/dense.h"
+#include "ml/nn/network.h"
+#include "thermistor_model.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace nn
+{
+namespace
+{
+/** One in Q5.10 format. */
+constexpr std::int16_t One{1 << ActivationFracBits};
+
+/** Identity scaling of one input and one output. */
+constexpr Scaling<1U, 1U> Identity{{0.0}, {1.0}, {0.0}, {1.0}};
+
+/** Hidden layer splitting the input into its positive and negative part, in Q1.6 format. */
+constexpr Dense<std::int8_t, 1U, 2U> Split{{{64}, {-64}}, {0, 0}, 6U, Activation::Relu};
+
+/** Output layer adding up both parts, in Q1.6 format. */
+constexpr Dense<std::int8_t, 2U, 1U> Sum{{{64, 64}}, {0}, 6U, Activation::Linear};
+
+/** Network calculating the absolute value of the input. */
+using Absolute = Network<Identity, Split, Sum>;
+
+/** Scaling of two inputs and two outputs, the outputs are restored to twice the range. */
+constexpr Scaling<2U, 2U> Pair{{1.0, 0.0}, {1.0, 0.5}, {10.0, 0.0}, {2.0, 2.0}};
+
+/** Layer calculating the sum and the difference of two inputs, in Q1.14 format. */
+constexpr Dense<std::int16_t, 2U, 2U> SumDiff{
+    {{16384, 16384}, {16384, -16384}}, {0, 0}, 14U, Activation::Linear};
+
+/** Network calculating the sum and the difference of two inputs. */
+using SumAndDifference = Network<Pair, SumDiff>;
+
+// -----------------------------------------------------------------------------
+double thermistorTemp(const double voltage) noexcept
+{
+    // Invert the divider of a 10k NTC thermistor (B = 3950) below a 10k resistor at 5 V.
+    const double resistance{10e3 * voltage / (5.0 - voltage)};
+    return 1.0 / (1.0 / 298.15 + std::log(resistance / 10e3) / 3950.0) - 273.15;
+}
+
+// -----------------------------------------------------------------------------
+double thermistorVoltage(const double temp) noexcept
+{
+    const double resistance{10e3 * std::exp(3950.0 * (1.0 / (temp + 273.15) - 1.0 / 298.15))};
+    return 5.0 * resistance / (resistance + 10e3);
+}
+
+/**
+ * @brief Activation test.
+ *
+ *        Verify that weighted sums are rounded to nearest, clamped by ReLU and saturated.
+ */
+TEST(Ml_Network, Activation)
+{
+    static_assert(activate(3 << 4, 4U, Activation::Linear) == 3, "Invalid activation!");
+
+    EXPECT_EQ(2, activate(24, 4U, Activation::Linear));   // 1.5 rounds up.
+    EXPECT_EQ(-1, activate(-24, 4U, Activation::Linear)); // -1.5 rounds up.
+    EXPECT_EQ(-2, activate(-25, 4U, Activation::Linear));
+    EXPECT_EQ(0, activate(-25, 4U, Activation::Relu));
+    EXPECT_EQ(7, activate(7, 0U, Activation::Relu));
+
+    EXPECT_EQ(INT16_MAX, activate(INT32_MAX / 2, 4U, Activation::Linear));
+    EXPECT_EQ(INT16_MIN, activate(INT32_MIN / 2, 4U, Activation::Linear));
+    EXPECT_EQ(0, activate(INT32_MIN / 2, 4U, Activation::Relu));
+}
+
+/**
+ * @brief Dense layer test.
+ *
+ *        Verify that a dense layer calculates the weighted sums exactly.
+ */
+TEST(Ml_Network, Dense)
+{
+    // Weights 0.5, -0.25 and 1.0 as well as bias 0.125 in Q1.6 format.
+    constexpr Dense<std::int8_t, 3U, 1U> layer{{{32, -16, 64}}, {(One / 8) << 6}, 6U,
+                                               Activation::Linear};
+    const std::int16_t inputs[3U]{One, 2 * One, -One / 2};
+    std::int16_t output{};
+
+    layer.forward(inputs, &output);
+    EXPECT_EQ(0.5 * One - 0.5 * One - 0.5 * One + One / 8, output);
+}
+
+/**
+ * @brief Accumulator test.
+ *
+ *        Verify that the weighted sums of full-scale weights and saturated inputs don't
+ *        overflow, also when they're out of the 32-bit range in between.
+ */
+TEST(Ml_Network, Accumulator)
+{
+    static_assert(sizeof(Dense<std::int8_t, 255U, 1U>::Sum) == 4U, "Invalid accumulator!");
+    static_assert(sizeof(Dense<std::int16_t, 1U, 1U>::Sum) == 8U, "Invalid accumulator!");
+
+    // Weights of about 2.0 and -2.0 in Q1.14 format, the first three products already exceed
+    // the 32-bit range.
+    constexpr Dense<std::int16_t, 8U, 3U> layer{
+        {{INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX},
+         {INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN},
+         {INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, -INT16_MAX, -INT16_MAX, -INT16_MAX,
+          -INT16_MAX}},
+        {0, BiasLimit, (One / 4) << 14},
+        14U,
+        Activation::Linear};
+
+    // Saturated inputs, as quantized inputs and ReLU outputs may be.
+    std::int16_t inputs[8U]{};
+    for (auto& input : inputs) { input = INT16_MAX; }
+    std::int16_t outputs[3U]{};
+
+    layer.forward(inputs, outputs);
+    EXPECT_EQ(INT16_MAX, outputs[0U]);
+    EXPECT_EQ(INT16_MIN, outputs[1U]);
+    EXPECT_EQ(One / 4, outputs[2U]);
+
+    // Expect ReLU to clamp the saturated negative sums to 0.
+    constexpr Dense<std::int16_t, 8U, 1U> relu{
+        {{INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN}},
+        {-BiasLimit},
+        14U,
+        Activation::Relu};
+    relu.forward(inputs, outputs);
+    EXPECT_EQ(0, outputs[0U]);
+}
+
+/**
+ * @brief Network test.
+ *
+ *        Verify that the layers are run in order, and that the inputs and outputs are scaled.
+ */
+TEST(Ml_Network, Predict)
+{
+    const Absolute absolute{};
+    EXPECT_TRUE(absolute.isTrained());
+
+    for (const auto input : {-1.5, -0.25, 0.0, 0.75, 3.0})
+    {
+        EXPECT_DOUBLE_EQ(std::abs(input), absolute.predict(input));
+    }
+
+    // Expect inputs out of range of the activations to saturate.
+    EXPECT_NEAR(32.0, absolute.predict(-100.0), 0.01);
+
+    const SumAndDifference sumDiff{};
+    double outputs[2U]{};
+    sumDiff.predict({3.0, 2.0}, outputs);
+
+    // The normalized inputs are 2.0 and 1.0, hence the sum is 3.0 and the difference 1.0.
+    EXPECT_DOUBLE_EQ(16.0, outputs[0U]);
+    EXPECT_DOUBLE_EQ(2.0, outputs[1U]);
+}
+
+/**
+ * @brief Quantized prediction test.
+ *
+ *        Verify that quantized inputs are predicted with integer math only.
+ */
+TEST(Ml_Network, PredictQuantized)
+{
+    std::int16_t outputs[1U]{};
+    Absolute::predictQuantized({-3 * One / 4}, outputs);
+    EXPECT_EQ(3 * One / 4, outputs[0U]);
+
+    EXPECT_EQ(One / 2, Absolute::quantizeInput(0U, 0.5));
+    EXPECT_EQ(-One / 2, Absolute::quantizeInput(0U, -0.5));
+    EXPECT_EQ(INT16_MAX, Absolute::quantizeInput(0U, 1000.0));
+    EXPECT_EQ(0, Absolute::quantizeInput(1U, 0.5));
+    EXPECT_DOUBLE_EQ(0.25, Absolute::restoreOutput(0U, One / 4));
+    EXPECT_DOUBLE_EQ(0.0, Absolute::restoreOutput(1U, One / 4));
+}
+
+/**
+ * @brief Held input test.
+ *
+ *        Verify that predict(double) uses the held inputs for all inputs but the first.
+ */
+TEST(Ml_Network, HeldInputs)
+{
+    SumAndDifference sumDiff{};
+    EXPECT_FALSE(sumDiff.setInput(0U, 1.0));
+    EXPECT_FALSE(sumDiff.setInput(2U, 1.0));
+
+    // The second input is held at 0 until set.
+    EXPECT_DOUBLE_EQ(14.0, sumDiff.predict(3.0));
+    EXPECT_TRUE(sumDiff.setInput(1U, 2.0));
+    EXPECT_DOUBLE_EQ(16.0, sumDiff.predict(3.0));
+}
+
+/**
+ * @brief Memory plan test.
+ *
+ *        Verify that the memory needed by the networks is known at compile time.
+ */
+TEST(Ml_Network, MemoryPlan)
+{
+    static_assert(Absolute::LayerCount == 2U, "Invalid layer count!");
+    static_assert(Absolute::InputCount == 1U, "Invalid input count!");
+    static_assert(Absolute::OutputCount == 1U, "Invalid output count!");
+    static_assert(Absolute::BufferSize == 2U, "Invalid buffer size!");
+    static_assert(Absolute::ScratchBytes == 8U, "Invalid scratch size!");
+    static_assert(SumAndDifference::BufferSize == 2U, "Invalid buffer size!");
+
+    static_assert(thermistor::Model::LayerCount == 3U, "Invalid layer count!");
+    static_assert(thermistor::Model::BufferSize == 8U, "Invalid buffer size!");
+    static_assert(thermistor::Model::ScratchBytes == 32U, "Invalid scratch size!");
+
+    // The layers hold one weight per output and input, and one 32-bit bias per output.
+    EXPECT_LE(8U + 64U + 8U + 4U * 17U, thermistor::Model::ParameterBytes);
+}
+
+/**
+ * @brief Generated model test.
+ *
+ *        Verify that the model exported by the host-side trainer calibrates the nonlinear
+ *        thermistor response, also between the training samples.
+ */
+TEST(Ml_Network, ThermistorModel)
+{
+    const thermistor::Model model{};
+    double maxError{};
+
+    for (double temp{-20.0}; temp <= 100.0; temp += 0.5)
+    {
+        const double voltage{thermistorVoltage(temp)};
+        EXPECT_NEAR(temp, thermistorTemp(voltage), 1e-6);
+
+        const double error{std::abs(model.predict(voltage) - temp)};
+        if (error > maxError) { maxError = error; }
+    }
+    EXPECT_GT(1.0, maxError);
+}
+
+/**
+ * @brief Smart temperature sensor test.
+ *
+ *        Verify that the smart temperature sensor reads temperatures with the network.
+ */
+TEST(Ml_Network, SmartTempSensor)
+{
+    constexpr std::uint8_t pin{0U};
+    driver::adc::Stub adc{};
+    adc.setInitialized(true);
+    adc.setChannelValidity(true);
+
+    const thermistor::Model model{};
+    driver::tempsensor::Smart tempSensor{pin, adc, model};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Expect 2.5 V, i.e. ADC value 512 of 1023 at 5 V, to read as about 25 degrees Celsius.
+    adc.setValue(512U);
+    EXPECT_NEAR(25, tempSensor.read(), 1);
+}
+} // namespace
+} // namespace nn
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,64 @@
+/**
+ * @brief Neural network thermistor::Model exported by nn_export.py, don't edit.
+ *
+ *        Topology 1-8-8-1, int8 weights, maximum training error 0.531.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/nn/network.h"
+
+namespace thermistor
+{
+/** Scaling of the inputs and outputs. */
+constexpr ml::nn::Scaling<1U, 1U> Scaling{
+    {2.4463431685521657},
+    {0.47162608364444814},
+    {40.0},
+    {60.0}};
+
+/** Layer 0, 1 inputs and 8 outputs. */
+constexpr ml::nn::Dense<int8_t, 1U, 8U> Layer0{
+    {
+        {58},
+        {62},
+        {-1},
+        {-38},
+        {-50},
+        {9},
+        {-43},
+        {-70},
+    },
+    {-3624, 3238, -4427, -16843, -47340, -7115, -10727, -4289},
+    5U,
+    ml::nn::Activation::Relu};
+
+/** Layer 1, 8 inputs and 8 outputs. */
+constexpr ml::nn::Dense<int8_t, 8U, 8U> Layer1{
+    {
+        {-1, -7, 9, -36, -15, 2, -61, 33},
+        {7, 72, -2, 10, 61, -40, 47, 2},
+        {3, 27, 14, 16, -18, -8, 17, 34},
+        {5, 35, 7, 13, 24, -35, -9, -9},
+        {65, -1, 30, 8, -21, -30, 19, -25},
+        {2, -47, -14, 59, 67, -62, -23, 11},
+        {25, 11, 18, -13, 19, 57, -14, -14},
+        {-30, 19, -46, 1, -32, -13, -6, 2},
+    },
+    {1308, -15091, -14002, 14064, -20017, -28017, 251, -5911},
+    6U,
+    ml::nn::Activation::Relu};
+
+/** Layer 2, 8 inputs and 1 outputs. */
+constexpr ml::nn::Dense<int8_t, 8U, 1U> Layer2{
+    {
+        {37, 23, 36, -3, -17, 38, -93, 9},
+    },
+    {-12858},
+    6U,
+    ml::nn::Activation::Linear};
+
+/** The network. */
+using Model = ml::nn::Network<Scaling, Layer0, Layer1, Layer2>;
+} // namespace thermistor
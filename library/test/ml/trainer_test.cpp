@@ -0,0 +1,370 @@
+/**
+ * @brief Unit tests for the mini-batch gradient descent trainer.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/polynomial.h"
+#include "ml/random.h"
+#include "ml/trainer.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+const Matrix1d& trainIn() noexcept
+{
+    // The temperature dataset of the application, T = 100 * Uin - 50.
+    static const Matrix1d myInstance{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6,
+                                     0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+const Matrix2d& trainOut() noexcept
+{
+    static const Matrix2d myInstance{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0,
+                                     30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0};
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+TrainConfig miniBatchConfig() noexcept
+{
+    TrainConfig config{};
+    config.epochCount   = 1000U;
+    config.batchSize    = 5U;
+    config.learningRate = 1.0;
+    config.targetLoss   = 1e-4;
+    config.shuffle      = true;
+    return config;
+}
+
+/**
+ * @brief Structure holding the losses reported by the epoch callback.
+ */
+struct EpochLog
+{
+    std::size_t epochCount;
+    std::size_t lastEpoch;
+    double firstLoss;
+    double lastLoss;
+};
+
+// -----------------------------------------------------------------------------
+void logEpoch(const std::size_t epoch, const double loss, void* context) noexcept
+{
+    auto& log{*static_cast<EpochLog*>(context)};
+    if (0U == log.epochCount) { log.firstLoss = loss; }
+    ++log.epochCount;
+    log.lastEpoch = epoch;
+    log.lastLoss  = loss;
+}
+
+/**
+ * @brief Pseudo-random number generator test.
+ *
+ *        Verify that the sequence only depends on the seed and that bounds are respected.
+ */
+TEST(Ml_Trainer, Random)
+{
+    Random first{42U};
+    Random second{42U};
+    Random other{43U};
+    bool differs{false};
+
+    for (std::size_t i{}; i < 100U; ++i)
+    {
+        const auto value{first.next()};
+        EXPECT_NE(0U, value);
+        EXPECT_EQ(value, second.next());
+        if (value != other.next()) { differs = true; }
+    }
+    EXPECT_TRUE(differs);
+
+    // Expect a seed of 0 to be replaced, since the state must be non-zero.
+    Random zero{0U};
+    Random one{1U};
+    EXPECT_EQ(one.next(), zero.next());
+
+    // Expect bounded numbers to stay below the bound, and 0 for a bound of 0.
+    for (std::size_t i{}; i < 100U; ++i) { EXPECT_GT(7U, first.next(7U)); }
+    EXPECT_EQ(0U, first.next(0U));
+
+    // Expect reseeding to restart the sequence.
+    first.seed(42U);
+    second.seed(42U);
+    EXPECT_EQ(second.next(), first.next());
+}
+
+/**
+ * @brief Happy path test.
+ *
+ *        Verify that shuffled mini-batch training reaches the target loss and stops early.
+ */
+TEST(Ml_Trainer, HappyPath)
+{
+    const auto config{miniBatchConfig()};
+    Trainer trainer{config};
+    EXPECT_TRUE(trainer.isConfigValid());
+
+    lin_reg::Fixed linReg{};
+    TrainResult result{};
+    ASSERT_TRUE(trainer.train(linReg, trainIn(), trainOut(), &result));
+    EXPECT_TRUE(linReg.isTrained());
+
+    EXPECT_TRUE(result.converged);
+    EXPECT_LT(result.epochCount, config.epochCount);
+    EXPECT_GE(config.targetLoss, result.loss);
+    EXPECT_NEAR(100.0, linReg.weight(), 0.1);
+    EXPECT_NEAR(-50.0, linReg.bias(), 0.1);
+
+    // Expect the in-order training of lin_reg::Fixed to need many more epochs.
+    TrainConfig inOrder{};
+    inOrder.epochCount = config.epochCount;
+    inOrder.targetLoss = config.targetLoss;
+    Trainer inOrderTrainer{inOrder};
+    TrainResult inOrderResult{};
+    ASSERT_TRUE(inOrderTrainer.train(linReg, trainIn(), trainOut(), &inOrderResult));
+    EXPECT_LT(5U * result.epochCount, inOrderResult.epochCount);
+}
+
+/**
+ * @brief Full batch test.
+ *
+ *        Verify that a batch holding the entire training set performs one gradient descent
+ *        step per epoch with the mean gradient.
+ */
+TEST(Ml_Trainer, FullBatch)
+{
+    TrainConfig config{};
+    config.epochCount   = 1U;
+    config.batchSize    = 100U;
+    config.learningRate = 0.5;
+    Trainer trainer{config};
+
+    // Starting from zero, the errors equal the outputs, hence the step is the mean of y * x
+    // for the weight and the mean of y for the bias.
+    double meanInOut{};
+    double meanOut{};
+    for (std::size_t i{}; i < trainIn().size(); ++i)
+    {
+        meanInOut += trainIn()[i] * trainOut()[i] / trainIn().size();
+        meanOut   += trainOut()[i] / trainIn().size();
+    }
+    lin_reg::Fixed linReg{};
+    TrainResult result{};
+    ASSERT_TRUE(trainer.train(linReg, trainIn(), trainOut(), &result));
+
+    EXPECT_NEAR(config.learningRate * meanInOut, linReg.weight(), 1e-9);
+    EXPECT_NEAR(config.learningRate * meanOut, linReg.bias(), 1e-9);
+    EXPECT_EQ(1U, result.epochCount);
+    EXPECT_FALSE(result.converged);
+}
+
+/**
+ * @brief Reproducibility test.
+ *
+ *        Verify that training runs with the same seed yield the same parameters, while
+ *        another seed yields another order and hence other parameters.
+ */
+TEST(Ml_Trainer, Reproducible)
+{
+    auto config{miniBatchConfig()};
+    config.epochCount = 3U;
+    config.targetLoss = 0.0;
+    Trainer trainer{config};
+
+    lin_reg::Fixed first{};
+    lin_reg::Fixed second{};
+    ASSERT_TRUE(trainer.train(first, trainIn(), trainOut()));
+    ASSERT_TRUE(trainer.train(second, trainIn(), trainOut()));
+    EXPECT_DOUBLE_EQ(first.weight(), second.weight());
+    EXPECT_DOUBLE_EQ(first.bias(), second.bias());
+
+    config.seed = 1234U;
+    Trainer otherTrainer{config};
+    lin_reg::Fixed other{};
+    ASSERT_TRUE(otherTrainer.train(other, trainIn(), trainOut()));
+    EXPECT_NE(first.weight(), other.weight());
+}
+
+/**
+ * @brief Learning rate schedule test.
+ *
+ *        Verify that the learning rate decays as configured, by decaying it to almost zero
+ *        so that the parameters stop changing.
+ */
+TEST(Ml_Trainer, Schedule)
+{
+    TrainConfig config{};
+    config.batchSize    = 15U;
+    config.learningRate = 0.5;
+    config.decay        = 1e-12;
+
+    const auto train{[&config](const std::size_t epochCount) noexcept
+    {
+        config.epochCount = epochCount;
+        Trainer trainer{config};
+        lin_reg::Fixed linReg{};
+        EXPECT_TRUE(trainer.train(linReg, trainIn(), trainOut()));
+        return linReg.weight();
+    }};
+
+    // Case 1 - Exponential decay, only the first epoch changes the parameters.
+    config.schedule = Schedule::Exponential;
+    EXPECT_NEAR(train(1U), train(5U), 1e-6);
+
+    // Case 2 - Step decay every other epoch, only the first two epochs change the parameters.
+    config.schedule   = Schedule::Step;
+    config.stepEpochs = 2U;
+    EXPECT_GT(std::abs(train(2U) - train(1U)), 1.0);
+    EXPECT_NEAR(train(2U), train(5U), 1e-6);
+
+    // Case 3 - Inverse time decay, the parameters keep changing.
+    config.schedule = Schedule::InverseTime;
+    config.decay    = 1.0;
+    EXPECT_GT(std::abs(train(5U) - train(1U)), 1.0);
+
+    // Case 4 - Constant learning rate, the decay is ignored.
+    config.schedule = Schedule::Constant;
+    config.decay    = 1e-12;
+    EXPECT_GT(std::abs(train(5U) - train(1U)), 1.0);
+}
+
+/**
+ * @brief Epoch callback test.
+ *
+ *        Verify that the loss is reported after each epoch and decreases during training.
+ */
+TEST(Ml_Trainer, EpochCallback)
+{
+    auto config{miniBatchConfig()};
+    config.epochCount = 10U;
+    config.targetLoss = 0.0;
+    EpochLog log{};
+    Trainer trainer{config, logEpoch, &log};
+
+    lin_reg::Fixed linReg{};
+    TrainResult result{};
+    ASSERT_TRUE(trainer.train(linReg, trainIn(), trainOut(), &result));
+
+    EXPECT_EQ(config.epochCount, log.epochCount);
+    EXPECT_EQ(config.epochCount, log.lastEpoch);
+    EXPECT_EQ(config.epochCount, result.epochCount);
+    EXPECT_DOUBLE_EQ(result.loss, log.lastLoss);
+    EXPECT_LT(log.lastLoss, log.firstLoss);
+    EXPECT_FALSE(result.converged);
+}
+
+/**
+ * @brief Polynomial training test.
+ *
+ *        Verify that the coefficients of a polynomial model can be trained.
+ */
+TEST(Ml_Trainer, Polynomial)
+{
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (std::size_t i{}; i <= 10U; ++i)
+    {
+        const double input{i * 0.1};
+        trainIn.pushBack(input);
+        trainOut.pushBack(2.0 * input * input - input + 1.0);
+    }
+    TrainConfig config{};
+    config.epochCount   = 10000U;
+    config.batchSize    = 4U;
+    config.learningRate = 0.5;
+    config.targetLoss   = 1e-6;
+    config.shuffle      = true;
+    Trainer trainer{config};
+
+    lin_reg::Polynomial<2U> polynomial{};
+    TrainResult result{};
+    ASSERT_TRUE(trainer.train(polynomial, trainIn, trainOut, &result));
+    EXPECT_TRUE(polynomial.isTrained());
+    EXPECT_TRUE(result.converged);
+    EXPECT_NEAR(1.0, polynomial.predict(0.0), 0.01);
+    EXPECT_NEAR(2.0, polynomial.predict(1.0), 0.01);
+}
+
+/**
+ * @brief Invalid configuration test.
+ *
+ *        Verify that the model doesn't get trained if the configuration or data is invalid.
+ */
+TEST(Ml_Trainer, InvalidConfig)
+{
+    const auto expectInvalid{[](const TrainConfig& config) noexcept
+    {
+        Trainer trainer{config};
+        EXPECT_FALSE(trainer.isConfigValid());
+        lin_reg::Fixed linReg{};
+        EXPECT_FALSE(trainer.train(linReg, trainIn(), trainOut()));
+        EXPECT_FALSE(linReg.isTrained());
+    }};
+
+    // Case 1 - Invalid epoch count, batch size and learning rates.
+    {
+        TrainConfig config{};
+        config.epochCount = 0U;
+        expectInvalid(config);
+    }
+    {
+        TrainConfig config{};
+        config.batchSize = 0U;
+        expectInvalid(config);
+    }
+    for (const auto learningRate : {-0.5, 0.0, 1.5})
+    {
+        TrainConfig config{};
+        config.learningRate = learningRate;
+        expectInvalid(config);
+    }
+
+    // Case 2 - Invalid schedules and target loss.
+    {
+        TrainConfig config{};
+        config.schedule = Schedule::Exponential;
+        config.decay    = 0.0;
+        expectInvalid(config);
+    }
+    {
+        TrainConfig config{};
+        config.schedule   = Schedule::Step;
+        config.stepEpochs = 0U;
+        expectInvalid(config);
+    }
+    {
+        TrainConfig config{};
+        config.schedule = Schedule::InverseTime;
+        config.decay    = -1.0;
+        expectInvalid(config);
+    }
+    {
+        TrainConfig config{};
+        config.targetLoss = -1.0;
+        expectInvalid(config);
+    }
+
+    // Case 3 - No training sets.
+    {
+        Trainer trainer{TrainConfig{}};
+        lin_reg::Fixed linReg{};
+        EXPECT_FALSE(trainer.train(linReg, Matrix1d{}, trainOut()));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,291 @@
+/**
+ * @brief Unit tests for the cooperative task scheduler.
+ */
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "driver/clock/stub.h"
+#include "driver/watchdog/stub.h"
+#include "scheduler/scheduler.h"
+#include "scheduler/task.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+/**
+ * @brief Context of a test task.
+ */
+struct TaskContext
+{
+    /** Simulated clock to advance when the task is run. */
+    driver::clock::Stub& clock;
+
+    /** Simulated run time of the task in microseconds. */
+    std::uint32_t runTime_us;
+
+    /** Task identifier, logged when the task is run. */
+    int id;
+
+    /** Log of the identifiers of the run tasks, shared between tasks. */
+    std::vector<int>& log;
+};
+
+// -----------------------------------------------------------------------------
+void runTestTask(void* context) noexcept
+{
+    auto& task{*static_cast<TaskContext*>(context)};
+    task.log.push_back(task.id);
+    task.clock.advance_us(task.runTime_us);
+}
+
+// -----------------------------------------------------------------------------
+void runUntil(Scheduler& scheduler, driver::clock::Stub& clock, const std::uint32_t end_ms,
+              const std::uint32_t step_us = 100U) noexcept
+{
+    // Run the scheduler while advancing the simulated time in small steps.
+    while (clock.micros() < end_ms * 1000U)
+    {
+        while (scheduler.run()) {}
+        clock.advance_us(step_us);
+    }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, AddRemove)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext context{clock, 0U, 1, log};
+
+    Task task{runTestTask, &context, 10U};
+    Task invalidTask{runTestTask, &context, 0U};
+    Task nullTask{nullptr, nullptr, 10U};
+
+    EXPECT_TRUE(scheduler.add(task));
+    EXPECT_TRUE(task.isEnabled());
+    EXPECT_FALSE(scheduler.add(task));
+    EXPECT_FALSE(scheduler.add(invalidTask));
+    EXPECT_FALSE(scheduler.add(nullTask));
+    EXPECT_EQ(scheduler.taskCount(), 1U);
+
+    // Nothing shall be run before the task is due.
+    EXPECT_FALSE(scheduler.run());
+    clock.advance_us(10000U);
+    EXPECT_TRUE(scheduler.run());
+    EXPECT_EQ(task.runCount(), 1U);
+
+    scheduler.remove(task);
+    EXPECT_EQ(scheduler.taskCount(), 0U);
+    EXPECT_FALSE(task.isEnabled());
+    clock.advance_us(10000U);
+    EXPECT_FALSE(scheduler.run());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, PeriodLimit)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext context{clock, 0U, 1, log};
+    constexpr std::uint32_t max_ms{Task::MaxPeriod_ms};
+
+    // Periods and deadlines above the limit would wrap or be seen as overdue, expect rejection.
+    Task longPeriod{runTestTask, &context, max_ms + 1U};
+    Task longDeadline{runTestTask, &context, 10U, 0U, Task::Mode::Periodic, max_ms + 1U};
+    Task wrappingPeriod{runTestTask, &context, UINT32_MAX / 1000U + 1U};
+    EXPECT_FALSE(scheduler.add(longPeriod));
+    EXPECT_FALSE(scheduler.add(longDeadline));
+    EXPECT_FALSE(scheduler.add(wrappingPeriod));
+    EXPECT_EQ(scheduler.taskCount(), 0U);
+
+    // A task with the max period and deadline shall only run once the period has elapsed.
+    Task task{runTestTask, &context, max_ms, 0U, Task::Mode::Periodic, max_ms};
+    EXPECT_TRUE(scheduler.add(task));
+    EXPECT_EQ(task.period_ms(), max_ms);
+    EXPECT_FALSE(scheduler.run());
+    clock.advance_us(max_ms * 1000U - 1U);
+    EXPECT_FALSE(scheduler.run());
+    clock.advance_us(1U);
+    EXPECT_TRUE(scheduler.run());
+    EXPECT_EQ(task.runCount(), 1U);
+    EXPECT_EQ(task.deadlineMissCount(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, PeriodicAndOneShot)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext periodicContext{clock, 50U, 1, log};
+    TaskContext oneShotContext{clock, 50U, 2, log};
+
+    Task periodic{runTestTask, &periodicContext, 10U};
+    Task oneShot{runTestTask, &oneShotContext, 25U, 0U, Task::Mode::OneShot};
+    scheduler.add(periodic);
+    scheduler.add(oneShot);
+
+    // The periodic task shall run every 10 ms without drift, the one-shot task once.
+    runUntil(scheduler, clock, 1000U);
+    EXPECT_EQ(periodic.runCount(), 99U);
+    EXPECT_EQ(oneShot.runCount(), 1U);
+    EXPECT_FALSE(oneShot.isEnabled());
+
+    // Restart the one-shot task, expect it to run once more.
+    scheduler.restart(oneShot);
+    runUntil(scheduler, clock, 1100U);
+    EXPECT_EQ(oneShot.runCount(), 2U);
+
+    // Stop the periodic task, expect it to not run anymore.
+    const std::uint32_t runCount{periodic.runCount()};
+    scheduler.stop(periodic);
+    runUntil(scheduler, clock, 1200U);
+    EXPECT_EQ(periodic.runCount(), runCount);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, PriorityOrder)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext lowContext{clock, 0U, 3, log};
+    TaskContext midContext{clock, 0U, 2, log};
+    TaskContext highContext{clock, 0U, 1, log};
+    TaskContext sameContext{clock, 0U, 4, log};
+
+    // Add the tasks in reverse priority order, all due at the same time.
+    Task low{runTestTask, &lowContext, 10U, 2U};
+    Task mid{runTestTask, &midContext, 10U, 1U};
+    Task high{runTestTask, &highContext, 10U, 0U};
+    Task same{runTestTask, &sameContext, 10U, 1U};
+    scheduler.add(low);
+    scheduler.add(mid);
+    scheduler.add(high);
+    scheduler.add(same);
+
+    // Expect one task per call, in priority order, tasks of the same priority in the order
+    // they were added.
+    clock.advance_us(10000U);
+    while (scheduler.run()) {}
+    EXPECT_EQ(log, (std::vector<int>{1, 2, 4, 3}));
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, RunTimeAccounting)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext context{clock, 200U, 1, log};
+
+    Task task{runTestTask, &context, 10U};
+    scheduler.add(task);
+    EXPECT_EQ(task.averageRunTime_us(), 0U);
+
+    // Run the task twice with 200 us run time, then twice with 800 us run time.
+    runUntil(scheduler, clock, 25U);
+    context.runTime_us = 800U;
+    runUntil(scheduler, clock, 45U);
+
+    EXPECT_EQ(task.runCount(), 4U);
+    EXPECT_EQ(task.maxRunTime_us(), 800U);
+    EXPECT_EQ(task.averageRunTime_us(), 500U);
+    EXPECT_EQ(task.deadlineMissCount(), 0U);
+
+    task.resetStats();
+    EXPECT_EQ(task.runCount(), 0U);
+    EXPECT_EQ(task.maxRunTime_us(), 0U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, DeadlineMiss)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext context{clock, 1500U, 1, log};
+
+    // A run time of 1.5 ms exceeds the 1 ms deadline.
+    Task task{runTestTask, &context, 10U, 0U, Task::Mode::Periodic, 1U};
+    scheduler.add(task);
+    runUntil(scheduler, clock, 35U);
+    EXPECT_EQ(task.runCount(), 3U);
+    EXPECT_EQ(task.deadlineMissCount(), 3U);
+
+    // An overrun longer than the period shall skip the elapsed periods instead of catching up,
+    // i.e. a run from 40 ms to 65 ms shall be followed by a run at 70 ms.
+    context.runTime_us = 25000U;
+    runUntil(scheduler, clock, 41U);
+    EXPECT_EQ(task.runCount(), 4U);
+    context.runTime_us = 100U;
+    runUntil(scheduler, clock, 69U);
+    EXPECT_EQ(task.runCount(), 4U);
+    runUntil(scheduler, clock, 71U);
+    EXPECT_EQ(task.runCount(), 5U);
+    EXPECT_EQ(task.deadlineMissCount(), 4U);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Scheduler, WatchdogCheckIn)
+{
+    driver::clock::Stub clock{};
+    driver::watchdog::Stub watchdog{};
+    Scheduler scheduler{clock, watchdog};
+    std::vector<int> log{};
+    TaskContext highContext{clock, 100U, 1, log};
+    TaskContext lowContext{clock, 100U, 2, log};
+
+    Task high{runTestTask, &highContext, 10U, 0U};
+    Task low{runTestTask, &lowContext, 50U, 1U};
+    scheduler.add(high);
+    scheduler.add(low);
+
+    // Expect the watchdog to be reset as long as all tasks check in.
+    runUntil(scheduler, clock, 200U);
+    EXPECT_TRUE(scheduler.allTasksCheckedIn());
+    EXPECT_LT(0U, watchdog.resetCount());
+    EXPECT_LT(0U, low.runCount());
+
+    // Simulate that the main loop gets stuck for 150 ms, which starves the tasks. Expect the
+    // watchdog to not be reset after the high priority task is run, since the low priority 
+    // task hasn't checked in within its period plus its deadline.
+    const std::uint32_t lowRunCount{low.runCount()};
+    std::uint32_t resetCount{watchdog.resetCount()};
+    clock.advance_us(150000U);
+    EXPECT_FALSE(scheduler.allTasksCheckedIn());
+
+    EXPECT_TRUE(scheduler.run());
+    EXPECT_EQ(low.runCount(), lowRunCount);
+    EXPECT_EQ(watchdog.resetCount(), resetCount);
+
+    // Expect the watchdog to be reset again once the low priority task has checked in.
+    EXPECT_TRUE(scheduler.run());
+    EXPECT_EQ(low.runCount(), lowRunCount + 1U);
+    EXPECT_TRUE(scheduler.allTasksCheckedIn());
+    EXPECT_EQ(watchdog.resetCount(), resetCount + 1U);
+
+    // Stopped tasks don't need to check in.
+    resetCount = watchdog.resetCount();
+    scheduler.stop(low);
+    clock.advance_us(150000U);
+    EXPECT_TRUE(scheduler.run());
+    EXPECT_EQ(watchdog.resetCount(), resetCount + 1U);
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
@@ -0,0 +1,344 @@
+#!/usr/bin/env python3
+"""Host-side trainer for the quantized neural networks of ml::nn.
+
+    This script:
+        1. Reads training data from a CSV file (input columns followed by output columns), or
+           generates the calibration curve of an NTC thermistor if no file is given.
+        2. Trains a fully-connected network with ReLU hidden layers and a linear output layer
+           in floating-point, with full-batch Adam on normalized data.
+        3. Quantizes the weights to int8 or int16 with power-of-two scales per layer.
+        4. Runs the quantized network exactly like ml::nn::Network and reports its error.
+        5. Exports the scaling and the layers as a constexpr header for ml::nn::Network.
+
+    Only the Python standard library is used, and training is seeded, hence the same arguments
+    always export the same header.
+
+    Example usage:
+
+                        python3 nn_export.py --hidden 8,8 --weights int8 \\
+                            --namespace thermistor --output ../ml/nn/thermistor_model.h
+"""
+
+import argparse
+import csv
+import math
+import random
+import sys
+
+# Fractional bits of the activations, see ml::nn::ActivationFracBits.
+ACTIVATION_FRAC_BITS = 10
+
+# Range of the activations (int16_t).
+ACTIVATION_MIN, ACTIVATION_MAX = -32768, 32767
+
+# Range of the weights per weight type.
+WEIGHT_LIMITS = {"int8": 127, "int16": 32767}
+
+# Maximum number of fractional bits of the weights, so that the biases fit comfortably.
+MAX_WEIGHT_FRAC_BITS = 14
+
+# Range of the biases, see ml::nn::BiasLimit.
+BIAS_LIMIT = 2**30
+
+# Maximum number of inputs of a layer with int8 weights, see ml::nn::Accumulator.
+MAX_INT8_INPUTS = 255
+
+
+def thermistor_data(count: int = 61) -> tuple:
+    """Generate the voltage of a 10k NTC thermistor (B = 3950) below a 10k resistor at 5 V
+    for temperatures from -20 to 100 degrees Celsius."""
+    inputs, outputs = [], []
+    for i in range(count):
+        temp = -20.0 + 120.0 * i / (count - 1)
+        resistance = 10e3 * math.exp(3950.0 * (1.0 / (temp + 273.15) - 1.0 / 298.15))
+        inputs.append([5.0 * resistance / (resistance + 10e3)])
+        outputs.append([temp])
+    return inputs, outputs
+
+
+def read_csv(path: str, input_count: int) -> tuple:
+    """Read training data from a CSV file, lines starting with '#' are ignored."""
+    inputs, outputs = [], []
+    with open(path, newline="") as file:
+        for row in csv.reader(file):
+            if not row or row[0].lstrip().startswith("#"):
+                continue
+            values = [float(value) for value in row]
+            inputs.append(values[:input_count])
+            outputs.append(values[input_count:])
+    if not inputs or not outputs[0]:
+        raise ValueError(f"no training data in {path}")
+    return inputs, outputs
+
+
+def scaling(columns: list) -> tuple:
+    """Get offsets and scales normalizing each column to [-1, 1]."""
+    offsets, scales = [], []
+    for column in columns:
+        low, high = min(column), max(column)
+        offsets.append((low + high) / 2.0)
+        scales.append(2.0 / (high - low) if high > low else 1.0)
+    return offsets, scales
+
+
+class Network:
+    """Floating-point fully-connected network with ReLU hidden layers and a linear output."""
+
+    def __init__(self, sizes: list, rng: random.Random):
+        # He initialization suits the ReLU activations.
+        self.weights = [[[rng.gauss(0.0, math.sqrt(2.0 / n_in)) for _ in range(n_in)]
+                         for _ in range(n_out)] for n_in, n_out in zip(sizes, sizes[1:])]
+        self.biases = [[0.0] * n_out for n_out in sizes[1:]]
+
+    def forward(self, inputs: list) -> list:
+        """Get the activations of each layer, starting with the inputs."""
+        activations = [inputs]
+        for index, (weights, biases) in enumerate(zip(self.weights, self.biases)):
+            hidden = index < len(self.weights) - 1
+            sums = [sum(w * x for w, x in zip(row, activations[-1])) + b
+                    for row, b in zip(weights, biases)]
+            activations.append([max(0.0, s) for s in sums] if hidden else sums)
+        return activations
+
+    def train(self, inputs: list, outputs: list, epochs: int, rate: float,
+              frozen: int = 0) -> float:
+        """Train the network with full-batch Adam, return the final mean squared error.
+        The weights of the given number of leading layers are frozen, the biases are not."""
+        params = self.weights + self.biases
+        moments = [[0.0] * len(flatten(p)) for p in params]
+        velocities = [[0.0] * len(flatten(p)) for p in params]
+        beta1, beta2, epsilon = 0.9, 0.999, 1e-8
+        loss = 0.0
+
+        for epoch in range(1, epochs + 1):
+            grad_w = [[[0.0] * len(row) for row in layer] for layer in self.weights]
+            grad_b = [[0.0] * len(layer) for layer in self.biases]
+            loss = 0.0
+
+            for x, y in zip(inputs, outputs):
+                activations = self.forward(x)
+                deltas = [a - t for a, t in zip(activations[-1], y)]
+                loss += sum(d * d for d in deltas)
+
+                # Backpropagate the errors layer by layer.
+                for layer in reversed(range(len(self.weights))):
+                    previous = activations[layer]
+                    for j, delta in enumerate(deltas):
+                        grad_b[layer][j] += delta
+                        row = grad_w[layer][j]
+                        for k, a in enumerate(previous):
+                            row[k] += delta * a
+                    if layer > 0:
+                        deltas = [sum(self.weights[layer][j][k] * deltas[j]
+                                      for j in range(len(deltas))) if previous[k] > 0.0 else 0.0
+                                  for k in range(len(previous))]
+
+            count = float(len(inputs))
+            grads = grad_w + grad_b
+            for index, (param, grad) in enumerate(zip(params, grads)):
+                if index < frozen:
+                    continue
+                values, gradients = flatten(param), flatten(grad)
+                m, v = moments[index], velocities[index]
+                for i, g in enumerate(gradients):
+                    g /= count
+                    m[i] = beta1 * m[i] + (1.0 - beta1) * g
+                    v[i] = beta2 * v[i] + (1.0 - beta2) * g * g
+                    m_hat = m[i] / (1.0 - beta1**epoch)
+                    v_hat = v[i] / (1.0 - beta2**epoch)
+                    values[i] -= rate * m_hat / (math.sqrt(v_hat) + epsilon)
+                unflatten(param, values)
+            loss /= count
+        return loss
+
+
+def flatten(values: list) -> list:
+    """Flatten a vector or a matrix."""
+    return [v for row in values for v in row] if isinstance(values[0], list) else list(values)
+
+
+def unflatten(target: list, values: list):
+    """Write flattened values back into a vector or a matrix."""
+    if isinstance(target[0], list):
+        width = len(target[0])
+        for i, row in enumerate(target):
+            row[:] = values[i * width:(i + 1) * width]
+    else:
+        target[:] = values
+
+
+def quantize_layer(weights: list, biases: list, weight_type: str) -> tuple:
+    """Quantize a layer with the largest power-of-two scale fitting the weight type."""
+    limit = WEIGHT_LIMITS[weight_type]
+    largest = max(abs(w) for row in weights for w in row)
+    frac_bits = MAX_WEIGHT_FRAC_BITS if largest == 0.0 else \
+        max(0, min(MAX_WEIGHT_FRAC_BITS, math.floor(math.log2(limit / largest))))
+
+    while True:
+        q_weights = [[max(-limit, min(limit, round(w * 2**frac_bits))) for w in row]
+                     for row in weights]
+        q_biases = [round(b * 2**(ACTIVATION_FRAC_BITS + frac_bits)) for b in biases]
+
+        # Make sure the biases fit, so that the accumulators can't overflow.
+        if max(abs(b) for b in q_biases) <= BIAS_LIMIT or frac_bits == 0:
+            return q_weights, q_biases, frac_bits
+        frac_bits -= 1
+
+
+def activate(value: int, frac_bits: int, relu: bool) -> int:
+    """Convert a weighted sum to an activation, see ml::nn::activate()."""
+    half = 1 << (frac_bits - 1) if frac_bits > 0 else 0
+    value = (value + half) >> frac_bits
+    if relu and value < 0:
+        return 0
+    return max(ACTIVATION_MIN, min(ACTIVATION_MAX, value))
+
+
+def quantize_input(value: float, offset: float, scale: float) -> int:
+    """Normalize and quantize an input, see ml::nn::Network::quantizeInput()."""
+    normalized = (value - offset) * scale * 2**ACTIVATION_FRAC_BITS
+    rounded = math.floor(normalized + 0.5) if normalized >= 0.0 else math.ceil(normalized - 0.5)
+    return max(ACTIVATION_MIN, min(ACTIVATION_MAX, rounded))
+
+
+def predict_quantized(layers: list, inputs: list) -> list:
+    """Run the quantized network like ml::nn::Network::predictQuantized()."""
+    activations = inputs
+    for index, (weights, biases, frac_bits) in enumerate(layers):
+        relu = index < len(layers) - 1
+        activations = [activate(sum(w * a for w, a in zip(row, activations)) + b, frac_bits, relu)
+                       for row, b in zip(weights, biases)]
+    return activations
+
+
+def format_values(values: list, indent: int, width: int = 100) -> str:
+    """Format values separated by commas, wrapped at the given width."""
+    lines, line = [], ""
+    for value in (str(v) for v in values):
+        candidate = f"{line}, {value}" if line else value
+        if line and indent + len(candidate) + 2 > width:
+            lines.append(line + ",")
+            line = value
+        else:
+            line = candidate
+    lines.append(line)
+    return ("\n" + " " * indent).join(lines)
+
+
+def export_header(args, sizes: list, layers: list, in_scaling: tuple, out_scaling: tuple,
+                  max_error: float) -> str:
+    """Generate the constexpr header holding the scaling and the layers."""
+    weight_type = f"{args.weights}_t"
+    topology = "-".join(str(size) for size in sizes)
+    names = [f"Layer{index}" for index in range(len(layers))]
+    text = [
+        "/**",
+        f" * @brief Neural network {args.namespace}::Model exported by nn_export.py, don't edit.",
+        " *",
+        f" *        Topology {topology}, {args.weights} weights, "
+        f"maximum training error {max_error:.3g}.",
+        " */",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        '#include "ml/nn/network.h"',
+        "",
+        f"namespace {args.namespace}",
+        "{",
+        "/** Scaling of the inputs and outputs. */",
+        f"constexpr ml::nn::Scaling<{sizes[0]}U, {sizes[-1]}U> Scaling{{",
+    ]
+    for values, last in ((in_scaling[0], False), (in_scaling[1], False),
+                         (out_scaling[0], False), (out_scaling[1], True)):
+        text.append("    {" + format_values([repr(v) for v in values], 5) + "}" +
+                    ("};" if last else ","))
+
+    for index, (weights, biases, frac_bits) in enumerate(layers):
+        activation = "Relu" if index < len(layers) - 1 else "Linear"
+        text += [
+            "",
+            f"/** Layer {index}, {len(weights[0])} inputs and {len(weights)} outputs. */",
+            f"constexpr ml::nn::Dense<{weight_type}, {len(weights[0])}U, {len(weights)}U> "
+            f"{names[index]}{{",
+            "    {",
+        ]
+        text += ["        {" + format_values(row, 9) + "}," for row in weights]
+        text += [
+            "    },",
+            "    {" + format_values(biases, 5) + "},",
+            f"    {frac_bits}U,",
+            f"    ml::nn::Activation::{activation}}};",
+        ]
+    text += [
+        "",
+        "/** The network. */",
+        f"using Model = ml::nn::Network<Scaling, {', '.join(names)}>;",
+        f"}} // namespace {args.namespace}",
+        "",
+    ]
+    return "\n".join(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Train and export a network for ml::nn.")
+    parser.add_argument("csv", nargs="?", help="training data, default thermistor curve")
+    parser.add_argument("--inputs", type=int, default=1, help="number of input columns")
+    parser.add_argument("--hidden", default="8,8", help="hidden layer sizes, e.g. 8,8")
+    parser.add_argument("--weights", choices=sorted(WEIGHT_LIMITS), default="int8")
+    parser.add_argument("--epochs", type=int, default=2000)
+    parser.add_argument("--rate", type=float, default=0.02, help="Adam learning rate")
+    parser.add_argument("--fine-tune", type=int, default=500,
+                        help="epochs to fine-tune after quantizing each layer")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--namespace", default="model")
+    parser.add_argument("--output", help="header to write, default standard output")
+    args = parser.parse_args()
+
+    inputs, outputs = read_csv(args.csv, args.inputs) if args.csv else thermistor_data()
+    in_scaling = scaling(list(zip(*inputs)))
+    out_scaling = scaling(list(zip(*outputs)))
+    normalize = lambda rows, offsets, scales: [[(v - o) * s for v, o, s in zip(row, offsets, scales)]
+                                               for row in rows]
+    norm_inputs = normalize(inputs, *in_scaling)
+    norm_outputs = normalize(outputs, *out_scaling)
+
+    sizes = [len(inputs[0])] + [int(size) for size in args.hidden.split(",") if size] + \
+        [len(outputs[0])]
+    if args.weights == "int8" and max(sizes[:-1]) > MAX_INT8_INPUTS:
+        parser.error(f"layers with int8 weights must have at most {MAX_INT8_INPUTS} inputs")
+    network = Network(sizes, random.Random(args.seed))
+    loss = network.train(norm_inputs, norm_outputs, args.epochs, args.rate)
+
+    # Quantize the layers one by one, and fine-tune the remaining parameters after each layer,
+    # so that they compensate the rounding of the weights.
+    layers = []
+    for index in range(len(network.weights)):
+        weights, _, frac_bits = quantize_layer(network.weights[index], network.biases[index],
+                                               args.weights)
+        network.weights[index] = [[w / 2**frac_bits for w in row] for row in weights]
+        loss = network.train(norm_inputs, norm_outputs, args.fine_tune, args.rate / 4.0, index + 1)
+    layers = [quantize_layer(w, b, args.weights) for w, b in zip(network.weights, network.biases)]
+
+    # Report the error of the quantized network in output units.
+    max_error = 0.0
+    for x, y in zip(inputs, outputs):
+        quantized = [quantize_input(v, o, s) for v, o, s in zip(x, *in_scaling)]
+        predicted = predict_quantized(layers, quantized)
+        for p, t, offset, scale in zip(predicted, y, *out_scaling):
+            max_error = max(max_error, abs(offset + p / 2**ACTIVATION_FRAC_BITS / scale - t))
+    print(f"Normalized training MSE {loss:.3g}, maximum quantized error {max_error:.3g}",
+          file=sys.stderr)
+
+    # The header restores the outputs by multiplication, hence invert the output scales.
+    out_scaling = (out_scaling[0], [1.0 / scale for scale in out_scaling[1]])
+    header = export_header(args, sizes, layers, in_scaling, out_scaling, max_error)
+    if args.output:
+        with open(args.output, "w") as file:
+            file.write(header)
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == "__main__":
+    main()
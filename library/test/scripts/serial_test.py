@@ -8,11 +8,222 @@
         4. Send command strings to control program flow.
         5. Verify correct responses from the microcontroller.
 
+    Binary telemetry sent via telemetry::Channel is decoded when the script is started with
+    the --binary flag. Each frame is COBS encoded and terminated by a zero byte:
+
+        | Type (1 byte) | Sequence (1 byte) | Payload (1-4 bytes, little endian) | CRC-16 (2 bytes) |
+
+    The CRC-16/CCITT-FALSE checksum (big endian) covers the type, sequence and payload.
+
     Use the pyserial library, install with the following command:
-    
+
                         pip install pyserial
 
-TODO: Implement functionality according to project requirements.
+    Example usage:
+
+                        python3 serial_test.py /dev/ttyACM0 --baud 9600 --binary
+
+TODO: Implement remaining functionality according to project requirements.
 """
 
-# TODO Add your implementation here!
+import argparse
+import datetime
+import struct
+import sys
+from collections import namedtuple
+
+# Frame delimiter.
+DELIMITER = 0x00
+
+# Record types, see telemetry::RecordType.
+RECORD_TEMPERATURE = 0x01
+RECORD_TIMESTAMP = 0x02
+RECORD_EVENT = 0x03
+
+# Payload format of each record type, see telemetry::Channel.
+PAYLOAD_FORMATS = {
+    RECORD_TEMPERATURE: "<h",
+    RECORD_TIMESTAMP: "<I",
+    RECORD_EVENT: "<B",
+}
+
+# Event names, see telemetry::EventCode.
+EVENT_NAMES = {
+    0x01: "SystemStarted",
+    0x02: "InitFailed",
+    0x03: "ToggleTimerEnabled",
+    0x04: "ToggleTimerDisabled",
+    0x05: "WatchdogReset",
+}
+
+# Decoded telemetry record.
+Record = namedtuple("Record", ["type", "sequence", "value"])
+
+
+def crc16(data: bytes, crc: int = 0xFFFF) -> int:
+    """Compute the CRC-16/CCITT-FALSE checksum (polynomial 0x1021) of the given data."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data: bytes) -> bytes:
+    """COBS encode the given data, the delimiter isn't appended."""
+    output = bytearray([0])
+    code_index, code = 0, 1
+    for byte in data:
+        if byte != DELIMITER:
+            output.append(byte)
+            code += 1
+        if byte == DELIMITER or code == 0xFF:
+            output[code_index] = code
+            code_index, code = len(output), 1
+            output.append(0)
+    output[code_index] = code
+    return bytes(output)
+
+
+def cobs_decode(data: bytes) -> bytes:
+    """COBS decode the given data (excluding the delimiter), raise ValueError if invalid."""
+    output = bytearray()
+    index = 0
+    while index < len(data):
+        code = data[index]
+        index += 1
+        if code == DELIMITER or index + code - 1 > len(data):
+            raise ValueError("invalid COBS data")
+        block = data[index:index + code - 1]
+        if DELIMITER in block:
+            raise ValueError("invalid COBS data")
+        output += block
+        index += code - 1
+        if code != 0xFF and index < len(data):
+            output.append(DELIMITER)
+    return bytes(output)
+
+
+def encode_frame(record_type: int, sequence: int, value: int) -> bytes:
+    """Encode a record into a frame, including the delimiter."""
+    frame = bytes([record_type, sequence & 0xFF]) + struct.pack(PAYLOAD_FORMATS[record_type], value)
+    frame += struct.pack(">H", crc16(frame))
+    return cobs_encode(frame) + bytes([DELIMITER])
+
+
+def decode_frame(encoded: bytes) -> Record:
+    """Decode a frame (excluding the delimiter), raise ValueError if invalid."""
+    frame = cobs_decode(encoded)
+    if len(frame) <= 4:
+        raise ValueError("frame too short")
+    data, (crc,) = frame[:-2], struct.unpack(">H", frame[-2:])
+    if crc16(data) != crc:
+        raise ValueError("checksum mismatch")
+    record_type, sequence, payload = data[0], data[1], data[2:]
+    payload_format = PAYLOAD_FORMATS.get(record_type)
+    if payload_format is None or struct.calcsize(payload_format) != len(payload):
+        raise ValueError(f"invalid record type {record_type:#04x}")
+    (value,) = struct.unpack(payload_format, payload)
+    return Record(record_type, sequence, value)
+
+
+class FrameDecoder:
+    """Split a byte stream into frames and decode them, counting lost and invalid frames."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.error_count = 0
+        self.lost_count = 0
+        self.next_sequence = None
+
+    def feed(self, data: bytes) -> list:
+        """Feed received bytes, return the records decoded so far."""
+        records = []
+        for byte in data:
+            if byte != DELIMITER:
+                self.buffer.append(byte)
+                continue
+            if self.buffer:
+                try:
+                    record = decode_frame(bytes(self.buffer))
+                    if self.next_sequence is not None:
+                        self.lost_count += (record.sequence - self.next_sequence) & 0xFF
+                    self.next_sequence = (record.sequence + 1) & 0xFF
+                    records.append(record)
+                except ValueError:
+                    self.error_count += 1
+            self.buffer.clear()
+        return records
+
+
+def format_record(record: Record) -> str:
+    """Format the given record as a human-readable string."""
+    if record.type == RECORD_TEMPERATURE:
+        return f"[{record.sequence:3}] Temperature: {record.value} Celsius"
+    if record.type == RECORD_TIMESTAMP:
+        return f"[{record.sequence:3}] Timestamp: {record.value} ms"
+    name = EVENT_NAMES.get(record.value, f"Unknown ({record.value:#04x})")
+    return f"[{record.sequence:3}] Event: {name}"
+
+
+def self_test() -> bool:
+    """Verify the decoder against frames encoded like telemetry::Channel does."""
+    stream = (encode_frame(RECORD_TEMPERATURE, 0, -12) + encode_frame(RECORD_TIMESTAMP, 1, 0x00FF0100)
+              + encode_frame(RECORD_EVENT, 2, 0x03))
+    corrupt = bytearray(encode_frame(RECORD_TEMPERATURE, 4, 25))
+    corrupt[2] ^= 0x10
+    decoder = FrameDecoder()
+    records = decoder.feed(stream + bytes(corrupt) + encode_frame(RECORD_TEMPERATURE, 5, 26))
+    expected = [Record(RECORD_TEMPERATURE, 0, -12), Record(RECORD_TIMESTAMP, 1, 0x00FF0100),
+                Record(RECORD_EVENT, 2, 0x03), Record(RECORD_TEMPERATURE, 5, 26)]
+    return (crc16(b"123456789") == 0x29B1 and records == expected
+            and decoder.error_count == 1 and decoder.lost_count == 2)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Serial communication with the embedded system.")
+    parser.add_argument("port", nargs="?", help="serial port, for instance /dev/ttyACM0")
+    parser.add_argument("--baud", type=int, default=9600, help="baud rate in bps")
+    parser.add_argument("--binary", action="store_true", help="decode binary telemetry frames")
+    parser.add_argument("--log", help="file to log all received data to")
+    parser.add_argument("--self-test", action="store_true", help="test the telemetry decoder")
+    args = parser.parse_args()
+
+    if args.self_test:
+        passed = self_test()
+        print("Self test passed!" if passed else "Self test failed!")
+        return 0 if passed else 1
+    if args.port is None:
+        parser.error("a serial port is required unless --self-test is used")
+
+    import serial  # pyserial, only required when communicating with the device.
+
+    decoder = FrameDecoder()
+    log = open(args.log, "a", encoding="utf-8") if args.log else None
+    try:
+        with serial.Serial(args.port, args.baud, timeout=0.1) as device:
+            while True:
+                data = device.read(256)
+                if not data:
+                    continue
+                if args.binary:
+                    lines = [format_record(record) for record in decoder.feed(data)]
+                else:
+                    lines = [data.decode("ascii", errors="replace").rstrip("\r\n")]
+                for line in lines:
+                    stamped = f"{datetime.datetime.now().isoformat(timespec='milliseconds')} {line}"
+                    print(stamped)
+                    if log:
+                        log.write(stamped + "\n")
+    except KeyboardInterrupt:
+        if args.binary:
+            print(f"Invalid frames: {decoder.error_count}, lost frames: {decoder.lost_count}")
+    finally:
+        if log:
+            log.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
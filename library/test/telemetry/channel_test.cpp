@@ -0,0 +1,147 @@
+/**
+ * @brief Unit tests for the binary telemetry channel.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "driver/serial/stub.h"
+#include "telemetry/channel.h"
+
+#ifdef TESTSUITE
+
+namespace telemetry
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::vector<std::uint8_t> takeWrittenData(driver::serial::Stub& serial)
+{
+    const auto& buffer{serial.writeBuffer()};
+    std::vector<std::uint8_t> data(buffer.data(), buffer.data() + buffer.size());
+    serial.clearWriteBuffer();
+    return data;
+}
+
+// -----------------------------------------------------------------------------
+void loopback(driver::serial::Stub& serial)
+{
+    // Feed the written data back as received data.
+    const std::vector<std::uint8_t> data{takeWrittenData(serial)};
+    serial.appendReadBuffer(data.data(), static_cast<std::uint16_t>(data.size()));
+}
+
+/**
+ * @brief Telemetry loopback test.
+ * 
+ *        Verify that all record types survive a round trip through the serial device.
+ */
+TEST(Telemetry_Channel, Loopback)
+{
+    driver::serial::Stub serial{};
+    Channel channel{serial};
+
+    // Send one record of each type, including values containing zero bytes.
+    EXPECT_TRUE(channel.sendTemperature(-12));
+    EXPECT_TRUE(channel.sendTimestamp(0x00FF0100UL));
+    EXPECT_TRUE(channel.sendEvent(EventCode::ToggleTimerEnabled));
+    EXPECT_TRUE(channel.sendTemperature(0));
+    loopback(serial);
+
+    // Expect the records to be received in order with consecutive sequence numbers.
+    Record record{};
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(RecordType::Temperature, record.type);
+    EXPECT_EQ(0U, record.sequence);
+    EXPECT_EQ(-12, record.temperature_c);
+
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(RecordType::Timestamp, record.type);
+    EXPECT_EQ(1U, record.sequence);
+    EXPECT_EQ(0x00FF0100UL, record.timestamp_ms);
+
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(RecordType::Event, record.type);
+    EXPECT_EQ(2U, record.sequence);
+    EXPECT_EQ(EventCode::ToggleTimerEnabled, record.event);
+
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(RecordType::Temperature, record.type);
+    EXPECT_EQ(3U, record.sequence);
+    EXPECT_EQ(0, record.temperature_c);
+
+    // Expect no more records and no errors.
+    EXPECT_FALSE(channel.receive(record));
+    EXPECT_EQ(0U, channel.rxErrorCount());
+}
+
+/**
+ * @brief Telemetry corrupt frame test.
+ * 
+ *        Verify that corrupt frames are discarded and that the receiver resynchronizes at the
+ *        next frame.
+ */
+TEST(Telemetry_Channel, CorruptFrame)
+{
+    driver::serial::Stub serial{};
+    Channel channel{serial};
+
+    // Send two records, flip a bit in the first frame.
+    EXPECT_TRUE(channel.sendTemperature(25));
+    EXPECT_TRUE(channel.sendTemperature(26));
+    std::vector<std::uint8_t> data{takeWrittenData(serial)};
+    data[2U] ^= 0x10U;
+
+    // Prepend noise without delimiter to simulate connecting in the middle of a frame.
+    data.insert(data.begin(), {0x12U, 0x34U});
+    serial.appendReadBuffer(data.data(), static_cast<std::uint16_t>(data.size()));
+
+    // Expect only the second record to be received.
+    Record record{};
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(26, record.temperature_c);
+    EXPECT_EQ(1U, record.sequence);
+    EXPECT_EQ(1U, channel.rxErrorCount());
+    EXPECT_FALSE(channel.receive(record));
+
+    // Expect a frame without delimiter to not be received until the delimiter arrives.
+    EXPECT_TRUE(channel.sendEvent(EventCode::SystemStarted));
+    data = takeWrittenData(serial);
+    serial.appendReadBuffer(data.data(), static_cast<std::uint16_t>(data.size() - 1U));
+    EXPECT_FALSE(channel.receive(record));
+    serial.appendReadBuffer(&data.back(), 1U);
+    ASSERT_TRUE(channel.receive(record));
+    EXPECT_EQ(EventCode::SystemStarted, record.event);
+}
+
+/**
+ * @brief Telemetry bandwidth test.
+ * 
+ *        Verify that a temperature record takes up far less bandwidth than a text printout.
+ */
+TEST(Telemetry_Channel, Bandwidth)
+{
+    driver::serial::Stub serial{};
+    Channel channel{serial};
+
+    // Compare with "Temperature: 23 Celsius\n", where the new line is followed by a carriage return.
+    constexpr std::size_t textSize{25U};
+    EXPECT_TRUE(channel.sendTemperature(23));
+    const std::size_t frameSize{takeWrittenData(serial).size()};
+    EXPECT_GE(Channel::MaxEncodedFrameSize, frameSize);
+    EXPECT_LE(3U * frameSize, textSize);
+
+    // Print the number of samples per second for common baud rates (ten bits per byte).
+    for (const std::uint32_t baudRate_bps : {9600UL, 115200UL, 1000000UL})
+    {
+        std::printf("%7u bps: %6.0f text samples/s, %6.0f binary samples/s\n", 
+                    static_cast<unsigned>(baudRate_bps), baudRate_bps / (10.0 * textSize), 
+                    baudRate_bps / (10.0 * frameSize));
+    }
+}
+} // namespace
+} // namespace telemetry
+
+#endif /** TESTSUITE */
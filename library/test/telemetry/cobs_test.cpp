@@ -0,0 +1,109 @@
+/**
+ * @brief Unit tests for Consistent Overhead Byte Stuffing (COBS).
+ */
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "telemetry/cobs.h"
+
+#ifdef TESTSUITE
+
+namespace telemetry
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::vector<std::uint8_t> encode(const std::vector<std::uint8_t>& data)
+{
+    std::vector<std::uint8_t> encoded(cobs::maxEncodedSize(data.size()));
+    const std::uint16_t size{cobs::encode(data.data(), data.size(), 
+                                          encoded.data(), encoded.size())};
+    encoded.resize(size);
+    return encoded;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<std::uint8_t> decode(const std::vector<std::uint8_t>& encoded)
+{
+    std::vector<std::uint8_t> data(encoded.size());
+    const std::uint16_t size{cobs::decode(encoded.data(), encoded.size(), 
+                                          data.data(), data.size())};
+    data.resize(size);
+    return data;
+}
+
+/**
+ * @brief COBS encoding test.
+ * 
+ *        Verify that data is encoded according to the reference examples of the COBS paper.
+ */
+TEST(Telemetry_Cobs, Encode)
+{
+    using Bytes = std::vector<std::uint8_t>;
+
+    EXPECT_EQ((Bytes{0x01U, 0x01U}), encode(Bytes{0x00U}));
+    EXPECT_EQ((Bytes{0x01U, 0x01U, 0x01U}), encode(Bytes{0x00U, 0x00U}));
+    EXPECT_EQ((Bytes{0x03U, 0x11U, 0x22U, 0x02U, 0x33U}), encode(Bytes{0x11U, 0x22U, 0x00U, 0x33U}));
+    EXPECT_EQ((Bytes{0x05U, 0x11U, 0x22U, 0x33U, 0x44U}), encode(Bytes{0x11U, 0x22U, 0x33U, 0x44U}));
+    EXPECT_EQ((Bytes{0x02U, 0x11U, 0x01U, 0x01U, 0x01U}), encode(Bytes{0x11U, 0x00U, 0x00U, 0x00U}));
+
+    // Expect a new block after 254 non-zero bytes.
+    Bytes data(254U, 0xAAU);
+    const Bytes encoded{encode(data)};
+    ASSERT_EQ(256U, encoded.size());
+    EXPECT_EQ(0xFFU, encoded.front());
+    EXPECT_EQ(0x01U, encoded.back());
+
+    // Expect encoding to fail if the output buffer is too small.
+    std::uint8_t output[4U]{};
+    EXPECT_EQ(0U, cobs::encode(data.data(), 4U, output, sizeof(output)));
+}
+
+/**
+ * @brief COBS round-trip test.
+ * 
+ *        Verify that encoded data contains no zero bytes and is decoded to the original data.
+ */
+TEST(Telemetry_Cobs, RoundTrip)
+{
+    using Bytes = std::vector<std::uint8_t>;
+
+    for (std::uint16_t size{1U}; size < 600U; size += 37U)
+    {
+        Bytes data(size);
+        for (std::uint16_t i{}; i < size; ++i) { data[i] = static_cast<std::uint8_t>(i * 7U); }
+
+        const Bytes encoded{encode(data)};
+        ASSERT_FALSE(encoded.empty());
+        EXPECT_LE(encoded.size(), cobs::maxEncodedSize(size));
+
+        for (const auto& byte : encoded) { EXPECT_NE(cobs::Delimiter, byte); }
+        EXPECT_EQ(data, decode(encoded));
+    }
+}
+
+/**
+ * @brief COBS invalid data test.
+ * 
+ *        Verify that invalid encoded data is rejected.
+ */
+TEST(Telemetry_Cobs, InvalidData)
+{
+    using Bytes = std::vector<std::uint8_t>;
+
+    // Expect zero bytes and truncated blocks to be rejected.
+    EXPECT_TRUE(decode(Bytes{0x03U, 0x11U, 0x00U}).empty());
+    EXPECT_TRUE(decode(Bytes{0x05U, 0x11U, 0x22U}).empty());
+    EXPECT_TRUE(decode(Bytes{0x00U}).empty());
+
+    // Expect decoding to fail if the output buffer is too small.
+    const Bytes encoded{0x05U, 0x11U, 0x22U, 0x33U, 0x44U};
+    std::uint8_t output[3U]{};
+    EXPECT_EQ(0U, cobs::decode(encoded.data(), encoded.size(), output, sizeof(output)));
+}
+} // namespace
+} // namespace telemetry
+
+#endif /** TESTSUITE */
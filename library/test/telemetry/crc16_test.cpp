@@ -0,0 +1,59 @@
+/**
+ * @brief Unit tests for the CRC-16 checksum.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "telemetry/crc16.h"
+
+#ifdef TESTSUITE
+
+namespace telemetry
+{
+namespace
+{
+/**
+ * @brief CRC-16 check value test.
+ * 
+ *        Verify that the checksum matches the check value of CRC-16/CCITT-FALSE.
+ */
+TEST(Telemetry_Crc16, CheckValue)
+{
+    // The check value is the checksum of the ASCII string "123456789".
+    constexpr std::uint8_t data[]{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_EQ(0x29B1U, crc16::compute(data, sizeof(data)));
+
+    // Expect the initial value to be returned for empty data.
+    EXPECT_EQ(crc16::InitValue, crc16::compute(data, 0U));
+    EXPECT_EQ(crc16::InitValue, crc16::compute(nullptr, 10U));
+
+    // Expect the checksum to be computable in several parts.
+    const std::uint16_t firstPart{crc16::compute(data, 4U)};
+    EXPECT_EQ(0x29B1U, crc16::compute(data + 4U, sizeof(data) - 4U, firstPart));
+}
+
+/**
+ * @brief CRC-16 error detection test.
+ * 
+ *        Verify that all single-bit errors are detected.
+ */
+TEST(Telemetry_Crc16, ErrorDetection)
+{
+    std::uint8_t data[]{0x01U, 0x07U, 0x19U, 0x00U, 0x4CU, 0xFFU};
+    const std::uint16_t crc{crc16::compute(data, sizeof(data))};
+
+    for (std::uint8_t i{}; i < sizeof(data); ++i)
+    {
+        for (std::uint8_t bit{}; bit < 8U; ++bit)
+        {
+            data[i] ^= static_cast<std::uint8_t>(1U << bit);
+            EXPECT_NE(crc, crc16::compute(data, sizeof(data)));
+            data[i] ^= static_cast<std::uint8_t>(1U << bit);
+        }
+    }
+}
+} // namespace
+} // namespace telemetry
+
+#endif /** TESTSUITE */
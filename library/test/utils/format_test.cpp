@@ -0,0 +1,168 @@
+/**
+ * @brief Unit tests for type-safe string formatting.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "utils/format.h"
+
+#ifdef TESTSUITE
+
+namespace utils
+{
+namespace
+{
+/**
+ * @brief Sink storing the formatted characters in a string.
+ */
+struct StringSink
+{
+    /** The formatted string. */
+    std::string str{};
+
+    /** The number of write operations. */
+    std::size_t writeCount{};
+
+    // -----------------------------------------------------------------------------
+    void operator()(const char* data, const std::uint16_t length)
+    {
+        str.append(data, length);
+        ++writeCount;
+    }
+};
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+std::string formatString(const char* fmt, const Args&... args)
+{
+    StringSink sink{};
+    format(sink, fmt, args...);
+    return sink.str;
+}
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+std::string snprintfString(const char* fmt, const Args&... args)
+{
+    char buffer[128U]{};
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wformat-security"
+    (void) (std::snprintf(buffer, sizeof(buffer), fmt, args...));
+    #pragma GCC diagnostic pop
+    return std::string{buffer};
+}
+
+/**
+ * @brief Integer formatting test.
+ *
+ *        Verify that integers of all widths are formatted like printf.
+ */
+TEST(Utils_Format, Integers)
+{
+    EXPECT_EQ(std::string{"Temperature: 25 Celsius"},
+              formatString("Temperature: %d Celsius", static_cast<std::int16_t>(25)));
+    EXPECT_EQ(snprintfString("%d", -32768), formatString("%d", INT16_MIN));
+    EXPECT_EQ(snprintfString("%d %u", INT32_MIN, UINT32_MAX),
+              formatString("%d %u", INT32_MIN, UINT32_MAX));
+    EXPECT_EQ(snprintfString("%lld", std::numeric_limits<long long>::min()),
+              formatString("%d", std::numeric_limits<long long>::min()));
+    EXPECT_EQ(snprintfString("%llu", std::numeric_limits<unsigned long long>::max()),
+              formatString("%u", std::numeric_limits<unsigned long long>::max()));
+
+    // Expect 8-bit integers to be printed as numbers, not characters.
+    EXPECT_EQ(std::string{"-128 255"}, formatString("%d %u", INT8_MIN, UINT8_MAX));
+
+    // Expect field width and zero padding to be supported.
+    EXPECT_EQ(snprintfString("[%5d] [%05d] [%1d]", -42, -42, 7),
+              formatString("[%5d] [%05d] [%1d]", -42, -42, 7));
+    EXPECT_EQ(std::string{"0"}, formatString("%d", 0));
+    EXPECT_EQ(std::string{"1 0"}, formatString("%d %d", true, false));
+}
+
+/**
+ * @brief Hexadecimal formatting test.
+ *
+ *        Verify that integers are formatted in hexadecimal form like printf.
+ */
+TEST(Utils_Format, Hex)
+{
+    EXPECT_EQ(std::string{"0x0A 0xbeef 0xDEADBEEF"},
+              formatString("0x%02X 0x%x 0x%lX", static_cast<std::uint8_t>(0xAU), 0xBEEFU,
+                           0xDEADBEEFUL));
+
+    // Expect negative numbers to be printed in two's complement form.
+    EXPECT_EQ(std::string{"ff ffff"}, formatString("%x %x", static_cast<std::int8_t>(-1),
+                                                   static_cast<std::int16_t>(-1)));
+
+    int value{};
+    EXPECT_EQ(snprintfString("%p", static_cast<const void*>(&value)), formatString("%p", &value));
+}
+
+/**
+ * @brief Fixed-point formatting test.
+ *
+ *        Verify that floating-point numbers are formatted in fixed-point notation with
+ *        correct rounding.
+ */
+TEST(Utils_Format, FixedPoint)
+{
+    EXPECT_EQ(snprintfString("%f", 3.14159), formatString("%f", 3.14159));
+    EXPECT_EQ(std::string{"3.14 -2.7 10"}, formatString("%.2f %.1f %.0f", 3.14159, -2.72F, 9.6));
+    EXPECT_EQ(std::string{"0.010"}, formatString("%.3f", 0.00951));
+    EXPECT_EQ(std::string{"  -1.50|-001.50"}, formatString("%7.2f|%07.2f", -1.5, -1.5));
+
+    // Expect values out of range to be reported as such.
+    EXPECT_EQ(std::string{"ovf -ovf nan"},
+              formatString("%f %f %f", 1e10, -std::numeric_limits<double>::infinity(),
+                           std::numeric_limits<double>::quiet_NaN()));
+}
+
+/**
+ * @brief String and character formatting test.
+ *
+ *        Verify that strings and characters are formatted like printf.
+ */
+TEST(Utils_Format, Strings)
+{
+    const std::string name{"sensor"};
+    char buffer[]{"buffer"};
+    EXPECT_EQ(std::string{"Hello sensor, buffer!"},
+              formatString("Hello %s, %s%c", name.c_str(), buffer, '!'));
+    EXPECT_EQ(snprintfString("[%8s] [%.3s]", "abc", "abcdef"),
+              formatString("[%8s] [%.3s]", "abc", "abcdef"));
+    EXPECT_EQ(std::string{"A 65"}, formatString("%c %d", 65, 'A'));
+
+    const char* null{nullptr};
+    EXPECT_EQ(std::string{"(null)"}, formatString("%s", null));
+}
+
+/**
+ * @brief Format string edge case test.
+ *
+ *        Verify that mismatched argument counts and invalid format strings are handled.
+ */
+TEST(Utils_Format, EdgeCases)
+{
+    // Expect superfluous arguments to be ignored.
+    EXPECT_EQ(std::string{"1"}, formatString("%d", 1, 2, 3));
+
+    // Expect specifiers without arguments to be printed as is.
+    EXPECT_EQ(std::string{"1 %d %"}, formatString("%d %d %", 1));
+    EXPECT_EQ(std::string{"50% 50%"}, formatString("%d%% %d%%", 50, 50));
+    EXPECT_EQ(std::string{}, formatString(nullptr, 1));
+
+    // Expect the literal text to be written in one go rather than character by character.
+    StringSink sink{};
+    format(sink, "Temperature: %d Celsius\n", 22);
+    EXPECT_EQ(std::string{"Temperature: 22 Celsius\n"}, sink.str);
+    EXPECT_EQ(3U, sink.writeCount);
+}
+
+} // namespace
+} // namespace utils
+
+#endif /** TESTSUITE */